@@ -0,0 +1,37 @@
+import argparse
+
+
+def make_lut(gamma: float, bits: int):
+    top = (1 << bits) - 1
+    values = []
+    for level in range(256):
+        value = round(top * (level / 255) ** gamma)
+        # Every non-zero level must light the LED
+        if level > 0:
+            value = max(value, 1)
+        values.append(value)
+    return values
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Generates the gamma-corrected PWM duty cycle LUT of the LED Timer')
+    parser.add_argument('--gamma', type=float, default=2.2, help='Gamma of the brightness curve')
+    parser.add_argument('--bits', type=int, default=10, help='Resolution of the PWM duty cycle')
+    args = parser.parse_args()
+
+    values = make_lut(args.gamma, args.bits)
+
+    print('#include <stdint.h>')
+    print('')
+    print(f'// PWM duty cycles ({args.bits} bits) of the brightness levels, gamma={args.gamma}.')
+    print('// Made by GammaLUTGenerator.py.')
+    print('const uint16_t GammaLUT[256] = {')
+    for i in range(0, len(values), 12):
+        chunk = values[i:i + 12]
+        last = i + 12 >= len(values)
+        print('    ' + ', '.join(f'{value:4d}' for value in chunk) + ('' if last else ','))
+    print('};')
+
+
+if __name__ == '__main__':
+    main()
@@ -28,60 +28,71 @@
 #include <stdlib.h>
 #include <xc.h>
 
-Clock_InterruptContext Clock_interruptContext = {
+Utils_InstanceStorage Clock_InterruptContext Clock_interruptContext = {
     .ticks = 0,
     .fastTicks = 0,
-    .utcEpoch = 1704067200, // 2024-01-01 00:00:00
-    .updateCalendar = true
+    .utcEpoch = 1704067200u, // 2024-01-01 00:00:00
+    .updateCalendar = true,
+    .periodShift = 0,
+    .nextPeriodShift = 0
 };
 
-static struct Clock_Context {
-    uint8_t hour;
-    uint8_t minute;
-    uint8_t day : 5;
-    uint8_t weekday : 3;
-    uint8_t leapYear : 1;
-    uint8_t month : 6;
+static Utils_InstanceStorage struct Clock_Context {
+    Date_Calendar calendar;
+    // Local time represented by the calendar
+    Date_Epoch localEpoch;
     uint8_t initialUpdate : 1;
-    YearsFrom1970 year;
-    uint16_t dayOfYear;
 } context = {
-    .hour = 0,
-    .minute = 0,
-    .day = 1,
-    .weekday = 0,
-    .month = 1,
-    .initialUpdate = 1,
-    .year = 0,
-    .dayOfYear = 0
+    .calendar = {
+        .second = 0,
+        .minute = 0,
+        .hour = 0,
+        .day = 1,
+        .month = 1,
+        .weekday = 4,
+        .year = 0,
+        .dayOfYear = 0,
+        .leapYear = false
+    },
+    .localEpoch = 0,
+    .initialUpdate = 1
 };
 
-inline Clock_Time Clock_getMinutesSinceMidnight()
+static Date_Epoch timeZoneOffsetSeconds()
 {
-    return (Clock_Time)context.hour * 60 + context.minute;
+    return (Date_Epoch)((int32_t)Settings_data.time.timeZoneOffsetHalfHours * 30 * 60);
 }
 
-void Clock_setTime(const uint8_t hour, const uint8_t minute)
+// Sets the RTC to the time of the calendar
+static void updateEpochFromCalendar()
 {
-    context.hour = hour;
-    context.minute = minute;
-
-    struct tm time = {};
-    time.tm_hour = context.hour;
-    time.tm_min = context.minute;
-    time.tm_mday = context.day;
-    time.tm_mon = context.month - 1;
-    time.tm_year = (int)context.year + 70;
+    context.localEpoch = Date_calendarToEpoch(&context.calendar);
 
     TMR1_StopTimer();
-    Clock_interruptContext.utcEpoch = mktime(&time)
-        - (time_t)Settings_data.time.timeZoneOffsetHalfHours * 30 * 60;
+    Clock_interruptContext.utcEpoch = context.localEpoch - timeZoneOffsetSeconds();
+    Clock_interruptContext.periodShift = 0;
+    Clock_interruptContext.nextPeriodShift = 0;
+    T1CONbits.T1CKPS = 0;
     TMR1_WriteTimer(0);
     TMR1_StartTimer();
 
     Clock_interruptContext.updateCalendar = true;
 }
 
+inline Clock_Time Clock_getMinutesSinceMidnight()
+{
+    return (Clock_Time)context.calendar.hour * 60 + context.calendar.minute;
+}
+
+void Clock_setTime(const uint8_t hour, const uint8_t minute)
+{
+    context.calendar.hour = hour;
+    context.calendar.minute = minute;
+    context.calendar.second = 0;
+
+    updateEpochFromCalendar();
+}
+
 inline Clock_Ticks Clock_getTicks()
 {
     return Clock_interruptContext.ticks;
@@ -104,30 +115,38 @@ inline Clock_Ticks Clock_getElapsedFastTicks(Clock_Ticks since)
 
 void Clock_task()
 {
-    if (Clock_interruptContext.updateCalendar) {
-        Clock_interruptContext.updateCalendar = false;
+    if (!Clock_interruptContext.updateCalendar) {
+        return;
+    }
 
-        time_t localTime = Clock_interruptContext.utcEpoch +
-            (time_t)Settings_data.time.timeZoneOffsetHalfHours * 30 * 60;
+    Clock_interruptContext.updateCalendar = false;
 
-        struct tm* time = gmtime(&localTime);
+    // The RTC interrupt can change the epoch while it's being read
+    Date_Epoch utcEpoch;
+    do {
+        utcEpoch = Clock_interruptContext.utcEpoch;
+    } while (utcEpoch != Clock_interruptContext.utcEpoch);
 
-        bool updateSunriseSunset = context.dayOfYear != time->tm_yday || context.initialUpdate;
+    Date_Epoch localEpoch = utcEpoch + timeZoneOffsetSeconds();
+    Date_Epoch elapsed = localEpoch - context.localEpoch;
+    uint16_t dayOfYear = context.calendar.dayOfYear;
 
-        context.initialUpdate = false;
+    // The calendar normally follows the 2-second RTC ticks, it's only
+    // recalculated if the time or the time zone has been changed
+    if (context.initialUpdate || elapsed > 255) {
+        Date_calendarFromEpoch(&context.calendar, localEpoch);
+    } else {
+        Date_advanceCalendar(&context.calendar, (uint8_t)elapsed);
+    }
 
-        context.hour = (uint8_t)time->tm_hour;
-        context.minute = (uint8_t)time->tm_min;
-        context.day = (uint8_t)time->tm_mday;
-        context.weekday = (uint8_t)time->tm_wday;
-        context.month = (uint8_t)time->tm_mon + 1;
-        context.year = (uint8_t)(time->tm_year - 70);
-        context.leapYear = Date_isLeapYear(context.year);
-        context.dayOfYear = (uint16_t)time->tm_yday;
+    context.localEpoch = localEpoch;
 
-        if (updateSunriseSunset) {
-            SunriseSunset_update();
-        }
+    bool updateSunriseSunset = context.calendar.dayOfYear != dayOfYear || context.initialUpdate;
+
+    context.initialUpdate = false;
+
+    if (updateSunriseSunset) {
+        SunriseSunset_update();
     }
 }
 
@@ -140,63 +159,129 @@ void Clock_setDate(
         return;
     }
 
-    context.year = year;
-    context.month = month;
-    context.day = day;
+    context.calendar.year = year;
+    context.calendar.month = month;
+    context.calendar.day = day;
 
-    struct tm time = {};
-    time.tm_hour = context.hour;
-    time.tm_min = context.minute;
-    time.tm_mday = context.day;
-    time.tm_mon = context.month - 1;
-    time.tm_year = (int)context.year + 70;
+    updateEpochFromCalendar();
 
-    TMR1_StopTimer();
-    Clock_interruptContext.utcEpoch = mktime(&time) -
-        (time_t)Settings_data.time.timeZoneOffsetHalfHours * 30 * 60;
-    TMR1_StartTimer();
-
-    Clock_interruptContext.updateCalendar = true;
+    // Update the derived fields (weekday, day of year) before the sunrise
+    // and sunset calculation
+    Date_calendarFromEpoch(&context.calendar, context.localEpoch);
 
     SunriseSunset_update();
 }
 
 inline YearsFrom1970 Clock_getYear()
 {
-    return context.year;
+    return context.calendar.year;
 }
 
 inline uint8_t Clock_getMonth()
 {
-    return context.month;
+    return context.calendar.month;
 }
 
 inline uint8_t Clock_getDay()
 {
-    return context.day;
+    return context.calendar.day;
 }
 
 inline uint8_t Clock_getWeekday()
 {
-    return context.weekday;
+    return context.calendar.weekday;
 }
 
 inline bool Clock_isLeapYear()
 {
-    return context.leapYear;
+    return context.calendar.leapYear;
 }
 
 uint16_t Clock_getDayOfYear()
 {
-    return context.dayOfYear;
+    return context.calendar.dayOfYear;
 }
 
 inline uint8_t Clock_getHour()
 {
-    return context.hour;
+    return context.calendar.hour;
 }
 
 inline uint8_t Clock_getMinute()
 {
-    return context.minute;
+    return context.calendar.minute;
+}
+
+inline uint8_t Clock_getSeconds()
+{
+    return context.calendar.second;
+}
+
+uint16_t Clock_getSecondsUntil(const Clock_Time time)
+{
+    int16_t minutes = time - Clock_getMinutesSinceMidnight();
+
+    if (minutes <= 0) {
+        minutes += 1440;
+    }
+
+    uint32_t seconds = (uint32_t)minutes * 60 - context.calendar.second;
+
+    return seconds > 0xFFFFu ? 0xFFFFu : (uint16_t)seconds;
+}
+
+void Clock_setSleepPeriod(const uint16_t seconds)
+{
+    // Called right after a wake-up, the running period is assumed to be
+    // ahead in full
+    uint16_t current = 2u << Clock_interruptContext.periodShift;
+    uint8_t shift = 0;
+
+    if (seconds > current) {
+        uint16_t available = seconds - current;
+
+        // 1:1 .. 1:8 prescaler, 2 .. 16 seconds
+        while (shift < 3 && (4u << shift) <= available) {
+            ++shift;
+        }
+    }
+
+    Clock_interruptContext.nextPeriodShift = shift;
+}
+
+void Clock_resetPeriod()
+{
+    Clock_interruptContext.nextPeriodShift = 0;
+
+    if (Clock_interruptContext.periodShift == 0) {
+        return;
+    }
+
+    uint8_t shift = Clock_interruptContext.periodShift;
+
+    PIE1bits.TMR1IE = 0;
+    TMR1_StopTimer();
+
+    // Finish the period if it has just ended
+    if (PIR1bits.TMR1IF) {
+        PIR1bits.TMR1IF = 0;
+        Clock_handleRTCTimerInterrupt();
+    }
+
+    // Elapsed time of the running period in 1/32768 s
+    uint32_t elapsed = (uint32_t)TMR1_ReadTimer() << shift;
+    uint16_t ticks = (uint16_t)(elapsed >> 16);
+
+    Clock_interruptContext.ticks += (Clock_Ticks)ticks;
+    Clock_interruptContext.utcEpoch += (Date_Epoch)ticks * 2;
+    Clock_interruptContext.updateCalendar = true;
+    Clock_interruptContext.periodShift = 0;
+
+    // The remainder (less than 2 seconds) stays in the timer, so it's
+    // counted by the next overflow
+    T1CONbits.T1CKPS = 0;
+    TMR1_WriteTimer((uint16_t)elapsed);
+    TMR1_StartTimer();
+
+    PIE1bits.TMR1IE = 1;
 }
\ No newline at end of file
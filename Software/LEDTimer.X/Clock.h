@@ -34,35 +34,67 @@ typedef volatile struct
 {
     volatile Clock_Ticks ticks;
     volatile Clock_Ticks fastTicks;
-    volatile time_t utcEpoch;
+    volatile Date_Epoch utcEpoch;
     volatile bool updateCalendar;
+    // Timer1 prescaler (T1CKPS) of the running and the next RTC period,
+    // the period is 2 << periodShift seconds
+    volatile uint8_t periodShift;
+    volatile uint8_t nextPeriodShift;
 } Clock_InterruptContext;
 
+// The prescaler is changed right after the overflow, so the new period starts
+// exactly where the previous one ended
 #define Clock_handleRTCTimerInterrupt() {\
-    extern Clock_InterruptContext Clock_interruptContext; \
-    ++Clock_interruptContext.ticks; \
-    Clock_interruptContext.utcEpoch += 2; \
+    extern Utils_InstanceStorage Clock_InterruptContext Clock_interruptContext; \
+    Clock_interruptContext.ticks += (Clock_Ticks)1 << Clock_interruptContext.periodShift; \
+    Clock_interruptContext.utcEpoch += (Date_Epoch)2 << Clock_interruptContext.periodShift; \
     Clock_interruptContext.updateCalendar = true; \
+    if (Clock_interruptContext.nextPeriodShift != Clock_interruptContext.periodShift) { \
+        Clock_interruptContext.periodShift = Clock_interruptContext.nextPeriodShift; \
+        T1CONbits.T1CKPS = Clock_interruptContext.periodShift; \
+    } \
 }
 
 #define Clock_handleFastTimerInterrupt() { \
-    extern Clock_InterruptContext Clock_interruptContext; \
+    extern Utils_InstanceStorage Clock_InterruptContext Clock_interruptContext; \
     ++Clock_interruptContext.fastTicks; \
 }
 
-inline Clock_Time Clock_getMinutesSinceMidnight(void);
+Utils_Inline Clock_Time Clock_getMinutesSinceMidnight(void);
 void Clock_setTime(uint8_t hour, uint8_t minute);
-inline Clock_Ticks Clock_getTicks(void);
-inline Clock_Ticks Clock_getFastTicks(void);
-inline Clock_Ticks Clock_getElapsedTicks(Clock_Ticks since);
-inline Clock_Ticks Clock_getElapsedFastTicks(Clock_Ticks since);
+Utils_Inline Clock_Ticks Clock_getTicks(void);
+Utils_Inline Clock_Ticks Clock_getFastTicks(void);
+Utils_Inline Clock_Ticks Clock_getElapsedTicks(Clock_Ticks since);
+Utils_Inline Clock_Ticks Clock_getElapsedFastTicks(Clock_Ticks since);
 void Clock_task(void);
 void Clock_setDate(YearsFrom1970 year, uint8_t month, uint8_t day);
-inline YearsFrom1970 Clock_getYear(void);
-inline uint8_t Clock_getMonth(void);
-inline uint8_t Clock_getDay(void);
-inline uint8_t Clock_getWeekday(void);
-inline bool Clock_isLeapYear(void);
+Utils_Inline YearsFrom1970 Clock_getYear(void);
+Utils_Inline uint8_t Clock_getMonth(void);
+Utils_Inline uint8_t Clock_getDay(void);
+Utils_Inline uint8_t Clock_getWeekday(void);
+Utils_Inline bool Clock_isLeapYear(void);
 uint16_t Clock_getDayOfYear(void);
-inline uint8_t Clock_getHour(void);
-inline uint8_t Clock_getMinute(void);
+Utils_Inline uint8_t Clock_getHour(void);
+Utils_Inline uint8_t Clock_getMinute(void);
+Utils_Inline uint8_t Clock_getSeconds(void);
+
+/**
+ * Calculates the time left until the specified time of the day.
+ * @param time Time value in minutes from midnight, the next occurrence is used
+ * @return Seconds until the specified time, saturated to 0xFFFF
+ */
+uint16_t Clock_getSecondsUntil(Clock_Time time);
+
+/**
+ * Lengthens the RTC period (2, 4, 8 or 16 seconds) to reduce the number of
+ * wake-ups while sleeping. The new period starts at the next RTC overflow
+ * and ends before the specified deadline if possible.
+ * @param seconds Time until the next instant that needs work
+ */
+void Clock_setSleepPeriod(uint16_t seconds);
+
+/**
+ * Switches back to the 2-second RTC period immediately. The elapsed part of
+ * a longer period is kept in the timer, so the time remains exact.
+ */
+void Clock_resetPeriod(void);
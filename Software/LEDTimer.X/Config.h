@@ -30,8 +30,25 @@
 /**
  * Settings
  */
+// The settings are stored in two slots (A/B) from this address
 #define Config_Settings_DataBaseAddress                     (0)
-#define Config_Settings_IntervalScheduleCount               (5)
+// Packed into 3 bytes each, both slots of the settings must fit in the EEPROM
+#define Config_Settings_IntervalScheduleCount               (32)
+// Default location for the sunrise and sunset calculation (Budapest)
+#define Config_Settings_DefaultLatitudeBcd                  (0x04746744ul)
+#define Config_Settings_DefaultLongitudeBcd                 (0x01904687ul)
+
+/**
+ * Output
+ */
+// Rate of the fast timer interrupt stepping the brightness ramps
+#define Config_Output_FadeStepsPerSecond                    (100)
+#define Config_Output_DefaultFadeInSeconds                  (2)
+#define Config_Output_DefaultFadeOutSeconds                 (2)
+// Temporal dithering of the duty cycle with 4 extra bits in every PWM
+// period, only below this duty cycle where one step is clearly visible
+#define Config_Output_Dithering                             (1)
+#define Config_Output_DitheringMaxDuty                      (256)
 
 /**
  * System
@@ -0,0 +1,174 @@
+/*
+    This file is part of LEDTimer.
+
+    LEDTimer is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LEDTimer is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LEDTimer.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-17
+*/
+
+#include "Config.h"
+#include "Fader.h"
+
+#include "mcc_generated_files/pwm5.h"
+
+#include <xc.h>
+
+extern const uint16_t GammaLUT[256];
+
+// The position is a level with 16 fractional bits, the fraction is used
+// to interpolate between the LUT entries
+#define PositionOf(_Level)  ((uint32_t)(_Level) << 16)
+
+static struct FaderContext
+{
+    volatile uint32_t position;
+    volatile uint32_t target;
+    volatile uint32_t step;
+    volatile bool fading;
+} context = {
+    .position = 0,
+    .target = 0,
+    .step = 0,
+    .fading = false
+};
+
+volatile Fader_DitherContext Fader_ditherContext;
+
+#if Config_Output_Dithering
+static void setupDithering(const uint16_t duty, const uint8_t fraction)
+{
+    if (fraction == 0 || duty >= Config_Output_DitheringMaxDuty) {
+        PIE1bits.TMR2IE = 0;
+        return;
+    }
+
+    uint16_t high = duty + 1;
+
+    Fader_ditherContext.step = fraction << 4;
+    Fader_ditherContext.lowDCH = (uint8_t)(duty >> 2);
+    Fader_ditherContext.lowDCL = (uint8_t)((duty & 0b11) << 6);
+    Fader_ditherContext.highDCH = (uint8_t)(high >> 2);
+    Fader_ditherContext.highDCL = (uint8_t)((high & 0b11) << 6);
+
+    PIR1bits.TMR2IF = 0;
+    PIE1bits.TMR2IE = 1;
+}
+#endif
+
+static void loadDutyCycle(const uint32_t position)
+{
+    uint8_t level = (uint8_t)(position >> 16);
+    uint16_t duty = GammaLUT[level];
+    uint8_t fraction = 0;
+
+    if (level < 255) {
+        uint16_t delta = GammaLUT[level + 1] - duty;
+
+        // Interpolated with 4 fractional bits. The steepest step of the
+        // curve is below 16, so the product fits in 16 bits.
+        uint16_t offset = (delta * (uint8_t)(position >> 8)) >> 4;
+
+        duty += offset >> 4;
+        fraction = offset & 0x0F;
+    }
+
+    PWM5_LoadDutyValue(duty);
+
+#if Config_Output_Dithering
+    setupDithering(duty, fraction);
+#endif
+}
+
+void Fader_setTarget(const uint8_t level, const uint16_t durationSeconds)
+{
+    uint32_t ticks = (uint32_t)durationSeconds * Config_Output_FadeStepsPerSecond;
+
+    if (ticks == 0) {
+        Fader_setLevel(level);
+        return;
+    }
+
+    // The position is moved by the ISR, the 32-bit value is read and the
+    // ramp is updated with the interrupts disabled so neither can tear
+    uint8_t gie = INTCONbits.GIE;
+    INTCONbits.GIE = 0;
+    uint32_t position = context.position;
+    INTCONbits.GIE = gie;
+
+    uint32_t target = PositionOf(level);
+    uint32_t distance = target > position
+        ? target - position
+        : position - target;
+
+    // Rounded up, so the ramp finishes within the duration. The division is
+    // done outside of the critical section to keep the interrupt latency low.
+    uint32_t step = (distance + ticks - 1) / ticks;
+
+    gie = INTCONbits.GIE;
+    INTCONbits.GIE = 0;
+
+    context.target = target;
+    context.step = step;
+    context.fading = context.position != target;
+
+    INTCONbits.GIE = gie;
+}
+
+void Fader_setLevel(const uint8_t level)
+{
+    uint8_t gie = INTCONbits.GIE;
+    INTCONbits.GIE = 0;
+
+    context.position = PositionOf(level);
+    context.target = context.position;
+    context.fading = false;
+
+    loadDutyCycle(context.position);
+
+    INTCONbits.GIE = gie;
+}
+
+bool Fader_isFading()
+{
+    return context.fading;
+}
+
+void Fader_handleTimerInterrupt()
+{
+    if (!context.fading) {
+        return;
+    }
+
+    uint32_t position = context.position;
+
+    if (position < context.target) {
+        position += context.step;
+
+        if (position >= context.target) {
+            position = context.target;
+        }
+    } else {
+        if (position - context.target <= context.step) {
+            position = context.target;
+        } else {
+            position -= context.step;
+        }
+    }
+
+    context.position = position;
+    context.fading = position != context.target;
+
+    loadDutyCycle(position);
+}
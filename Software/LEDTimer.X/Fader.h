@@ -0,0 +1,100 @@
+/*
+    This file is part of LEDTimer.
+
+    LEDTimer is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LEDTimer is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LEDTimer.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-17
+*/
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Output brightness fader
+ *
+ * The brightness level (0-255) is mapped to the 10-bit PWM duty cycle
+ * through a gamma-corrected LUT. Ramps are stepped from the fast timer
+ * interrupt (Config_Output_FadeStepsPerSecond), the main loop only sets
+ * the targets.
+ *
+ * With Config_Output_Dithering, the duty cycle has 4 more fractional bits
+ * at the low end. A first-order sigma-delta modulator alternates the two
+ * adjacent duty cycles from the TMR2 (PWM period) interrupt.
+ */
+
+typedef struct
+{
+    // Fraction of the duty cycle in the upper 4 bits, added in every period
+    uint8_t step;
+    uint8_t accumulator;
+
+    // PWM5DCH and PWM5DCL values of the two adjacent duty cycles
+    uint8_t lowDCH;
+    uint8_t lowDCL;
+    uint8_t highDCH;
+    uint8_t highDCL;
+} Fader_DitherContext;
+
+/**
+ * Loads the duty cycle of the next PWM period, must be called from the ISR
+ * on every TMR2 interrupt. The carry of the accumulator selects the higher
+ * duty cycle. Kept short, it runs in every PWM period.
+ */
+#define Fader_handlePWMPeriodInterrupt() { \
+    extern volatile Fader_DitherContext Fader_ditherContext; \
+    uint8_t _sum = Fader_ditherContext.accumulator + Fader_ditherContext.step; \
+    if (_sum < Fader_ditherContext.accumulator) { \
+        PWM5DCH = Fader_ditherContext.highDCH; \
+        PWM5DCL = Fader_ditherContext.highDCL; \
+    } else { \
+        PWM5DCH = Fader_ditherContext.lowDCH; \
+        PWM5DCL = Fader_ditherContext.lowDCL; \
+    } \
+    Fader_ditherContext.accumulator = _sum; \
+}
+
+/**
+ * Starts a ramp from the current level to the target level.
+ * @param level Target brightness level
+ * @param durationSeconds Length of the ramp, 0 sets the level immediately
+ */
+void Fader_setTarget(uint8_t level, uint16_t durationSeconds);
+
+/**
+ * Sets the level immediately, stopping the running ramp.
+ * @param level Brightness level
+ */
+void Fader_setLevel(uint8_t level);
+
+/**
+ * @return True while a ramp is running
+ */
+bool Fader_isFading(void);
+
+/**
+ * Advances the running ramp by one step, must be called from the ISR
+ * on every fast timer interrupt.
+ */
+void Fader_handleTimerInterrupt(void);
+
+#ifdef __cplusplus
+}
+#endif
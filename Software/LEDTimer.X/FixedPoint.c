@@ -0,0 +1,151 @@
+/*
+    This file is part of LEDTimer.
+
+    LEDTimer is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LEDTimer is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LEDTimer.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-17
+*/
+
+#include "FixedPoint.h"
+
+#include <stdbool.h>
+
+#define CORDIC_ITERATIONS           (14)
+
+// 0.607253 (1 / CORDIC gain) with 30 fraction bits
+#define CORDIC_GAIN_INVERSE_Q30     (652032874l)
+
+// atan(2^-i) as binary angles
+static const uint16_t CordicAngles[CORDIC_ITERATIONS] = {
+    8192, 4836, 2555, 1297, 651, 326, 163, 81, 41, 20, 10, 5, 3, 1
+};
+
+int32_t FixedPoint_multiply(int32_t a, int32_t b)
+{
+    bool negative = false;
+
+    if (a < 0) {
+        a = -a;
+        negative = true;
+    }
+
+    if (b < 0) {
+        b = -b;
+        negative = !negative;
+    }
+
+    uint16_t aHigh = (uint16_t)((uint32_t)a >> 16);
+    uint16_t aLow = (uint16_t)a;
+    uint16_t bHigh = (uint16_t)((uint32_t)b >> 16);
+    uint16_t bLow = (uint16_t)b;
+
+    // Partial products keep the result in 32 bits
+    uint32_t result = ((uint32_t)aHigh * bHigh << 16)
+        + (uint32_t)aHigh * bLow
+        + (uint32_t)aLow * bHigh
+        + (((uint32_t)aLow * bLow + 0x8000u) >> 16);
+
+    return negative ? -(int32_t)result : (int32_t)result;
+}
+
+uint16_t FixedPoint_squareRoot(uint32_t value)
+{
+    uint32_t result = 0;
+
+    for (uint32_t bit = 1ul << 30; bit != 0; bit >>= 2) {
+        if (value >= result + bit) {
+            value -= result + bit;
+            result = (result >> 1) + bit;
+        } else {
+            result >>= 1;
+        }
+    }
+
+    return (uint16_t)result;
+}
+
+void FixedPoint_sinCos(FixedPoint_Angle angle, int32_t* const sin, int32_t* const cos)
+{
+    // The rotation converges between -90 and 90 degrees
+    bool flip = (FixedPoint_Angle)(angle + FixedPoint_Angle90) >= FixedPoint_Angle180;
+    if (flip) {
+        angle += FixedPoint_Angle180;
+    }
+
+    int16_t z = (int16_t)angle;
+    int32_t x = CORDIC_GAIN_INVERSE_Q30;
+    int32_t y = 0;
+
+    for (uint8_t i = 0; i < CORDIC_ITERATIONS; ++i) {
+        int32_t dx = x >> i;
+        int32_t dy = y >> i;
+
+        if (z >= 0) {
+            x -= dy;
+            y += dx;
+            z -= (int16_t)CordicAngles[i];
+        } else {
+            x += dy;
+            y -= dx;
+            z += (int16_t)CordicAngles[i];
+        }
+    }
+
+    // 30 -> 16 fraction bits
+    x = (x + (1l << 13)) >> 14;
+    y = (y + (1l << 13)) >> 14;
+
+    *sin = flip ? -y : y;
+    *cos = flip ? -x : x;
+}
+
+FixedPoint_Angle FixedPoint_arcTan2(int32_t y, int32_t x)
+{
+    FixedPoint_Angle angle = 0;
+
+    if (x == 0 && y == 0) {
+        return 0;
+    }
+
+    // The vectoring converges for vectors in the right half-plane
+    if (x < 0) {
+        x = -x;
+        y = -y;
+        angle = FixedPoint_Angle180;
+    }
+
+    // Scale up for precision, leaving room for the gain of the iterations
+    while (x < (1l << 28) && y < (1l << 28) && y > -(1l << 28)) {
+        x <<= 1;
+        y <<= 1;
+    }
+
+    for (uint8_t i = 0; i < CORDIC_ITERATIONS; ++i) {
+        int32_t dx = x >> i;
+        int32_t dy = y >> i;
+
+        if (y > 0) {
+            x += dy;
+            y -= dx;
+            angle += CordicAngles[i];
+        } else {
+            x -= dy;
+            y += dx;
+            angle -= CordicAngles[i];
+        }
+    }
+
+    return angle;
+}
@@ -0,0 +1,59 @@
+/*
+    This file is part of LEDTimer.
+
+    LEDTimer is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LEDTimer is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LEDTimer.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-17
+*/
+
+#pragma once
+
+#include <stdint.h>
+
+/*
+ * 32-bit fixed-point arithmetic for the sunrise and sunset calculation.
+ * Values have 16 fraction bits unless noted otherwise, angles are binary
+ * angles where 65536 is a full turn. The run time of the functions doesn't
+ * depend on the arguments.
+ */
+
+typedef uint16_t FixedPoint_Angle;
+
+#define FixedPoint_Angle90                                  (0x4000u)
+#define FixedPoint_Angle180                                 (0x8000u)
+
+#define FixedPoint_One                                      (0x10000l)
+
+/**
+ * @return Rounded product, it must fit in 32 bits
+ */
+int32_t FixedPoint_multiply(int32_t a, int32_t b);
+
+/**
+ * @param value Integer value
+ * @return Integer square root
+ */
+uint16_t FixedPoint_squareRoot(uint32_t value);
+
+/**
+ * Calculates the sine and cosine with CORDIC rotation.
+ */
+void FixedPoint_sinCos(FixedPoint_Angle angle, int32_t* sin, int32_t* cos);
+
+/**
+ * Calculates the angle of the vector with CORDIC vectoring.
+ * The scale of the coordinates doesn't matter, they must be below 2^28.
+ */
+FixedPoint_Angle FixedPoint_arcTan2(int32_t y, int32_t x);
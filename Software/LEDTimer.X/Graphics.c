@@ -255,9 +255,7 @@ void Graphics_drawBitmap(
         return;
     }
 
-    SSD1306_enablePageAddressing();
-    SSD1306_setPage(page);
-    SSD1306_setStartColumn(x);
+    SSD1306_setPosition(page, x);
     SSD1306_sendData2(bitmap, width, flags);
 }
 
@@ -280,6 +278,36 @@ void Graphics_drawMultipageBitmap(
     }
 }
 
+/*
+ * Schedule bar layout
+ *
+ * The bar is 121 columns wide starting at Graphics_ScheduleBarX. Every hour
+ * takes 5 columns: a tick followed by 2 + 2 columns of the indicators of
+ * the two 30-minute segments. Every 6th tick is a long one.
+ */
+#define Graphics_ScheduleBarX           3
+#define Graphics_ScheduleBarWidth       121
+
+typedef struct
+{
+    uint8_t longTick;
+    uint8_t shortTick;
+    uint8_t segmentActiveIndicator;
+    uint8_t segmentInactiveIndicator;
+} Graphics_ScheduleBarPatterns;
+
+static Graphics_ScheduleBarPatterns scheduleBarPatterns(const bool flip)
+{
+    Graphics_ScheduleBarPatterns patterns = {
+        .longTick = flip ? 0b00001111 : 0b11110000,
+        .shortTick = flip ? 0b00001110 : 0b01110000,
+        .segmentActiveIndicator = flip ? 0b11101000 : 0b00010111,
+        .segmentInactiveIndicator = flip ? 0b00001000 : 0b00010000
+    };
+
+    return patterns;
+}
+
 void Graphics_drawScheduleBar(
     const uint8_t line,
     const ScheduleSegmentData segmentData,
@@ -287,67 +315,93 @@ void Graphics_drawScheduleBar(
 )
 {
     uint8_t flip = flags & GRAPHICS_DRAW_SCHEDULE_BAR_FLIP;
-	uint8_t longTick = flip ? 0b00001111 : 0b11110000;
-	uint8_t shortTick = flip ? 0b00001110 : 0b01110000;
-	uint8_t segmentActiveIndicator = flip ? 0b11101000 : 0b00010111;
-	uint8_t segmentInactiveIndicator = flip ? 0b00001000 : 0b00010000;
+	Graphics_ScheduleBarPatterns patterns = scheduleBarPatterns(flip);
 
-	SSD1306_enablePageAddressing();
-	SSD1306_setPage(flip ? line + 1 : line);
-	SSD1306_setStartColumn(3);
+	SSD1306_setPosition(flip ? line + 1 : line, Graphics_ScheduleBarX);
+
+	// The columns are generated on the fly and sent in a single transfer
+	SSD1306_beginData(
+		Graphics_ScheduleBarWidth,
+		flags & GRAPHICS_DRAW_SCHEDULE_BAR_INVERT
+	);
 
-	uint8_t tickCounter = 0;
 	uint8_t longTickCounter = 0;
 	uint8_t dataByteIdx = 0;
-	uint8_t dataBitIdx = 255; // Let it overflow in the first iteration
-	uint8_t indicatorCounter = 0;
-	uint8_t segmentActive = 0;
-
-	for (uint8_t i = 121; i > 0; --i) {
-		uint8_t bitmap;
-
-		if (tickCounter == 0) {
-			// Draw ticks
-			if (longTickCounter == 0)
-				bitmap = longTick;
-			else
-				bitmap = shortTick;
-		} else {
-			// Draw rest of the bar with or without the indicators
-			if (indicatorCounter < 2 && segmentActive)
-				bitmap = segmentActiveIndicator;
-			else
-				bitmap = segmentInactiveIndicator;
-		}
+	uint8_t dataBitIdx = 0;
 
-		SSD1306_sendData2(&bitmap, 1, flags & GRAPHICS_DRAW_SCHEDULE_BAR_INVERT);
+	for (uint8_t i = Graphics_ScheduleBarWidth / 5; i > 0; --i) {
+		// Draw ticks
+		SSD1306_streamFill(
+			longTickCounter == 0 ? patterns.longTick : patterns.shortTick,
+			1
+		);
 
-		if (++tickCounter == 5) {
-			tickCounter = 0;
-			if (++longTickCounter == 6)
-				longTickCounter = 0;
+		if (++longTickCounter == 6) {
+			longTickCounter = 0;
 		}
 
-		++indicatorCounter;
-		if (tickCounter == 1 || tickCounter == 3) {
-			indicatorCounter = 0;
+		// Draw the indicators of the two segments of the hour
+		for (uint8_t j = 2; j > 0; --j) {
+			SSD1306_streamFill(
+				(segmentData[dataByteIdx] >> dataBitIdx) & 1
+					? patterns.segmentActiveIndicator
+					: patterns.segmentInactiveIndicator,
+				2
+			);
+
 			if (++dataBitIdx == 8) {
 				++dataByteIdx;
 				dataBitIdx = 0;
 			}
-
-			segmentActive = (segmentData[dataByteIdx] >> dataBitIdx) & 1;
 		}
 	}
 
+	// Closing tick (24:00)
+	SSD1306_streamFill(patterns.longTick, 1);
+
     uint8_t textLine = flip ? line : line + 1;
     uint8_t yOffset = flip ? 1 : 0;
 
-	Text_draw("0", textLine, 1, yOffset, flags & GRAPHICS_DRAW_SCHEDULE_BAR_INVERT);
-	Text_draw("6", textLine, 31, yOffset, flags & GRAPHICS_DRAW_SCHEDULE_BAR_INVERT);
-	Text_draw("12", textLine, 58, yOffset, flags & GRAPHICS_DRAW_SCHEDULE_BAR_INVERT);
-	Text_draw("18", textLine, 88, yOffset, flags & GRAPHICS_DRAW_SCHEDULE_BAR_INVERT);
-	Text_draw("24", textLine, 115, yOffset, flags & GRAPHICS_DRAW_SCHEDULE_BAR_INVERT);
+    uint8_t labelFlags = SSD1306_SEND_BITSHIFT(yOffset);
+    if (flags & GRAPHICS_DRAW_SCHEDULE_BAR_INVERT) {
+        labelFlags |= GRAPHICS_DRAW_INVERT;
+    }
+
+	Graphics_drawLabel2(Label_Hour0, textLine, 1, labelFlags);
+	Graphics_drawLabel2(Label_Hour6, textLine, 31, labelFlags);
+	Graphics_drawLabel2(Label_Hour12, textLine, 58, labelFlags);
+	Graphics_drawLabel2(Label_Hour18, textLine, 88, labelFlags);
+	Graphics_drawLabel2(Label_Hour24, textLine, 115, labelFlags);
+}
+
+void Graphics_drawScheduleBarSegment(
+    const uint8_t line,
+    const ScheduleSegmentData segmentData,
+    const uint8_t segmentIndex,
+    const uint8_t flags
+)
+{
+    if (segmentIndex >= 48) {
+        return;
+    }
+
+    uint8_t flip = flags & GRAPHICS_DRAW_SCHEDULE_BAR_FLIP;
+	Graphics_ScheduleBarPatterns patterns = scheduleBarPatterns(flip);
+
+	// Skip the ticks and the indicators of the preceding segments
+	uint8_t x = Graphics_ScheduleBarX + 1;
+	x += segmentIndex << 1;
+	x += segmentIndex >> 1;
+
+	SSD1306_setPosition(flip ? line + 1 : line, x);
+
+	SSD1306_beginData(2, flags & GRAPHICS_DRAW_SCHEDULE_BAR_INVERT);
+	SSD1306_streamFill(
+		Types_getScheduleSegmentBit(segmentData, segmentIndex)
+			? patterns.segmentActiveIndicator
+			: patterns.segmentInactiveIndicator,
+		2
+	);
 }
 
 void Graphics_drawScheduleSegmentIndicator(
@@ -398,13 +452,49 @@ void Graphics_drawScheduleSegmentIndicator(
     );
 }
 
-void Graphics_drawScreenTitleHelper(const char* text, uint8_t pos)
+uint8_t Graphics_drawLabel(const Label label, const uint8_t line, const uint8_t x)
+{
+    return Graphics_drawLabel2(label, line, x, 0);
+}
+
+uint8_t Graphics_drawLabel2(
+    const Label label,
+    const uint8_t line,
+    const uint8_t x,
+    const uint8_t flags
+)
 {
-    SSD1306_enablePageAddressing();
-    SSD1306_setPage(0);
-    SSD1306_setStartColumn(pos);
+    if (label >= Label_Count || line > 7 || x > 127) {
+        return x;
+    }
+
+    const Labels_Entry* entry = &Labels_entries[label];
+
+    // The spacing after the last character is added like Text_draw() does
+    uint8_t width = entry->columns + 1;
+    if (width > SSD1306_LCDWIDTH - x) {
+        width = SSD1306_LCDWIDTH - x;
+    }
+
+    SSD1306_setPosition(line, x);
+    SSD1306_beginData(width, flags);
+    // Clamped to the transfer length, endData() sends the spacing
+    SSD1306_streamData(&Labels_columns[entry->offset], entry->columns);
+    SSD1306_endData();
+
+    return x + entry->columns + 1;
+}
+
+void Graphics_drawScreenTitle(const Label label)
+{
+    uint8_t pos = 64
+        - (Labels_entries[label].columns / 2)
+        - sizeof(Graphics_HeaderLeftCapIcon)
+        - 2;
+
+    SSD1306_setPosition(0, pos);
     SSD1306_sendData(Graphics_HeaderLeftCapIcon, sizeof(Graphics_HeaderLeftCapIcon));
-    pos = Text_draw(text, 0, pos + sizeof(Graphics_HeaderLeftCapIcon) + 2, 0, false);
+    pos = Graphics_drawLabel(label, 0, pos + sizeof(Graphics_HeaderLeftCapIcon) + 2);
     SSD1306_setStartColumn(pos + 1);
     SSD1306_sendData2(
         Graphics_HeaderLeftCapIcon,
@@ -418,9 +508,7 @@ void Graphics_drawScreenTitleHelper(const char* text, uint8_t pos)
 
 void Graphics_drawKeypadHelpBarSeparators()
 {
-    SSD1306_enablePageAddressing();
-    SSD1306_setPage(7);
-    SSD1306_setStartColumn(32 - sizeof(Graphics_KeypadHelpBarSeparator) / 2);
+    SSD1306_setPosition(7, 32 - sizeof(Graphics_KeypadHelpBarSeparator) / 2);
     SSD1306_sendData(Graphics_KeypadHelpBarSeparator, sizeof(Graphics_KeypadHelpBarSeparator));
     SSD1306_setStartColumn(96 - sizeof(Graphics_KeypadHelpBarSeparator) / 2);
     SSD1306_sendData(Graphics_KeypadHelpBarSeparator, sizeof(Graphics_KeypadHelpBarSeparator));
@@ -430,7 +518,6 @@ void Graphics_drawVerticalLine(const uint8_t x, const uint8_t line)
 {
     static const uint8_t Pattern = 0xFF;
 
-    SSD1306_setPage(line);
-    SSD1306_setStartColumn(x);
+    SSD1306_setPosition(line, x);
     SSD1306_sendData(&Pattern, sizeof(Pattern));
 }
\ No newline at end of file
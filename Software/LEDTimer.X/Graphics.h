@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include "Labels.h"
 #include "SSD1306.h"
 #include "Text.h"
 #include "Types.h"
@@ -27,6 +28,10 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 #define Graphics_BulbIconWidth                      15
 #define Graphics_BulbIconPages                      3
 extern const uint8_t Graphics_BulbIcon[Graphics_BulbIconPages][Graphics_BulbIconWidth];
@@ -113,6 +118,21 @@ void Graphics_drawScheduleBar(
     uint8_t flags
 );
 
+/**
+ * Redraws the indicator of a single segment of a schedule bar drawn by
+ * Graphics_drawScheduleBar().
+ * @param line Same as the line of the schedule bar
+ * @param segmentData Schedule segment data
+ * @param segmentIndex Index of the segment to redraw (0..47)
+ * @param flags Same as the flags of the schedule bar
+ */
+void Graphics_drawScheduleBarSegment(
+    uint8_t line,
+    const ScheduleSegmentData segmentData,
+    uint8_t segmentIndex,
+    uint8_t flags
+);
+
 void Graphics_drawScheduleSegmentIndicator(
     uint8_t line,
     uint8_t segmentIndex,
@@ -128,6 +148,9 @@ void Graphics_drawScheduleSegmentIndicator(
 #define Graphics_DrawRightIcon(_Line, _Icon) \
     Graphics_DrawIcon(128 - sizeof((_Icon)), (_Line), (_Icon))
 
+#define Graphics_DrawCenterLabel(_Label, _Line) \
+    Graphics_drawLabel((_Label), (_Line), 64 - Labels_entries[(_Label)].columns / 2)
+
 #define Graphics_DrawKeypadHelpBar(_Icon1, _Icon2, _Icon3) \
     Graphics_drawKeypadHelpBarSeparators(); \
     SSD1306_setStartColumn(0); \
@@ -144,13 +167,30 @@ void Graphics_drawScheduleSegmentIndicator(
     SSD1306_setStartColumn(128 - sizeof((_Icon3))); \
     SSD1306_sendData((_Icon3), sizeof((_Icon3)))
 
-#define Graphics_DrawScreenTitle(_Text) { \
-    Graphics_drawScreenTitleHelper( \
-        (_Text), \
-        64 - CalculateTextWidth((_Text)) / 2 - sizeof(Graphics_HeaderLeftCapIcon) - 2 \
-    ); \
-}
-
-void Graphics_drawScreenTitleHelper(const char* text, uint8_t pos);
+/**
+ * Draws a pre-rendered label (see Labels.h). The result is the same as
+ * drawing its text with Text_draw().
+ * @param label Label to draw
+ * @param line Position of the label from the top, measured in pages (8 pixels)
+ * @param x Position of the label from the left
+ * @return Position of the end of the label from the left
+ */
+uint8_t Graphics_drawLabel(Label label, uint8_t line, uint8_t x);
+
+/**
+ * Draws a pre-rendered label with transformations.
+ * @param flags See GRAPHICS_DRAW_* and SSD1306_SEND_BITSHIFT()
+ */
+uint8_t Graphics_drawLabel2(Label label, uint8_t line, uint8_t x, uint8_t flags);
+
+/**
+ * Draws the title of a screen centered in the first line.
+ * @param label Title of the screen
+ */
+void Graphics_drawScreenTitle(Label label);
 void Graphics_drawKeypadHelpBarSeparators(void);
-void Graphics_drawVerticalLine(uint8_t x, uint8_t line);
\ No newline at end of file
+void Graphics_drawVerticalLine(uint8_t x, uint8_t line);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,420 @@
+// Made by LabelGenerator.py, do not edit.
+
+#include "Labels.h"
+
+const Labels_Entry Labels_entries[Label_Count] = {
+    { 0, 47 }, // Settings
+    { 47, 53 }, // Scheduler
+    { 100, 101 }, // SegmentScheduler
+    { 201, 77 }, // SegmentSchedulerTitle
+    { 278, 83 }, // LEDBrightness
+    { 361, 95 }, // DisplayBrightness
+    { 456, 23 }, // Date
+    { 479, 23 }, // Time
+    { 502, 53 }, // TimeZone
+    { 555, 17 }, // DST
+    { 572, 47 }, // Location
+    { 619, 29 }, // Type
+    { 648, 53 }, // Schedule
+    { 701, 41 }, // Active
+    { 742, 17 }, // On
+    { 759, 23 }, // Off
+    { 782, 41 }, // Offset
+    { 823, 29 }, // TimeField
+    { 852, 17 }, // Minutes
+    { 869, 5 }, // Colon
+    { 874, 89 }, // ChangeSettings
+    { 963, 125 }, // OnSegmentSchedulerScreen
+    { 1088, 119 }, // OutputWillOnly
+    { 1207, 119 }, // BeSwitchedManually
+    { 1326, 47 }, // SchedulerTypeInterval
+    { 1373, 41 }, // SchedulerTypeSegment
+    { 1414, 17 }, // SchedulerTypeOff
+    { 1431, 23 }, // SwitchTypeTime
+    { 1454, 41 }, // SwitchTypeSunrise
+    { 1495, 35 }, // SwitchTypeSunset
+    { 1530, 29 }, // NextOn
+    { 1559, 29 }, // NextOff
+    { 1588, 59 }, // NoNextTransition
+    { 1647, 29 }, // Start
+    { 1676, 17 }, // End
+    { 1693, 11 }, // Of
+    { 1704, 23 }, // First
+    { 1727, 23 }, // Second
+    { 1750, 23 }, // Last
+    { 1773, 17 }, // Sunday
+    { 1790, 17 }, // Monday
+    { 1807, 17 }, // Tuesday
+    { 1824, 17 }, // Wednesday
+    { 1841, 17 }, // Thursday
+    { 1858, 17 }, // Friday
+    { 1875, 17 }, // Saturday
+    { 1892, 17 }, // January
+    { 1909, 17 }, // February
+    { 1926, 17 }, // March
+    { 1943, 17 }, // April
+    { 1960, 17 }, // May
+    { 1977, 17 }, // June
+    { 1994, 17 }, // July
+    { 2011, 17 }, // August
+    { 2028, 17 }, // September
+    { 2045, 17 }, // October
+    { 2062, 17 }, // November
+    { 2079, 17 }, // December
+    { 2096, 29 }, // Latitude
+    { 2125, 29 }, // Longitude
+    { 2154, 5 }, // Hour0
+    { 2159, 5 }, // Hour6
+    { 2164, 11 }, // Hour12
+    { 2175, 11 }, // Hour18
+    { 2186, 11 } // Hour24
+};
+
+const uint8_t Labels_columns[2197] = {
+    // Settings: "SETTINGS"
+    0x46, 0x49, 0x49, 0x49, 0x31, 0x00, 0x7F, 0x49, 0x49, 0x49, 0x41, 0x00,
+    0x01, 0x01, 0x7F, 0x01, 0x01, 0x00, 0x01, 0x01, 0x7F, 0x01, 0x01, 0x00,
+    0x00, 0x41, 0x7F, 0x41, 0x00, 0x00, 0x7F, 0x04, 0x08, 0x10, 0x7F, 0x00,
+    0x3E, 0x41, 0x49, 0x49, 0x7A, 0x00, 0x46, 0x49, 0x49, 0x49, 0x31,
+    // Scheduler: "SCHEDULER"
+    0x46, 0x49, 0x49, 0x49, 0x31, 0x00, 0x3E, 0x41, 0x41, 0x41, 0x22, 0x00,
+    0x7F, 0x08, 0x08, 0x08, 0x7F, 0x00, 0x7F, 0x49, 0x49, 0x49, 0x41, 0x00,
+    0x7F, 0x41, 0x41, 0x22, 0x1C, 0x00, 0x3F, 0x40, 0x40, 0x40, 0x3F, 0x00,
+    0x7F, 0x40, 0x40, 0x40, 0x40, 0x00, 0x7F, 0x49, 0x49, 0x49, 0x41, 0x00,
+    0x7F, 0x09, 0x19, 0x29, 0x46,
+    // SegmentScheduler: "SEGMENT SCHEDULER"
+    0x46, 0x49, 0x49, 0x49, 0x31, 0x00, 0x7F, 0x49, 0x49, 0x49, 0x41, 0x00,
+    0x3E, 0x41, 0x49, 0x49, 0x7A, 0x00, 0x7F, 0x02, 0x0C, 0x02, 0x7F, 0x00,
+    0x7F, 0x49, 0x49, 0x49, 0x41, 0x00, 0x7F, 0x04, 0x08, 0x10, 0x7F, 0x00,
+    0x01, 0x01, 0x7F, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x46, 0x49, 0x49, 0x49, 0x31, 0x00, 0x3E, 0x41, 0x41, 0x41, 0x22, 0x00,
+    0x7F, 0x08, 0x08, 0x08, 0x7F, 0x00, 0x7F, 0x49, 0x49, 0x49, 0x41, 0x00,
+    0x7F, 0x41, 0x41, 0x22, 0x1C, 0x00, 0x3F, 0x40, 0x40, 0x40, 0x3F, 0x00,
+    0x7F, 0x40, 0x40, 0x40, 0x40, 0x00, 0x7F, 0x49, 0x49, 0x49, 0x41, 0x00,
+    0x7F, 0x09, 0x19, 0x29, 0x46,
+    // SegmentSchedulerTitle: "SEGMENT SCHD."
+    0x46, 0x49, 0x49, 0x49, 0x31, 0x00, 0x7F, 0x49, 0x49, 0x49, 0x41, 0x00,
+    0x3E, 0x41, 0x49, 0x49, 0x7A, 0x00, 0x7F, 0x02, 0x0C, 0x02, 0x7F, 0x00,
+    0x7F, 0x49, 0x49, 0x49, 0x41, 0x00, 0x7F, 0x04, 0x08, 0x10, 0x7F, 0x00,
+    0x01, 0x01, 0x7F, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x46, 0x49, 0x49, 0x49, 0x31, 0x00, 0x3E, 0x41, 0x41, 0x41, 0x22, 0x00,
+    0x7F, 0x08, 0x08, 0x08, 0x7F, 0x00, 0x7F, 0x41, 0x41, 0x22, 0x1C, 0x00,
+    0x00, 0x60, 0x60, 0x00, 0x00,
+    // LEDBrightness: "LED BRIGHTNESS"
+    0x7F, 0x40, 0x40, 0x40, 0x40, 0x00, 0x7F, 0x49, 0x49, 0x49, 0x41, 0x00,
+    0x7F, 0x41, 0x41, 0x22, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7F, 0x49, 0x49, 0x49, 0x36, 0x00, 0x7F, 0x09, 0x19, 0x29, 0x46, 0x00,
+    0x00, 0x41, 0x7F, 0x41, 0x00, 0x00, 0x3E, 0x41, 0x49, 0x49, 0x7A, 0x00,
+    0x7F, 0x08, 0x08, 0x08, 0x7F, 0x00, 0x01, 0x01, 0x7F, 0x01, 0x01, 0x00,
+    0x7F, 0x04, 0x08, 0x10, 0x7F, 0x00, 0x7F, 0x49, 0x49, 0x49, 0x41, 0x00,
+    0x46, 0x49, 0x49, 0x49, 0x31, 0x00, 0x46, 0x49, 0x49, 0x49, 0x31,
+    // DisplayBrightness: "DISP. BRIGHTNESS"
+    0x7F, 0x41, 0x41, 0x22, 0x1C, 0x00, 0x00, 0x41, 0x7F, 0x41, 0x00, 0x00,
+    0x46, 0x49, 0x49, 0x49, 0x31, 0x00, 0x7F, 0x09, 0x09, 0x09, 0x06, 0x00,
+    0x00, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7F, 0x49, 0x49, 0x49, 0x36, 0x00, 0x7F, 0x09, 0x19, 0x29, 0x46, 0x00,
+    0x00, 0x41, 0x7F, 0x41, 0x00, 0x00, 0x3E, 0x41, 0x49, 0x49, 0x7A, 0x00,
+    0x7F, 0x08, 0x08, 0x08, 0x7F, 0x00, 0x01, 0x01, 0x7F, 0x01, 0x01, 0x00,
+    0x7F, 0x04, 0x08, 0x10, 0x7F, 0x00, 0x7F, 0x49, 0x49, 0x49, 0x41, 0x00,
+    0x46, 0x49, 0x49, 0x49, 0x31, 0x00, 0x46, 0x49, 0x49, 0x49, 0x31,
+    // Date: "DATE"
+    0x7F, 0x41, 0x41, 0x22, 0x1C, 0x00, 0x7E, 0x11, 0x11, 0x11, 0x7E, 0x00,
+    0x01, 0x01, 0x7F, 0x01, 0x01, 0x00, 0x7F, 0x49, 0x49, 0x49, 0x41,
+    // Time: "TIME"
+    0x01, 0x01, 0x7F, 0x01, 0x01, 0x00, 0x00, 0x41, 0x7F, 0x41, 0x00, 0x00,
+    0x7F, 0x02, 0x0C, 0x02, 0x7F, 0x00, 0x7F, 0x49, 0x49, 0x49, 0x41,
+    // TimeZone: "TIME ZONE"
+    0x01, 0x01, 0x7F, 0x01, 0x01, 0x00, 0x00, 0x41, 0x7F, 0x41, 0x00, 0x00,
+    0x7F, 0x02, 0x0C, 0x02, 0x7F, 0x00, 0x7F, 0x49, 0x49, 0x49, 0x41, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x51, 0x49, 0x45, 0x43, 0x00,
+    0x3E, 0x41, 0x41, 0x41, 0x3E, 0x00, 0x7F, 0x04, 0x08, 0x10, 0x7F, 0x00,
+    0x7F, 0x49, 0x49, 0x49, 0x41,
+    // DST: "DST"
+    0x7F, 0x41, 0x41, 0x22, 0x1C, 0x00, 0x46, 0x49, 0x49, 0x49, 0x31, 0x00,
+    0x01, 0x01, 0x7F, 0x01, 0x01,
+    // Location: "LOCATION"
+    0x7F, 0x40, 0x40, 0x40, 0x40, 0x00, 0x3E, 0x41, 0x41, 0x41, 0x3E, 0x00,
+    0x3E, 0x41, 0x41, 0x41, 0x22, 0x00, 0x7E, 0x11, 0x11, 0x11, 0x7E, 0x00,
+    0x01, 0x01, 0x7F, 0x01, 0x01, 0x00, 0x00, 0x41, 0x7F, 0x41, 0x00, 0x00,
+    0x3E, 0x41, 0x41, 0x41, 0x3E, 0x00, 0x7F, 0x04, 0x08, 0x10, 0x7F,
+    // Type: "TYPE:"
+    0x01, 0x01, 0x7F, 0x01, 0x01, 0x00, 0x07, 0x08, 0x70, 0x08, 0x07, 0x00,
+    0x7F, 0x09, 0x09, 0x09, 0x06, 0x00, 0x7F, 0x49, 0x49, 0x49, 0x41, 0x00,
+    0x00, 0x36, 0x36, 0x00, 0x00,
+    // Schedule: "SCHEDULE:"
+    0x46, 0x49, 0x49, 0x49, 0x31, 0x00, 0x3E, 0x41, 0x41, 0x41, 0x22, 0x00,
+    0x7F, 0x08, 0x08, 0x08, 0x7F, 0x00, 0x7F, 0x49, 0x49, 0x49, 0x41, 0x00,
+    0x7F, 0x41, 0x41, 0x22, 0x1C, 0x00, 0x3F, 0x40, 0x40, 0x40, 0x3F, 0x00,
+    0x7F, 0x40, 0x40, 0x40, 0x40, 0x00, 0x7F, 0x49, 0x49, 0x49, 0x41, 0x00,
+    0x00, 0x36, 0x36, 0x00, 0x00,
+    // Active: "ACTIVE:"
+    0x7E, 0x11, 0x11, 0x11, 0x7E, 0x00, 0x3E, 0x41, 0x41, 0x41, 0x22, 0x00,
+    0x01, 0x01, 0x7F, 0x01, 0x01, 0x00, 0x00, 0x41, 0x7F, 0x41, 0x00, 0x00,
+    0x1F, 0x20, 0x40, 0x20, 0x1F, 0x00, 0x7F, 0x49, 0x49, 0x49, 0x41, 0x00,
+    0x00, 0x36, 0x36, 0x00, 0x00,
+    // On: "ON:"
+    0x3E, 0x41, 0x41, 0x41, 0x3E, 0x00, 0x7F, 0x04, 0x08, 0x10, 0x7F, 0x00,
+    0x00, 0x36, 0x36, 0x00, 0x00,
+    // Off: "OFF:"
+    0x3E, 0x41, 0x41, 0x41, 0x3E, 0x00, 0x7F, 0x09, 0x09, 0x09, 0x01, 0x00,
+    0x7F, 0x09, 0x09, 0x09, 0x01, 0x00, 0x00, 0x36, 0x36, 0x00, 0x00,
+    // Offset: "OFFSET:"
+    0x3E, 0x41, 0x41, 0x41, 0x3E, 0x00, 0x7F, 0x09, 0x09, 0x09, 0x01, 0x00,
+    0x7F, 0x09, 0x09, 0x09, 0x01, 0x00, 0x46, 0x49, 0x49, 0x49, 0x31, 0x00,
+    0x7F, 0x49, 0x49, 0x49, 0x41, 0x00, 0x01, 0x01, 0x7F, 0x01, 0x01, 0x00,
+    0x00, 0x36, 0x36, 0x00, 0x00,
+    // TimeField: "TIME:"
+    0x01, 0x01, 0x7F, 0x01, 0x01, 0x00, 0x00, 0x41, 0x7F, 0x41, 0x00, 0x00,
+    0x7F, 0x02, 0x0C, 0x02, 0x7F, 0x00, 0x7F, 0x49, 0x49, 0x49, 0x41, 0x00,
+    0x00, 0x36, 0x36, 0x00, 0x00,
+    // Minutes: "MIN"
+    0x7F, 0x02, 0x0C, 0x02, 0x7F, 0x00, 0x00, 0x41, 0x7F, 0x41, 0x00, 0x00,
+    0x7F, 0x04, 0x08, 0x10, 0x7F,
+    // Colon: ":"
+    0x00, 0x36, 0x36, 0x00, 0x00,
+    // ChangeSettings: "CHANGE SETTINGS"
+    0x3E, 0x41, 0x41, 0x41, 0x22, 0x00, 0x7F, 0x08, 0x08, 0x08, 0x7F, 0x00,
+    0x7E, 0x11, 0x11, 0x11, 0x7E, 0x00, 0x7F, 0x04, 0x08, 0x10, 0x7F, 0x00,
+    0x3E, 0x41, 0x49, 0x49, 0x7A, 0x00, 0x7F, 0x49, 0x49, 0x49, 0x41, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x49, 0x49, 0x49, 0x31, 0x00,
+    0x7F, 0x49, 0x49, 0x49, 0x41, 0x00, 0x01, 0x01, 0x7F, 0x01, 0x01, 0x00,
+    0x01, 0x01, 0x7F, 0x01, 0x01, 0x00, 0x00, 0x41, 0x7F, 0x41, 0x00, 0x00,
+    0x7F, 0x04, 0x08, 0x10, 0x7F, 0x00, 0x3E, 0x41, 0x49, 0x49, 0x7A, 0x00,
+    0x46, 0x49, 0x49, 0x49, 0x31,
+    // OnSegmentSchedulerScreen: "ON SGMT. SCHD. SCREEN"
+    0x3E, 0x41, 0x41, 0x41, 0x3E, 0x00, 0x7F, 0x04, 0x08, 0x10, 0x7F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x49, 0x49, 0x49, 0x31, 0x00,
+    0x3E, 0x41, 0x49, 0x49, 0x7A, 0x00, 0x7F, 0x02, 0x0C, 0x02, 0x7F, 0x00,
+    0x01, 0x01, 0x7F, 0x01, 0x01, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x49, 0x49, 0x49, 0x31, 0x00,
+    0x3E, 0x41, 0x41, 0x41, 0x22, 0x00, 0x7F, 0x08, 0x08, 0x08, 0x7F, 0x00,
+    0x7F, 0x41, 0x41, 0x22, 0x1C, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x49, 0x49, 0x49, 0x31, 0x00,
+    0x3E, 0x41, 0x41, 0x41, 0x22, 0x00, 0x7F, 0x09, 0x19, 0x29, 0x46, 0x00,
+    0x7F, 0x49, 0x49, 0x49, 0x41, 0x00, 0x7F, 0x49, 0x49, 0x49, 0x41, 0x00,
+    0x7F, 0x04, 0x08, 0x10, 0x7F,
+    // OutputWillOnly: "THE OUTPUT WILL ONLY"
+    0x01, 0x01, 0x7F, 0x01, 0x01, 0x00, 0x7F, 0x08, 0x08, 0x08, 0x7F, 0x00,
+    0x7F, 0x49, 0x49, 0x49, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3E, 0x41, 0x41, 0x41, 0x3E, 0x00, 0x3F, 0x40, 0x40, 0x40, 0x3F, 0x00,
+    0x01, 0x01, 0x7F, 0x01, 0x01, 0x00, 0x7F, 0x09, 0x09, 0x09, 0x06, 0x00,
+    0x3F, 0x40, 0x40, 0x40, 0x3F, 0x00, 0x01, 0x01, 0x7F, 0x01, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x38, 0x40, 0x3F, 0x00,
+    0x00, 0x41, 0x7F, 0x41, 0x00, 0x00, 0x7F, 0x40, 0x40, 0x40, 0x40, 0x00,
+    0x7F, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3E, 0x41, 0x41, 0x41, 0x3E, 0x00, 0x7F, 0x04, 0x08, 0x10, 0x7F, 0x00,
+    0x7F, 0x40, 0x40, 0x40, 0x40, 0x00, 0x07, 0x08, 0x70, 0x08, 0x07,
+    // BeSwitchedManually: "BE SWITCHED MANUALLY"
+    0x7F, 0x49, 0x49, 0x49, 0x36, 0x00, 0x7F, 0x49, 0x49, 0x49, 0x41, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x49, 0x49, 0x49, 0x31, 0x00,
+    0x3F, 0x40, 0x38, 0x40, 0x3F, 0x00, 0x00, 0x41, 0x7F, 0x41, 0x00, 0x00,
+    0x01, 0x01, 0x7F, 0x01, 0x01, 0x00, 0x3E, 0x41, 0x41, 0x41, 0x22, 0x00,
+    0x7F, 0x08, 0x08, 0x08, 0x7F, 0x00, 0x7F, 0x49, 0x49, 0x49, 0x41, 0x00,
+    0x7F, 0x41, 0x41, 0x22, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7F, 0x02, 0x0C, 0x02, 0x7F, 0x00, 0x7E, 0x11, 0x11, 0x11, 0x7E, 0x00,
+    0x7F, 0x04, 0x08, 0x10, 0x7F, 0x00, 0x3F, 0x40, 0x40, 0x40, 0x3F, 0x00,
+    0x7E, 0x11, 0x11, 0x11, 0x7E, 0x00, 0x7F, 0x40, 0x40, 0x40, 0x40, 0x00,
+    0x7F, 0x40, 0x40, 0x40, 0x40, 0x00, 0x07, 0x08, 0x70, 0x08, 0x07,
+    // SchedulerTypeInterval: "INTERVAL"
+    0x00, 0x41, 0x7F, 0x41, 0x00, 0x00, 0x7F, 0x04, 0x08, 0x10, 0x7F, 0x00,
+    0x01, 0x01, 0x7F, 0x01, 0x01, 0x00, 0x7F, 0x49, 0x49, 0x49, 0x41, 0x00,
+    0x7F, 0x09, 0x19, 0x29, 0x46, 0x00, 0x1F, 0x20, 0x40, 0x20, 0x1F, 0x00,
+    0x7E, 0x11, 0x11, 0x11, 0x7E, 0x00, 0x7F, 0x40, 0x40, 0x40, 0x40,
+    // SchedulerTypeSegment: "SEGMENT"
+    0x46, 0x49, 0x49, 0x49, 0x31, 0x00, 0x7F, 0x49, 0x49, 0x49, 0x41, 0x00,
+    0x3E, 0x41, 0x49, 0x49, 0x7A, 0x00, 0x7F, 0x02, 0x0C, 0x02, 0x7F, 0x00,
+    0x7F, 0x49, 0x49, 0x49, 0x41, 0x00, 0x7F, 0x04, 0x08, 0x10, 0x7F, 0x00,
+    0x01, 0x01, 0x7F, 0x01, 0x01,
+    // SchedulerTypeOff: "OFF"
+    0x3E, 0x41, 0x41, 0x41, 0x3E, 0x00, 0x7F, 0x09, 0x09, 0x09, 0x01, 0x00,
+    0x7F, 0x09, 0x09, 0x09, 0x01,
+    // SwitchTypeTime: "TIME"
+    0x01, 0x01, 0x7F, 0x01, 0x01, 0x00, 0x00, 0x41, 0x7F, 0x41, 0x00, 0x00,
+    0x7F, 0x02, 0x0C, 0x02, 0x7F, 0x00, 0x7F, 0x49, 0x49, 0x49, 0x41,
+    // SwitchTypeSunrise: "SUNRISE"
+    0x46, 0x49, 0x49, 0x49, 0x31, 0x00, 0x3F, 0x40, 0x40, 0x40, 0x3F, 0x00,
+    0x7F, 0x04, 0x08, 0x10, 0x7F, 0x00, 0x7F, 0x09, 0x19, 0x29, 0x46, 0x00,
+    0x00, 0x41, 0x7F, 0x41, 0x00, 0x00, 0x46, 0x49, 0x49, 0x49, 0x31, 0x00,
+    0x7F, 0x49, 0x49, 0x49, 0x41,
+    // SwitchTypeSunset: "SUNSET"
+    0x46, 0x49, 0x49, 0x49, 0x31, 0x00, 0x3F, 0x40, 0x40, 0x40, 0x3F, 0x00,
+    0x7F, 0x04, 0x08, 0x10, 0x7F, 0x00, 0x46, 0x49, 0x49, 0x49, 0x31, 0x00,
+    0x7F, 0x49, 0x49, 0x49, 0x41, 0x00, 0x01, 0x01, 0x7F, 0x01, 0x01,
+    // NextOn: "ON:  "
+    0x3E, 0x41, 0x41, 0x41, 0x3E, 0x00, 0x7F, 0x04, 0x08, 0x10, 0x7F, 0x00,
+    0x00, 0x36, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // NextOff: "OFF: "
+    0x3E, 0x41, 0x41, 0x41, 0x3E, 0x00, 0x7F, 0x09, 0x09, 0x09, 0x01, 0x00,
+    0x7F, 0x09, 0x09, 0x09, 0x01, 0x00, 0x00, 0x36, 0x36, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // NoNextTransition: "---: --:--"
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x36, 0x36, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x36, 0x36, 0x00, 0x00, 0x00,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08,
+    // Start: "START"
+    0x46, 0x49, 0x49, 0x49, 0x31, 0x00, 0x01, 0x01, 0x7F, 0x01, 0x01, 0x00,
+    0x7E, 0x11, 0x11, 0x11, 0x7E, 0x00, 0x7F, 0x09, 0x19, 0x29, 0x46, 0x00,
+    0x01, 0x01, 0x7F, 0x01, 0x01,
+    // End: "END"
+    0x7F, 0x49, 0x49, 0x49, 0x41, 0x00, 0x7F, 0x04, 0x08, 0x10, 0x7F, 0x00,
+    0x7F, 0x41, 0x41, 0x22, 0x1C,
+    // Of: "OF"
+    0x3E, 0x41, 0x41, 0x41, 0x3E, 0x00, 0x7F, 0x09, 0x09, 0x09, 0x01,
+    // First: "1ST "
+    0x00, 0x42, 0x7F, 0x40, 0x00, 0x00, 0x46, 0x49, 0x49, 0x49, 0x31, 0x00,
+    0x01, 0x01, 0x7F, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // Second: "2ND "
+    0x42, 0x61, 0x51, 0x49, 0x46, 0x00, 0x7F, 0x04, 0x08, 0x10, 0x7F, 0x00,
+    0x7F, 0x41, 0x41, 0x22, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    // Last: "LAST"
+    0x7F, 0x40, 0x40, 0x40, 0x40, 0x00, 0x7E, 0x11, 0x11, 0x11, 0x7E, 0x00,
+    0x46, 0x49, 0x49, 0x49, 0x31, 0x00, 0x01, 0x01, 0x7F, 0x01, 0x01,
+    // Sunday: "SUN"
+    0x46, 0x49, 0x49, 0x49, 0x31, 0x00, 0x3F, 0x40, 0x40, 0x40, 0x3F, 0x00,
+    0x7F, 0x04, 0x08, 0x10, 0x7F,
+    // Monday: "MON"
+    0x7F, 0x02, 0x0C, 0x02, 0x7F, 0x00, 0x3E, 0x41, 0x41, 0x41, 0x3E, 0x00,
+    0x7F, 0x04, 0x08, 0x10, 0x7F,
+    // Tuesday: "TUE"
+    0x01, 0x01, 0x7F, 0x01, 0x01, 0x00, 0x3F, 0x40, 0x40, 0x40, 0x3F, 0x00,
+    0x7F, 0x49, 0x49, 0x49, 0x41,
+    // Wednesday: "WED"
+    0x3F, 0x40, 0x38, 0x40, 0x3F, 0x00, 0x7F, 0x49, 0x49, 0x49, 0x41, 0x00,
+    0x7F, 0x41, 0x41, 0x22, 0x1C,
+    // Thursday: "THU"
+    0x01, 0x01, 0x7F, 0x01, 0x01, 0x00, 0x7F, 0x08, 0x08, 0x08, 0x7F, 0x00,
+    0x3F, 0x40, 0x40, 0x40, 0x3F,
+    // Friday: "FRI"
+    0x7F, 0x09, 0x09, 0x09, 0x01, 0x00, 0x7F, 0x09, 0x19, 0x29, 0x46, 0x00,
+    0x00, 0x41, 0x7F, 0x41, 0x00,
+    // Saturday: "SAT"
+    0x46, 0x49, 0x49, 0x49, 0x31, 0x00, 0x7E, 0x11, 0x11, 0x11, 0x7E, 0x00,
+    0x01, 0x01, 0x7F, 0x01, 0x01,
+    // January: "JAN"
+    0x20, 0x40, 0x41, 0x3F, 0x01, 0x00, 0x7E, 0x11, 0x11, 0x11, 0x7E, 0x00,
+    0x7F, 0x04, 0x08, 0x10, 0x7F,
+    // February: "FEB"
+    0x7F, 0x09, 0x09, 0x09, 0x01, 0x00, 0x7F, 0x49, 0x49, 0x49, 0x41, 0x00,
+    0x7F, 0x49, 0x49, 0x49, 0x36,
+    // March: "MAR"
+    0x7F, 0x02, 0x0C, 0x02, 0x7F, 0x00, 0x7E, 0x11, 0x11, 0x11, 0x7E, 0x00,
+    0x7F, 0x09, 0x19, 0x29, 0x46,
+    // April: "APR"
+    0x7E, 0x11, 0x11, 0x11, 0x7E, 0x00, 0x7F, 0x09, 0x09, 0x09, 0x06, 0x00,
+    0x7F, 0x09, 0x19, 0x29, 0x46,
+    // May: "MAY"
+    0x7F, 0x02, 0x0C, 0x02, 0x7F, 0x00, 0x7E, 0x11, 0x11, 0x11, 0x7E, 0x00,
+    0x07, 0x08, 0x70, 0x08, 0x07,
+    // June: "JUN"
+    0x20, 0x40, 0x41, 0x3F, 0x01, 0x00, 0x3F, 0x40, 0x40, 0x40, 0x3F, 0x00,
+    0x7F, 0x04, 0x08, 0x10, 0x7F,
+    // July: "JUL"
+    0x20, 0x40, 0x41, 0x3F, 0x01, 0x00, 0x3F, 0x40, 0x40, 0x40, 0x3F, 0x00,
+    0x7F, 0x40, 0x40, 0x40, 0x40,
+    // August: "AUG"
+    0x7E, 0x11, 0x11, 0x11, 0x7E, 0x00, 0x3F, 0x40, 0x40, 0x40, 0x3F, 0x00,
+    0x3E, 0x41, 0x49, 0x49, 0x7A,
+    // September: "SEP"
+    0x46, 0x49, 0x49, 0x49, 0x31, 0x00, 0x7F, 0x49, 0x49, 0x49, 0x41, 0x00,
+    0x7F, 0x09, 0x09, 0x09, 0x06,
+    // October: "OCT"
+    0x3E, 0x41, 0x41, 0x41, 0x3E, 0x00, 0x3E, 0x41, 0x41, 0x41, 0x22, 0x00,
+    0x01, 0x01, 0x7F, 0x01, 0x01,
+    // November: "NOV"
+    0x7F, 0x04, 0x08, 0x10, 0x7F, 0x00, 0x3E, 0x41, 0x41, 0x41, 0x3E, 0x00,
+    0x1F, 0x20, 0x40, 0x20, 0x1F,
+    // December: "DEC"
+    0x7F, 0x41, 0x41, 0x22, 0x1C, 0x00, 0x7F, 0x49, 0x49, 0x49, 0x41, 0x00,
+    0x3E, 0x41, 0x41, 0x41, 0x22,
+    // Latitude: "LAT.:"
+    0x7F, 0x40, 0x40, 0x40, 0x40, 0x00, 0x7E, 0x11, 0x11, 0x11, 0x7E, 0x00,
+    0x01, 0x01, 0x7F, 0x01, 0x01, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0x36, 0x36, 0x00, 0x00,
+    // Longitude: "LON.:"
+    0x7F, 0x40, 0x40, 0x40, 0x40, 0x00, 0x3E, 0x41, 0x41, 0x41, 0x3E, 0x00,
+    0x7F, 0x04, 0x08, 0x10, 0x7F, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00,
+    0x00, 0x36, 0x36, 0x00, 0x00,
+    // Hour0: "0"
+    0x3E, 0x51, 0x49, 0x45, 0x3E,
+    // Hour6: "6"
+    0x3C, 0x4A, 0x49, 0x49, 0x30,
+    // Hour12: "12"
+    0x00, 0x42, 0x7F, 0x40, 0x00, 0x00, 0x42, 0x61, 0x51, 0x49, 0x46,
+    // Hour18: "18"
+    0x00, 0x42, 0x7F, 0x40, 0x00, 0x00, 0x36, 0x49, 0x49, 0x49, 0x36,
+    // Hour24: "24"
+    0x42, 0x61, 0x51, 0x49, 0x46, 0x00, 0x18, 0x14, 0x12, 0x7F, 0x10
+};
+
+#ifdef LABELS_WITH_TEXT
+const char* const Labels_texts[Label_Count] = {
+    "SETTINGS",
+    "SCHEDULER",
+    "SEGMENT SCHEDULER",
+    "SEGMENT SCHD.",
+    "LED BRIGHTNESS",
+    "DISP. BRIGHTNESS",
+    "DATE",
+    "TIME",
+    "TIME ZONE",
+    "DST",
+    "LOCATION",
+    "TYPE:",
+    "SCHEDULE:",
+    "ACTIVE:",
+    "ON:",
+    "OFF:",
+    "OFFSET:",
+    "TIME:",
+    "MIN",
+    ":",
+    "CHANGE SETTINGS",
+    "ON SGMT. SCHD. SCREEN",
+    "THE OUTPUT WILL ONLY",
+    "BE SWITCHED MANUALLY",
+    "INTERVAL",
+    "SEGMENT",
+    "OFF",
+    "TIME",
+    "SUNRISE",
+    "SUNSET",
+    "ON:  ",
+    "OFF: ",
+    "---: --:--",
+    "START",
+    "END",
+    "OF",
+    "1ST ",
+    "2ND ",
+    "LAST",
+    "SUN",
+    "MON",
+    "TUE",
+    "WED",
+    "THU",
+    "FRI",
+    "SAT",
+    "JAN",
+    "FEB",
+    "MAR",
+    "APR",
+    "MAY",
+    "JUN",
+    "JUL",
+    "AUG",
+    "SEP",
+    "OCT",
+    "NOV",
+    "DEC",
+    "LAT.:",
+    "LON.:",
+    "0",
+    "6",
+    "12",
+    "18",
+    "24"
+};
+#endif
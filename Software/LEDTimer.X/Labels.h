@@ -0,0 +1,98 @@
+// Made by LabelGenerator.py, do not edit.
+
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    Label_Settings, // "SETTINGS"
+    Label_Scheduler, // "SCHEDULER"
+    Label_SegmentScheduler, // "SEGMENT SCHEDULER"
+    Label_SegmentSchedulerTitle, // "SEGMENT SCHD."
+    Label_LEDBrightness, // "LED BRIGHTNESS"
+    Label_DisplayBrightness, // "DISP. BRIGHTNESS"
+    Label_Date, // "DATE"
+    Label_Time, // "TIME"
+    Label_TimeZone, // "TIME ZONE"
+    Label_DST, // "DST"
+    Label_Location, // "LOCATION"
+    Label_Type, // "TYPE:"
+    Label_Schedule, // "SCHEDULE:"
+    Label_Active, // "ACTIVE:"
+    Label_On, // "ON:"
+    Label_Off, // "OFF:"
+    Label_Offset, // "OFFSET:"
+    Label_TimeField, // "TIME:"
+    Label_Minutes, // "MIN"
+    Label_Colon, // ":"
+    Label_ChangeSettings, // "CHANGE SETTINGS"
+    Label_OnSegmentSchedulerScreen, // "ON SGMT. SCHD. SCREEN"
+    Label_OutputWillOnly, // "THE OUTPUT WILL ONLY"
+    Label_BeSwitchedManually, // "BE SWITCHED MANUALLY"
+    Label_SchedulerTypeInterval, // "INTERVAL"
+    Label_SchedulerTypeSegment, // "SEGMENT"
+    Label_SchedulerTypeOff, // "OFF"
+    Label_SwitchTypeTime, // "TIME"
+    Label_SwitchTypeSunrise, // "SUNRISE"
+    Label_SwitchTypeSunset, // "SUNSET"
+    Label_NextOn, // "ON:  "
+    Label_NextOff, // "OFF: "
+    Label_NoNextTransition, // "---: --:--"
+    Label_Start, // "START"
+    Label_End, // "END"
+    Label_Of, // "OF"
+    Label_First, // "1ST "
+    Label_Second, // "2ND "
+    Label_Last, // "LAST"
+    Label_Sunday, // "SUN"
+    Label_Monday, // "MON"
+    Label_Tuesday, // "TUE"
+    Label_Wednesday, // "WED"
+    Label_Thursday, // "THU"
+    Label_Friday, // "FRI"
+    Label_Saturday, // "SAT"
+    Label_January, // "JAN"
+    Label_February, // "FEB"
+    Label_March, // "MAR"
+    Label_April, // "APR"
+    Label_May, // "MAY"
+    Label_June, // "JUN"
+    Label_July, // "JUL"
+    Label_August, // "AUG"
+    Label_September, // "SEP"
+    Label_October, // "OCT"
+    Label_November, // "NOV"
+    Label_December, // "DEC"
+    Label_Latitude, // "LAT.:"
+    Label_Longitude, // "LON.:"
+    Label_Hour0, // "0"
+    Label_Hour6, // "6"
+    Label_Hour12, // "12"
+    Label_Hour18, // "18"
+    Label_Hour24, // "24"
+
+    Label_Count
+} Label;
+
+typedef struct {
+    uint16_t offset;
+    uint8_t columns;
+} Labels_Entry;
+
+// Position of the labels in Labels_columns
+extern const Labels_Entry Labels_entries[Label_Count];
+
+// Rendered columns of the labels (without the spacing after the last character)
+extern const uint8_t Labels_columns[];
+
+#ifdef LABELS_WITH_TEXT
+extern const char* const Labels_texts[Label_Count];
+#endif
+
+#ifdef __cplusplus
+}
+#endif
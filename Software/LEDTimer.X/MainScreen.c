@@ -27,17 +27,25 @@
 #include "Text.h"
 #include "Keypad.h"
 #include "OutputController.h"
+#include "Widget.h"
 
 #include <stdio.h>
 
 #pragma warning push
 #pragma warning disable 763
 
+#define WidgetCount 6
+#define NoTransitionState 0xFFFFFFFFul
+
 static struct MainScreenContext {
-    uint8_t scheduleSegmentIndex;
-} context = {
-    .scheduleSegmentIndex = 0
-};
+    struct NextTransition {
+        int8_t index;
+        bool on;
+        Clock_Time time;
+    } nextTransition;
+    Widget_State widgetStates[WidgetCount];
+    Text_7SegCache clock;
+} context;
 
 static void drawOutputToggleKeyHelp()
 {
@@ -124,8 +132,6 @@ static void drawKeypadHelpBar()
 #else
     SSD1306_fillAreaPattern(1, 7, 6, 1, 0b01001001);
 #endif
-
-    drawOutputToggleKeyHelp();
 }
 
 static void drawClock()
@@ -134,7 +140,7 @@ static void drawClock()
 //    snprintf(s, sizeof(s), "%02u:%02u", hours, minutes);
     sprintf(s, "%02u:%02u", Clock_getHour(), Clock_getMinute());
 
-    Text_draw7Seg(s, 3, 15, false);
+    Text_draw7SegCached(s, 3, 15, false, &context.clock);
 }
 
 static void drawScheduleWidget(const bool redraw)
@@ -146,40 +152,39 @@ static void drawScheduleWidget(const bool redraw)
 
     switch (Settings_data.scheduler.type) {
         case Settings_SchedulerType_Interval: {
-            int8_t index = -1;
-            bool on = false;
+            const uint8_t StartPos = Graphics_ArrowRightIconWidth + 6;
 
-            Graphics_drawBitmap(
-                Graphics_ArrowRightIcon,
-                Graphics_ArrowRightIconWidth,
-                1,
-                0,
-                0
-            );
+            if (redraw) {
+                Graphics_drawBitmap(
+                    Graphics_ArrowRightIcon,
+                    Graphics_ArrowRightIconWidth,
+                    1,
+                    0,
+                    0
+                );
+            } else {
+                // Clear the previous transition, it may have a sun icon
+                SSD1306_fillArea(StartPos, 0, 128 - StartPos, 1, SSD1306_COLOR_BLACK);
+            }
 
-            const uint8_t StartPos = Graphics_ArrowRightIconWidth + 6;
+            const struct NextTransition* next = &context.nextTransition;
 
-            if (
-                OutputController_getNextTransition(
-                    Clock_getMinutesSinceMidnight(),
-                    &index,
-                    &on
-                )
-            ) {
-                struct IntervalSwitch* sw = NULL;
-
-                if (on) {
-                    sw = &Settings_data.scheduler.intervals[index].onSwitch;
-                } else {
-                    sw = &Settings_data.scheduler.intervals[index].offSwitch;
-                }
+            if (next->index >= 0) {
+                struct IntervalScheduler interval;
+                Settings_unpackInterval(&Settings_data.scheduler.intervals[next->index], &interval);
 
-                Clock_Time transitionTime = OutputController_calculateSwitchTime(sw);
+                const struct IntervalSwitch* sw = next->on
+                    ? &interval.onSwitch
+                    : &interval.offSwitch;
 
-                uint8_t hours = (uint8_t)(transitionTime / 60);
-                uint8_t minutes = (uint8_t)(transitionTime - hours * 60);
+                uint8_t hours = (uint8_t)(next->time / 60);
+                uint8_t minutes = (uint8_t)(next->time - hours * 60);
 
-                uint8_t x = Text_draw(on ? "ON:  " : "OFF: ", 0, StartPos, 0, false);
+                uint8_t x = Graphics_drawLabel(
+                    next->on ? Label_NextOn : Label_NextOff,
+                    0,
+                    StartPos
+                );
 
                 char buf[25] = { 0 };
                 sprintf(buf, "%2u:%02u", hours, minutes);
@@ -216,7 +221,7 @@ static void drawScheduleWidget(const bool redraw)
                     x = Text_draw(buf, 0, x, 0, false);
                 }
             } else {
-                Text_draw("---: --:--", 0, StartPos, 0, false);
+                Graphics_drawLabel(Label_NoNextTransition, 0, StartPos);
             }
 
             break;
@@ -231,15 +236,14 @@ static void drawScheduleWidget(const bool redraw)
                 );
             }
 
-            uint8_t segmentIndex = Types_calculateScheduleSegmentIndex(
-                Clock_getMinutesSinceMidnight()
+            Graphics_drawScheduleSegmentIndicator(
+                2,
+                Types_calculateScheduleSegmentIndex(
+                    Clock_getMinutesSinceMidnight()
+                ),
+                GRAPHICS_DRAW_SCHEDULE_BAR_FLIP
             );
 
-            if (context.scheduleSegmentIndex != segmentIndex || redraw) {
-                context.scheduleSegmentIndex = segmentIndex;
-                Graphics_drawScheduleSegmentIndicator(2, segmentIndex, GRAPHICS_DRAW_SCHEDULE_BAR_FLIP);
-            }
-
             break;
         }
     }
@@ -347,19 +351,139 @@ static void drawPowerIndicator()
     }
 }
 
-void MainScreen_update(const bool redraw)
+static Widget_State bulbIconState()
+{
+    return OutputController_isOutputEnabled();
+}
+
+static void drawBulbIconWidget(const bool redraw)
+{
+    (void)redraw;
+
+    drawBulbIcon(OutputController_isOutputEnabled());
+}
+
+static Widget_State clockState()
+{
+    return Clock_getMinutesSinceMidnight();
+}
+
+static void drawClockWidget(const bool redraw)
 {
     if (redraw) {
-        drawKeypadHelpBar();
+        Text_invalidate7SegCache(&context.clock);
     }
 
-    drawBulbIcon(OutputController_isOutputEnabled());
     drawClock();
-    drawScheduleWidget(redraw);
+}
+
+static Widget_State scheduleWidgetState()
+{
+    if (Settings_data.scheduler.type == Settings_SchedulerType_Segment) {
+        return Types_calculateScheduleSegmentIndex(
+            Clock_getMinutesSinceMidnight()
+        );
+    }
+
+    struct NextTransition* next = &context.nextTransition;
+
+    next->index = -1;
+
+    if (
+        !OutputController_getNextTransition(
+            Clock_getMinutesSinceMidnight(),
+            &next->index,
+            &next->on,
+            &next->time
+        )
+    ) {
+        next->index = -1;
+        return NoTransitionState;
+    }
+
+    // Minutes: bits 0..10, on: bit 11, interval index: bits 12..16
+    return next->time
+        | ((Widget_State)next->on << 11)
+        | ((Widget_State)next->index << 12);
+}
+
+static Widget_State outputToggleKeyHelpState()
+{
+    return OutputController_outputEnableTargetState();
+}
+
+static void drawOutputToggleKeyHelpWidget(const bool redraw)
+{
+    (void)redraw;
+
     drawOutputToggleKeyHelp();
+}
+
+static Widget_State powerIndicatorState()
+{
+    return System_isRunningFromBackupBattery()
+        ? 1 + System_getBatteryLevel()
+        : 0;
+}
+
+static void drawPowerIndicatorWidget(const bool redraw)
+{
+    (void)redraw;
+
     drawPowerIndicator();
 }
 
+static Widget_State savingIndicatorState()
+{
+    return Settings_isSaving();
+}
+
+static void drawSavingIndicatorWidget(const bool redraw)
+{
+    static const uint8_t X = 10;
+
+    // Floppy disk
+    static const uint8_t SavingIcon[] = {
+        0b01111111,
+        0b01000001,
+        0b01110111,
+        0b01110111,
+        0b01110001,
+        0b01000011,
+        0b01111110
+    };
+
+    if (Settings_isSaving()) {
+        Graphics_drawBitmap(SavingIcon, sizeof(SavingIcon), X, 7, 0);
+    } else if (!redraw) {
+        // The help bar is drawn without the icon on redraw
+        SSD1306_fillArea(X, 7, sizeof(SavingIcon), 1, SSD1306_COLOR_BLACK);
+    }
+}
+
+static const Widget Widgets[WidgetCount] = {
+    { bulbIconState, drawBulbIconWidget },
+    { clockState, drawClockWidget },
+    { scheduleWidgetState, drawScheduleWidget },
+    { outputToggleKeyHelpState, drawOutputToggleKeyHelpWidget },
+    { powerIndicatorState, drawPowerIndicatorWidget },
+    { savingIndicatorState, drawSavingIndicatorWidget }
+};
+
+void MainScreen_update(const bool redraw)
+{
+    if (redraw) {
+        drawKeypadHelpBar();
+    }
+
+    Widget_updateAll(
+        Widgets,
+        context.widgetStates,
+        WidgetCount,
+        redraw
+    );
+}
+
 bool MainScreen_handleKeyPress(const uint8_t keyCode, const bool hold)
 {
     switch (keyCode) {
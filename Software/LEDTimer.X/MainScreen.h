@@ -20,8 +20,10 @@
 
 #pragma once
 
+#include "Utils.h"
+
 #include <stdbool.h>
 #include <stdint.h>
 
 void MainScreen_update(bool redraw);
-inline bool MainScreen_handleKeyPress(uint8_t keyCode, bool hold);
\ No newline at end of file
+Utils_Inline bool MainScreen_handleKeyPress(uint8_t keyCode, bool hold);
\ No newline at end of file
@@ -0,0 +1,131 @@
+/*
+    This file is part of LEDTimer.
+
+    LEDTimer is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LEDTimer is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LEDTimer.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-17
+*/
+
+#include "NVM.h"
+
+#include "mcc_generated_files/memory.h"
+#include "mcc_generated_files/tmr1.h"
+
+#include <xc.h>
+
+#include <string.h>
+
+Utils_InstanceStorage NVM_Statistics NVM_statistics;
+
+static Utils_InstanceStorage struct NVMContext
+{
+    const uint8_t* data;
+    uint8_t address;
+    // Offset of the next byte to check and the end of the region
+    volatile uint8_t next;
+    volatile uint8_t end;
+    volatile bool busy;
+    uint16_t writeStartTime;
+} context = {
+    .data = 0,
+    .address = 0,
+    .next = 0,
+    .end = 0,
+    .busy = false,
+    .writeStartTime = 0
+};
+
+static void startWrite(const uint8_t address, const uint8_t value)
+{
+    NVMADRH = 0x70;     // Data EEPROM
+    NVMADRL = address;
+    NVMDATL = value;
+    NVMCON1bits.NVMREGS = 1;
+    NVMCON1bits.WREN = 1;
+
+    // The unlock sequence must not be interrupted
+    uint8_t gie = INTCONbits.GIE;
+    INTCONbits.GIE = 0;
+    NVMCON2 = 0x55;
+    NVMCON2 = 0xAA;
+    NVMCON1bits.WR = 1;
+    INTCONbits.GIE = gie;
+
+    context.writeStartTime = TMR1_ReadTimer();
+}
+
+// Starts writing the next changed byte, returns false if there is none
+static bool writeNextByte()
+{
+    while (context.next < context.end) {
+        uint8_t offset = context.next++;
+        uint8_t address = context.address + offset;
+        uint8_t value = context.data[offset];
+
+        if (DATAEE_ReadByte(address) != value) {
+            ++NVM_statistics.bytesWritten;
+            startWrite(address, value);
+            return true;
+        }
+
+        ++NVM_statistics.bytesSkipped;
+    }
+
+    NVMCON1bits.WREN = 0;
+
+    return false;
+}
+
+void NVM_init()
+{
+    PIE2bits.NVMIE = 0;
+    PIR2bits.NVMIF = 0;
+
+    memset((void*)&context, 0, sizeof(context));
+    memset(&NVM_statistics, 0, sizeof(NVM_statistics));
+}
+
+void NVM_write(const uint8_t address, const uint8_t* data, const uint8_t length)
+{
+    // Keep the interrupt handler away while the region is changed
+    PIE2bits.NVMIE = 0;
+
+    context.data = data;
+    context.address = address;
+    context.next = 0;
+    context.end = length;
+
+    // A running write continues from the interrupt
+    if (!context.busy) {
+        context.busy = writeNextByte();
+    }
+
+    PIE2bits.NVMIE = context.busy;
+}
+
+bool NVM_isBusy()
+{
+    return context.busy;
+}
+
+void NVM_handleInterrupt()
+{
+    NVM_statistics.writeTime += (uint16_t)(TMR1_ReadTimer() - context.writeStartTime);
+
+    if (!writeNextByte()) {
+        PIE2bits.NVMIE = 0;
+        context.busy = false;
+    }
+}
@@ -0,0 +1,83 @@
+/*
+    This file is part of LEDTimer.
+
+    LEDTimer is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LEDTimer is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LEDTimer.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-17
+*/
+
+#pragma once
+
+#include "Utils.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Interrupt-driven data EEPROM writer
+ *
+ * The bytes of a RAM region are compared with the EEPROM and only the
+ * different ones are written, one at a time. The next byte is started from
+ * the NVM interrupt when the previous write finishes, so the CPU doesn't
+ * wait for the writes and the interrupts are only disabled for the unlock
+ * sequence.
+ */
+
+typedef struct
+{
+    // Bytes written and skipped (unchanged)
+    uint16_t bytesWritten;
+    uint16_t bytesSkipped;
+
+    // Duration of the byte writes in Timer1 counts (1/32768 s with the
+    // 2-second RTC period)
+    uint32_t writeTime;
+} NVM_Statistics;
+
+extern Utils_InstanceStorage NVM_Statistics NVM_statistics;
+
+/**
+ * Resets the state of the writer and the statistics.
+ */
+void NVM_init(void);
+
+/**
+ * Starts writing a RAM region to the data EEPROM. If a write is already in
+ * progress, the region is compared again from the beginning, so the latest
+ * content is written. Only one region can be written at a time.
+ * @param address EEPROM address of the region
+ * @param data Content of the region, must be valid until the write finishes
+ * @param length Length of the region
+ */
+void NVM_write(uint8_t address, const uint8_t* data, uint8_t length);
+
+/**
+ * @return True while the EEPROM is being written
+ */
+bool NVM_isBusy(void);
+
+/**
+ * Starts writing the next changed byte, must be called from the ISR
+ * when NVMIF is set.
+ */
+void NVM_handleInterrupt(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -19,13 +19,15 @@
 */
 
 #include "Clock.h"
+#include "Fader.h"
 #include "OutputController.h"
+#include "OutputStateTable.h"
+#include "ScheduleTable.h"
 #include "Settings.h"
 #include "SunsetSunrise.h"
 #include "System.h"
 #include "Types.h"
 
-#include "mcc_generated_files/pwm5.h"
 
 #if DEBUG_ENABLE
 #include "UI.h"
@@ -34,21 +36,21 @@
 #include <stdbool.h>
 #include <stdio.h>
 
-static struct OutputControllerContext
+static Utils_InstanceStorage struct OutputControllerContext
 {
-    uint8_t outputOverride : 1;
-    uint8_t prevOutputState : 1;
+    // OutputState_* bits, see OutputStateTable.h
+    uint8_t state : 3;
     uint8_t forceOutputStateUpdate : 1;
-    uint8_t switchedOnBySchedule : 1;
-    uint8_t prevStateFromSchedule : 1;
     uint8_t suspended : 1;
+    uint8_t scheduleTableValid : 1;
+    ScheduleTable scheduleTable;
+    Clock_Time scheduleSunrise;
+    Clock_Time scheduleSunset;
 } context = {
-    .outputOverride = 0,
-    .prevOutputState = 0,
+    .state = 0,
     .forceOutputStateUpdate = 0,
-    .switchedOnBySchedule = 0,
-    .prevStateFromSchedule = 0,
-    .suspended = 0
+    .suspended = 0,
+    .scheduleTableValid = 0
 };
 
 Clock_Time calculateSunEventTime(const Clock_Time eventTime, const int8_t offset) {
@@ -58,7 +60,7 @@ Clock_Time calculateSunEventTime(const Clock_Time eventTime, const int8_t offset
         return (Clock_Time)(1440 + t);
     }
 
-    if (t > 1440) {
+    if (t >= 1440) {
         return (Clock_Time)(t - 1440);
     }
 
@@ -81,38 +83,57 @@ Clock_Time OutputController_calculateSwitchTime(struct IntervalSwitch* sw)
     return 0;
 }
 
-static inline bool isSwitchedOnBySchedule()
+/*
+    Compiles the intervals into the schedule table if the settings changed
+    since the last time or the sunrise / sunset time moved (e.g. on a new day).
+ */
+static void updateScheduleTable()
 {
-    switch (Settings_data.scheduler.type) {
-        case Settings_SchedulerType_Interval: {
-            Clock_Time currentTime = Clock_getMinutesSinceMidnight();
+    Clock_Time sunrise = SunriseSunset_getSunrise();
+    Clock_Time sunset = SunriseSunset_getSunset();
+
+    if (
+        context.scheduleTableValid
+        && context.scheduleSunrise == sunrise
+        && context.scheduleSunset == sunset
+    ) {
+        return;
+    }
 
-            for (uint8_t i = 0; i < Config_Settings_IntervalScheduleCount; ++i) {
-                if (!Settings_data.scheduler.intervals[i].active) {
-                    continue;
-                }
+    // Decoded one by one, without a copy of all the intervals on the stack
+    ScheduleTable_begin(&context.scheduleTable);
 
-                Clock_Time onTime = OutputController_calculateSwitchTime(
-                    &Settings_data.scheduler.intervals[i].onSwitch
-                );
-
-                Clock_Time offTime = OutputController_calculateSwitchTime(
-                    &Settings_data.scheduler.intervals[i].offSwitch
-                );
-
-                if (onTime <= offTime) {
-                    if (currentTime >= onTime && currentTime < offTime) {
-                        return true;
-                    }
-                } else {
-                    if (currentTime >= onTime || currentTime < offTime) {
-                        return true;
-                    }
-                }
-            }
+    for (uint8_t i = 0; i < Config_Settings_IntervalScheduleCount; ++i) {
+        struct IntervalScheduler interval;
+        Settings_unpackInterval(&Settings_data.scheduler.intervals[i], &interval);
 
-            return false;
+        if (interval.active) {
+            ScheduleTable_addInterval(
+                &context.scheduleTable,
+                i,
+                OutputController_calculateSwitchTime(&interval.onSwitch),
+                OutputController_calculateSwitchTime(&interval.offSwitch)
+            );
         }
+    }
+
+    ScheduleTable_finish(&context.scheduleTable);
+
+    context.scheduleSunrise = sunrise;
+    context.scheduleSunset = sunset;
+    context.scheduleTableValid = 1;
+}
+
+static inline bool isSwitchedOnBySchedule()
+{
+    switch (Settings_data.scheduler.type) {
+        case Settings_SchedulerType_Interval:
+            updateScheduleTable();
+
+            return ScheduleTable_isOn(
+                &context.scheduleTable,
+                Clock_getMinutesSinceMidnight()
+            );
 
         case Settings_SchedulerType_Segment: {
             uint8_t segmentIndex = Types_calculateScheduleSegmentIndex(
@@ -132,92 +153,13 @@ static inline bool isSwitchedOnBySchedule()
     return false;
 }
 
-/*
-    A = switchedOnBySchedule
-    B = runningFromBattery
-    C = outputOverride
-    output: F = A'B'C + AB'C'
-
-    A	B	C	F
-    0	0	0	0
-    0	0	1	1
-    0	1	0	0
-    0	1	1	0
-    1	0	0	1
-    1	0	1	0
-    1	1	0	0
-    1	1	1	0
- */
-static bool calculateOutputState(
-    const bool switchedOnBySchedule,
-    const bool runningFromBattery,
-    const bool outputOverride
-) {
-    return
-        (!switchedOnBySchedule && !runningFromBattery && outputOverride)
-        || (switchedOnBySchedule && !runningFromBattery && !outputOverride);
-}
-
-/*
-    A = switchedOnBySchedule
-    B = prevStateFromSchedule
-    C = outputOverride
-    newOverride: F = A'B'C + ABC
-
-    A	B	C	F
-    0	0	0	0
-    0	0	1	1
-    0	1	0	0
-    0	1	1	0
-    1	0	0	0
-    1	0	1	0
-    1	1	0	0
-    1	1	1	1
- */
-static bool calculateOverrideState(
-    const bool switchedOnBySchedule,
-    const bool prevStateFromSchedule,
-    const bool outputOverride
-) {
-    return
-        (!switchedOnBySchedule && !prevStateFromSchedule && outputOverride)
-        || (switchedOnBySchedule && prevStateFromSchedule && outputOverride);
-}
-
-/*
-    A = output
-    B = prevOutput
-    C = forceUpdate
-    update: F = A'B + AB' + C
-
-    A	B	C	F
-    0	0	0	0
-    0	0	1	1
-    0	1	0	1
-    0	1	1	1
-    1	0	0	1
-    1	0	1	1
-    1	1	0	0
-    1	1	1	1
- */
-static bool calculateOutputUpdateState(
-    const bool outputState,
-    const bool prevOutputState,
-    const bool forceUpdate
-) {
-    return
-        (!outputState && prevOutputState)
-        || (outputState && !prevOutputState)
-        || forceUpdate;
-}
-
 void OutputController_toggle()
 {
 #if DEBUG_ENABLE_PRINT
     puts("OC:toggle");
 #endif
 
-    context.outputOverride = !context.outputOverride;
+    context.state ^= OutputState_Override;
     OutputController_updateState();
 }
 
@@ -232,48 +174,56 @@ OutputController_TaskResult OutputController_task()
         return OutputController_TaskResult_StateUnchanged;
     }
 
-    context.switchedOnBySchedule = isSwitchedOnBySchedule();
+    // The transitions are generated by OutputStateTableGenerator.py
+    uint8_t index = context.state;
 
-    context.outputOverride = calculateOverrideState(
-        context.switchedOnBySchedule,
-        context.prevStateFromSchedule,
-        context.outputOverride
-    );
+    if (isSwitchedOnBySchedule()) {
+        index |= OutputState_InputSchedule;
+    }
 
-    bool outputState = calculateOutputState(
-        context.switchedOnBySchedule,
-        System_isRunningFromBackupBattery(),
-        context.outputOverride
-    );
+    if (System_isRunningFromBackupBattery()) {
+        index |= OutputState_InputBattery;
+    }
 
-    bool updateOutput = calculateOutputUpdateState(
-        outputState,
-        context.prevOutputState,
-        context.forceOutputStateUpdate
-    );
+    if (context.forceOutputStateUpdate) {
+        index |= OutputState_InputForce;
+    }
+
+    uint8_t entry = OutputState_tableEntry(index);
+
+    context.state = entry & OutputState_Mask;
+    context.forceOutputStateUpdate = 0;
+
+    bool outputState = entry & OutputState_Output;
+    bool updateOutput = entry & OutputState_Update;
 
 #if DEBUG_ENABLE
-    _DebugState.oc_switchedOnBySchedule = context.switchedOnBySchedule;
-    _DebugState.oc_prevStateFromSchedule = context.prevStateFromSchedule;
-    _DebugState.oc_outputOverride = context.outputOverride;
+    _DebugState.oc_switchedOnBySchedule = !!(index & OutputState_InputSchedule);
+    _DebugState.oc_prevStateFromSchedule = !!(index & OutputState_Schedule);
+    _DebugState.oc_outputOverride = !!(entry & OutputState_Override);
     _DebugState.oc_outputState = outputState;
-    _DebugState.oc_forceUpdate = context.forceOutputStateUpdate;
+    _DebugState.oc_forceUpdate = !!(index & OutputState_InputForce);
     UI_updateDebugDisplay();
 #endif
 
-    context.prevOutputState = outputState;
-    context.prevStateFromSchedule = context.switchedOnBySchedule;
-    context.forceOutputStateUpdate = 0;
-
     if (updateOutput) {
 #if DEBUG_ENABLE_PRINT
         puts(outputState ? "OC:outputOn" : "OC:outputOff");
 #endif
-        PWM5_LoadDutyValue(
-            outputState
-                ? Settings_data.output.brightness
-                : 0
-        );
+        // The backup battery can't drive the output, it's cut immediately
+        if (outputState) {
+            Fader_setTarget(
+                Settings_data.output.brightness,
+                Settings_data.output.fadeInSeconds
+            );
+        } else {
+            Fader_setTarget(
+                0,
+                index & OutputState_InputBattery
+                    ? 0
+                    : Settings_data.output.fadeOutSeconds
+            );
+        }
 
         return OutputController_TaskResult_OutputStateChanged;
     }
@@ -281,177 +231,105 @@ OutputController_TaskResult OutputController_task()
     return OutputController_TaskResult_StateUnchanged;
 }
 
-/*
-    A = switchedOnBySchedule
-    B = outputOverride
-    outputStateOnExtPwr: F = A'B + AB'
-
-    A	B	F
-    0	0	0
-    0	1	1
-    1	0	1
-    1	1	0
- */
 inline bool OutputController_outputEnableTargetState()
 {
-    return
-        (!context.switchedOnBySchedule && context.outputOverride)
-        || (context.switchedOnBySchedule && !context.outputOverride);
-}
+    // The schedule bit holds the latest schedule state after the task
+    bool schedule = context.state & OutputState_Schedule;
+    bool override = context.state & OutputState_Override;
 
-inline bool OutputController_isOutputEnabled()
-{
-    return context.prevOutputState;
+    return schedule != override;
 }
 
-void OutputController_updateState()
+inline bool OutputController_isOutputEnabled()
 {
-#if DEBUG_ENABLE_PRINT
-    printf("OC:forceUpdate");
-#endif
-
-    context.forceOutputStateUpdate = 1;
+    return context.state & OutputState_Output;
 }
 
-typedef struct {
-    Clock_Time on;
-    Clock_Time off;
-} Schedule;
-
-static Clock_Time calcOffTime(const Schedule s)
+Clock_Time OutputController_getNextScheduleChange(const Clock_Time time)
 {
-    if (s.on <= s.off) {
-        return s.off;
-    } else {
-        return s.off + 1440;
-    }
-}
+    switch (Settings_data.scheduler.type) {
+        case Settings_SchedulerType_Interval: {
+            updateScheduleTable();
 
-bool OutputController_getNextTransition(
-    const Clock_Time time,
-    int8_t* const index,
-    bool* const on
-) {
-    if (!index || !on) {
-        return false;
-    }
+            const ScheduleTable_Transition* next = ScheduleTable_nextTransition(
+                &context.scheduleTable,
+                time
+            );
 
-    Schedule schedules[Config_Settings_IntervalScheduleCount];
+            return next ? next->time : -1;
+        }
 
-    // Gather all the active schedules
-    int8_t scheduleCount = 0;
-    for (int8_t i = 0; i < Config_Settings_IntervalScheduleCount; ++i) {
-        if (Settings_data.scheduler.intervals[i].active) {
-            schedules[scheduleCount].on = OutputController_calculateSwitchTime(
-                &Settings_data.scheduler.intervals[i].onSwitch
+        case Settings_SchedulerType_Segment: {
+            uint8_t segmentIndex = Types_calculateScheduleSegmentIndex(time);
+            bool on = Types_getScheduleSegmentBit(
+                Settings_data.scheduler.segmentData,
+                segmentIndex
             );
 
-            schedules[scheduleCount].off = OutputController_calculateSwitchTime(
-                &Settings_data.scheduler.intervals[i].offSwitch
-            );
+            // Find the next segment with a different state
+            for (uint8_t i = 1; i < 48; ++i) {
+                if (++segmentIndex == 48) {
+                    segmentIndex = 0;
+                }
 
-            ++scheduleCount;
-        }
-    }
+                if (
+                    Types_getScheduleSegmentBit(
+                        Settings_data.scheduler.segmentData,
+                        segmentIndex
+                    ) != on
+                ) {
+                    return (Clock_Time)segmentIndex * 30;
+                }
+            }
 
-    if (scheduleCount == 0) {
-        return false;
-    }
+            return -1;
+        }
 
-    // Calculate the state for the specified time
-    bool currentlyOn = false;
-    for (int8_t i = 0; i < scheduleCount; ++i) {
-        Schedule s = schedules[i];
-        if (
-            (s.on <= s.off && time >= s.on && time < s.off)
-            || (s.off < s.on && (time >= s.on || time < s.off))
-        ) {
-            currentlyOn = true;
+        default:
             break;
-        }
     }
 
-    // Only one schedule, nothing to calculate
-    if (scheduleCount == 1) {
-        *on = !currentlyOn;
-        *index = 0;
-        return true;
-    }
+    return -1;
+}
 
-    // Sort the schedules by ON time using an index array
-    int8_t sortedIndices[Config_Settings_IntervalScheduleCount];
-    for (int8_t i = 0; i < scheduleCount; ++i) {
-        sortedIndices[i] = i;
-    }
-    for (int8_t i = 1; i < scheduleCount; ++i) {
-        int8_t tmp = sortedIndices[i];
-        int8_t j = i - 1;
-        while (j >= 0 && schedules[sortedIndices[j]].on > schedules[tmp].on) {
-            sortedIndices[j + 1] = sortedIndices[j];
-            --j;
-        }
-        sortedIndices[j + 1] = tmp;
-    }
+void OutputController_invalidateSchedule()
+{
+    context.scheduleTableValid = 0;
+}
 
-    typedef struct {
-        int8_t onIdx;
-        int8_t offIdx;
-    } StackElem;
-
-    // Merge overlapping intervals, results will be on the stack
-    StackElem stack[Config_Settings_IntervalScheduleCount];
-    int8_t stackIndex = 0;
-    stack[0].onIdx = sortedIndices[0];
-    stack[0].offIdx = sortedIndices[0];
-    for (int8_t i = 1; i < scheduleCount; ++i) {
-        StackElem top = stack[stackIndex];
-
-        if (calcOffTime(schedules[top.offIdx]) < schedules[sortedIndices[i]].on) {
-            StackElem e = { .onIdx = sortedIndices[i], .offIdx = sortedIndices[i] };
-            stack[++stackIndex] = e;
-        } else if (calcOffTime(schedules[top.offIdx]) < calcOffTime(schedules[sortedIndices[i]])) {
-            top.offIdx = sortedIndices[i];
-            stack[stackIndex] = top;
-        }
-    }
+void OutputController_updateState()
+{
+#if DEBUG_ENABLE_PRINT
+    printf("OC:forceUpdate");
+#endif
 
-    // Find the matching interval
-    Clock_Time lastDiff = 2880;
-    int8_t foundIndex = -1;
-    while (stackIndex >= 0) {
-        StackElem s = stack[stackIndex--];
+    context.forceOutputStateUpdate = 1;
+}
 
-        Clock_Time onTime = schedules[s.onIdx].on;
-        Clock_Time offTime = calcOffTime(schedules[s.offIdx]);
+bool OutputController_getNextTransition(
+    const Clock_Time time,
+    int8_t* const index,
+    bool* const on,
+    Clock_Time* const switchTime
+) {
+    if (!index || !on || !switchTime) {
+        return false;
+    }
 
-        if (offTime - onTime >= 1440) {
-            return false;
-        }
+    updateScheduleTable();
 
-        if (currentlyOn) {
-            // Find the active schedule and store its OFF time
-            if ((time >= onTime && time < offTime) || time + 1440 < offTime) {
-                foundIndex = s.offIdx;
-                break;
-            }
-        } else {
-            // Find the nearest schedule and store its ON time
-            Clock_Time diff;
-            if (onTime < time) {
-                diff = 1440 - time + onTime;
-            } else {
-                diff = onTime - time;
-            }
+    const ScheduleTable_Transition* next = ScheduleTable_nextTransition(
+        &context.scheduleTable,
+        time
+    );
 
-            if (foundIndex < 0 || diff < lastDiff) {
-                foundIndex = s.onIdx;
-                lastDiff = diff;
-            }
-        }
+    if (!next) {
+        return false;
     }
 
-    *index = foundIndex;
-    *on = !currentlyOn;
+    *index = (int8_t)next->index;
+    *on = next->on;
+    *switchTime = next->time;
 
-    return foundIndex >= 0;
-}
\ No newline at end of file
+    return true;
+}
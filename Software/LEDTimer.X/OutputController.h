@@ -51,13 +51,13 @@ OutputController_TaskResult OutputController_task(void);
  * Returns the output state in case there is external power
  * @return True if the output is enabled on external power
  */
-inline bool OutputController_outputEnableTargetState(void);
+Utils_Inline bool OutputController_outputEnableTargetState(void);
 
 /**
  * Returns the actual state of the output
  * @return True of the output actually enabled
  */
-inline bool OutputController_isOutputEnabled(void);
+Utils_Inline bool OutputController_isOutputEnabled(void);
 
 /**
  * Forces turn on or off the output based on the current state. If the output
@@ -66,20 +66,36 @@ inline bool OutputController_isOutputEnabled(void);
 void OutputController_updateState(void);
 
 /**
- * Calculates the next state transition based on the configured schedules
- * and the specified time.
+ * Marks the compiled interval schedule outdated, must be called when
+ * the scheduler settings change.
+ */
+void OutputController_invalidateSchedule(void);
+
+/**
+ * Looks up the next state transition in the compiled interval schedule
+ * after the specified time.
  *
  * @param time Time value in minutes from midnight used for the calculation
  * @param index Output parameter, set to the index of the schedule involved in the next transition
  * @param on Output parameter, set to true for ON transition and false for OFF transition
+ * @param switchTime Output parameter, set to the time of the transition in minutes from midnight
  * @return true If a transition can be calculated, false otherwise
  */
 bool OutputController_getNextTransition(
     Clock_Time time,
     int8_t* index,
-    bool* on
+    bool* on,
+    Clock_Time* switchTime
 );
 
+/**
+ * Finds the next time when the active scheduler can change the output state.
+ *
+ * @param time Time value in minutes from midnight used for the calculation
+ * @return Time of the next change in minutes from midnight or -1 if the scheduler never changes the state
+ */
+Clock_Time OutputController_getNextScheduleChange(Clock_Time time);
+
 /**
  * Calculates switch time from based on the specified switch data.
  *
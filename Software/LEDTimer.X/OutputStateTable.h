@@ -0,0 +1,34 @@
+// Made by OutputStateTableGenerator.py, do not edit.
+
+#pragma once
+
+#include <stdint.h>
+
+// State bits, also the lower bits of the table index
+#define OutputState_Override       (1u << 0) // The output is toggled by the user, against the schedule
+#define OutputState_Output         (1u << 1) // The output is switched on
+#define OutputState_Schedule       (1u << 2) // The output was switched on by the schedule in the previous step
+#define OutputState_Mask           (7u)
+
+// Input bits of the table index
+#define OutputState_InputSchedule  (1u << 3) // The schedule switches the output on
+#define OutputState_InputBattery   (1u << 4) // Running from the backup battery
+#define OutputState_InputForce     (1u << 5) // The output must be updated even if its state is unchanged
+
+// Set in the entry if the output must be updated
+#define OutputState_Update         (1u << 3)
+
+#define OutputState_TableEntryCount (64u)
+
+// Entries packed in nibbles, the even index is in the low nibble
+static const uint8_t OutputState_table[32] = {
+    0xB0, 0x38, 0x00, 0x88, 0xEE, 0x66, 0x5E, 0xD6,
+    0x10, 0x98, 0x00, 0x88, 0x44, 0xCC, 0x54, 0xDC,
+    0xB8, 0xB8, 0x88, 0x88, 0xEE, 0xEE, 0xDE, 0xDE,
+    0x98, 0x98, 0x88, 0x88, 0xCC, 0xCC, 0xDC, 0xDC
+};
+
+#define OutputState_tableEntry(_Index) \
+    ((uint8_t)((_Index) & 1 \
+        ? OutputState_table[(_Index) >> 1] >> 4 \
+        : OutputState_table[(_Index) >> 1] & 0x0F))
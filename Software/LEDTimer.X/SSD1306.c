@@ -35,69 +35,208 @@ enum
 #include <xc.h>
 #include <stdio.h>
 
-#define SSD1306_SCREEN_BUFFER_SIZE (SSD1306_LCDHEIGHT * SSD1306_LCDWIDTH / 8)
+/*
+ * Transmit queue
+ *
+ * Drawing functions put their I2C transfers into a ring buffer and return
+ * as soon as the bytes are queued. The MSSP interrupt drains the queue one
+ * I2C event (start, byte, stop) at a time.
+ *
+ * Each transfer is stored as [control byte][payload length][payload...].
+ */
+#ifndef SSD1306_QUEUE_SIZE
+#define SSD1306_QUEUE_SIZE 64u
+#endif
+
+#if (SSD1306_QUEUE_SIZE & (SSD1306_QUEUE_SIZE - 1u)) != 0 || SSD1306_QUEUE_SIZE > 128u
+#error "SSD1306_QUEUE_SIZE must be a power of 2, not larger than 128"
+#endif
+
+#define SSD1306_QUEUE_MASK ((uint8_t)(SSD1306_QUEUE_SIZE - 1u))
+
+typedef enum
+{
+    SSD1306_QueueState_Idle,
+    SSD1306_QueueState_Start,
+    SSD1306_QueueState_Address,
+    SSD1306_QueueState_Payload,
+    SSD1306_QueueState_Stop
+} SSD1306_QueueState;
+
+static struct SSD1306_Queue
+{
+    uint8_t data[SSD1306_QUEUE_SIZE];
+    volatile uint8_t head;
+    volatile uint8_t tail;
+    volatile uint8_t remaining;
+    volatile SSD1306_QueueState state;
+    volatile bool stalled;
+} queue = {
+    .head = 0,
+    .tail = 0,
+    .remaining = 0,
+    .state = SSD1306_QueueState_Idle,
+    .stalled = false
+};
+
+static struct SSD1306_Stream
+{
+    uint8_t remaining;
+    uint8_t flags;
+} stream = {
+    .remaining = 0,
+    .flags = 0
+};
 
 static bool SSD1306_displayOn = false;
+static bool SSD1306_pageAddressingEnabled = false;
 
-static inline void i2cWait()
+static inline uint8_t queueFreeSpace()
 {
-    while (
-        SSP1STATbits.R_nW
-        || (SSP1CON2 & 0b11111) // ACKEN | RCEN | PEN | RSEN | SEN
-    );
+    return (uint8_t)(queue.tail - queue.head - 1u) & SSD1306_QUEUE_MASK;
+}
+
+static inline uint8_t queuePop()
+{
+    uint8_t byte = queue.data[queue.tail];
+    queue.tail = (queue.tail + 1u) & SSD1306_QUEUE_MASK;
+    return byte;
+}
+
+static inline void queueWaitForSpace(const uint8_t count)
+{
+    while (queueFreeSpace() < count) {
+        NOP();
+    }
+}
+
+static inline void queueKick()
+{
+    // The interrupt handler starts a new transfer when the bus is idle and
+    // continues a transfer which ran out of payload bytes
+    if (queue.state == SSD1306_QueueState_Idle || queue.stalled) {
+        queue.stalled = false;
+        PIR1bits.SSP1IF = 1;
+    }
+}
+
+static void i2cStart(const uint8_t control, const uint8_t length)
+{
+    queueWaitForSpace(2);
+
+    // Publish the header in one step so the interrupt handler never sees
+    // a control byte without the length
+    uint8_t head = queue.head;
+    queue.data[head] = control;
+    head = (head + 1u) & SSD1306_QUEUE_MASK;
+    queue.data[head] = length;
+    queue.head = (head + 1u) & SSD1306_QUEUE_MASK;
+
+    queueKick();
+}
+
+static void i2cWrite(const uint8_t byte)
+{
+    queueWaitForSpace(1);
+
+    queue.data[queue.head] = byte;
+    queue.head = (queue.head + 1u) & SSD1306_QUEUE_MASK;
+
+    queueKick();
 }
 
-static void i2cStart(const uint8_t command)
+void SSD1306_handleInterrupt()
 {
-    // Start
-	i2cWait();
-	SSP1CON2bits.SEN = 1;
+    switch (queue.state) {
+        case SSD1306_QueueState_Idle:
+        case SSD1306_QueueState_Stop:
+            if (queue.head != queue.tail) {
+                SSP1CON2bits.SEN = 1;
+                queue.state = SSD1306_QueueState_Start;
+            } else {
+                queue.state = SSD1306_QueueState_Idle;
+            }
+            break;
 
-	// Send address
-	i2cWait();
-	SSP1BUF = SSD1306_I2C_ADDRESS << 1;
+        case SSD1306_QueueState_Start:
+            SSP1BUF = SSD1306_I2C_ADDRESS << 1;
+            queue.state = SSD1306_QueueState_Address;
+            break;
 
-    // Send command / DC flag
-    i2cWait();
-    SSP1BUF = command;
+        case SSD1306_QueueState_Address:
+            // Control byte
+            SSP1BUF = queuePop();
+            queue.remaining = queuePop();
+            queue.state = SSD1306_QueueState_Payload;
+            break;
+
+        case SSD1306_QueueState_Payload:
+            if (queue.remaining == 0) {
+                SSP1CON2bits.PEN = 1;
+                queue.state = SSD1306_QueueState_Stop;
+            } else if (queue.head == queue.tail) {
+                // Wait for the producer to queue the rest of the payload
+                queue.stalled = true;
+            } else {
+                SSP1BUF = queuePop();
+                --queue.remaining;
+            }
+            break;
+    }
+}
+
+bool SSD1306_isBusy()
+{
+    return queue.state != SSD1306_QueueState_Idle
+        || queue.head != queue.tail;
 }
 
-static void i2cStop()
+void SSD1306_flush()
 {
-    // Stop
-	i2cWait();
-	SSP1CON2bits.PEN = 1;
+    while (SSD1306_isBusy()) {
+        NOP();
+    }
 }
 
 void SSD1306_init()
 {
-    SSD1306_sendCommand(SSD1306_CMD_DISPLAYOFF);
+    static const uint8_t InitCommands[] = {
+        SSD1306_CMD_DISPLAYOFF,
 
-    SSD1306_sendCommand(SSD1306_CMD_SETMULTIPLEX);
-    SSD1306_sendCommand(SSD1306_LCDHEIGHT - 1);
+        SSD1306_CMD_SETMULTIPLEX,
+        SSD1306_LCDHEIGHT - 1,
 
-#if SSD1309
-    SSD1306_setPreChargePeriod(4, 10);
-#else
-    SSD1306_sendCommand(SSD1306_CMD_CHARGEPUMP);
-    SSD1306_sendCommand(0x14);
+#if !SSD1309
+        SSD1306_CMD_CHARGEPUMP,
+        0x14,
 
-    SSD1306_sendCommand(SSD1306_CMD_SETVCOMDESELECT);
-    SSD1306_sendCommand(0x10);
+        SSD1306_CMD_SETVCOMDESELECT,
+        0x10,
 #endif
 
-    SSD1306_sendCommand(SSD1306_CMD_SEGREMAP | 0x1);
-    SSD1306_sendCommand(SSD1306_CMD_COMSCANDEC);
+        SSD1306_CMD_SEGREMAP | 0x1,
+        SSD1306_CMD_COMSCANDEC,
 
-    SSD1306_sendCommand(SSD1306_CMD_SETCOMPINS);
-    SSD1306_sendCommand(0x12);
+        SSD1306_CMD_SETCOMPINS,
+        0x12
+    };
+
+    static const uint8_t StartCommands[] = {
+        SSD1306_CMD_DISPLAYALLON_RESUME,
+        SSD1306_CMD_NORMALDISPLAY,
+        SSD1306_CMD_DEACTIVATE_SCROLL,
+        SSD1306_CMD_DISPLAYON
+    };
+
+    SSD1306_sendCommands(InitCommands, sizeof(InitCommands));
+
+#if SSD1309
+    SSD1306_setPreChargePeriod(4, 10);
+#endif
 
     SSD1306_setContrastLevel(SSD1306_CONTRAST_LOWEST);
 
-    SSD1306_sendCommand(SSD1306_CMD_DISPLAYALLON_RESUME);
-    SSD1306_sendCommand(SSD1306_CMD_NORMALDISPLAY);
-    SSD1306_sendCommand(SSD1306_CMD_DEACTIVATE_SCROLL);
-    SSD1306_sendCommand(SSD1306_CMD_DISPLAYON);
+    SSD1306_sendCommands(StartCommands, sizeof(StartCommands));
 
     SSD1306_clear();
 
@@ -125,65 +264,61 @@ void SSD1306_scroll(
     const uint8_t stop
 )
 {
+    uint8_t commands[10];
+    uint8_t length = 0;
+
     switch (scroll) {
         case SSD1306_SCROLL_STOP:
             SSD1306_sendCommand(SSD1306_CMD_DEACTIVATE_SCROLL);
             return;
 
         case SSD1306_SCROLL_LEFT:
-            SSD1306_sendCommand(SSD1306_CMD_LEFT_HORIZONTAL_SCROLL);
-            SSD1306_sendCommand(0);
-            SSD1306_sendCommand(start);
-            SSD1306_sendCommand(0);
-            SSD1306_sendCommand(stop);
-            SSD1306_sendCommand(0);
-            SSD1306_sendCommand(0xFF);
-            SSD1306_sendCommand(SSD1306_CMD_ACTIVATE_SCROLL);
-            break;
-
         case SSD1306_SCROLL_RIGHT:
-            SSD1306_sendCommand(SSD1306_CMD_RIGHT_HORIZONTAL_SCROLL);
-            SSD1306_sendCommand(0);
-            SSD1306_sendCommand(start);
-            SSD1306_sendCommand(0);
-            SSD1306_sendCommand(stop);
-            SSD1306_sendCommand(0);
-            SSD1306_sendCommand(0xFF);
-            SSD1306_sendCommand(SSD1306_CMD_ACTIVATE_SCROLL);
+            commands[length++] =
+                scroll == SSD1306_SCROLL_LEFT
+                    ? SSD1306_CMD_LEFT_HORIZONTAL_SCROLL
+                    : SSD1306_CMD_RIGHT_HORIZONTAL_SCROLL;
+            commands[length++] = 0;
+            commands[length++] = start;
+            commands[length++] = 0;
+            commands[length++] = stop;
+            commands[length++] = 0;
+            commands[length++] = 0xFF;
             break;
 
         case SSD1306_SCROLL_DIAG_LEFT:
-            SSD1306_sendCommand(SSD1306_CMD_SET_VERTICAL_SCROLL_AREA);
-            SSD1306_sendCommand(0);
-            SSD1306_sendCommand(SSD1306_LCDHEIGHT);
-            SSD1306_sendCommand(SSD1306_CMD_VERTICAL_AND_LEFT_HORIZONTAL_SCROLL);
-            SSD1306_sendCommand(0);
-            SSD1306_sendCommand(start);
-            SSD1306_sendCommand(0);
-            SSD1306_sendCommand(stop);
-            SSD1306_sendCommand(1);
-            SSD1306_sendCommand(SSD1306_CMD_ACTIVATE_SCROLL);
-            break;
-
         case SSD1306_SCROLL_DIAG_RIGHT:
-            SSD1306_sendCommand(SSD1306_CMD_SET_VERTICAL_SCROLL_AREA);
-            SSD1306_sendCommand(0);
-            SSD1306_sendCommand(SSD1306_LCDHEIGHT);
-            SSD1306_sendCommand(SSD1306_CMD_VERTICAL_AND_RIGHT_HORIZONTAL_SCROLL);
-            SSD1306_sendCommand(0);
-            SSD1306_sendCommand(start);
-            SSD1306_sendCommand(0);
-            SSD1306_sendCommand(stop);
-            SSD1306_sendCommand(1);
-            SSD1306_sendCommand(SSD1306_CMD_ACTIVATE_SCROLL);
+            commands[length++] = SSD1306_CMD_SET_VERTICAL_SCROLL_AREA;
+            commands[length++] = 0;
+            commands[length++] = SSD1306_LCDHEIGHT;
+            commands[length++] =
+                scroll == SSD1306_SCROLL_DIAG_LEFT
+                    ? SSD1306_CMD_VERTICAL_AND_LEFT_HORIZONTAL_SCROLL
+                    : SSD1306_CMD_VERTICAL_AND_RIGHT_HORIZONTAL_SCROLL;
+            commands[length++] = 0;
+            commands[length++] = start;
+            commands[length++] = 0;
+            commands[length++] = stop;
+            commands[length++] = 1;
             break;
+
+        default:
+            return;
     }
+
+    commands[length++] = SSD1306_CMD_ACTIVATE_SCROLL;
+
+    SSD1306_sendCommands(commands, length);
 }
 
 void SSD1306_setContrast(const uint8_t contrast)
 {
-    SSD1306_sendCommand(SSD1306_CMD_SETCONTRAST);
-    SSD1306_sendCommand(contrast);
+    const uint8_t commands[] = {
+        SSD1306_CMD_SETCONTRAST,
+        contrast
+    };
+
+    SSD1306_sendCommands(commands, sizeof(commands));
 }
 
 void SSD1306_setContrastLevel(const SSD1306_ContrastLevel level)
@@ -214,34 +349,29 @@ void SSD1306_setContrastLevel(const SSD1306_ContrastLevel level)
 
 void SSD1306_clear()
 {
-    SSD1306_sendCommand(SSD1306_CMD_MEMORYMODE);
-    SSD1306_sendCommand(SSD1306_MEM_MODE_HORIZONTAL_ADDRESSING);
-
-    SSD1306_sendCommand(SSD1306_CMD_COLUMNADDR);
-    SSD1306_sendCommand(0); // Column start address (0 = reset)
-    SSD1306_sendCommand(SSD1306_LCDWIDTH - 1); // Column end address (127 = reset)
-
-    SSD1306_sendCommand(SSD1306_CMD_PAGEADDR);
-    SSD1306_sendCommand(0); // Page start address (0 = reset)
-
-    // Page end address
-#ifdef SSD1306_128_64
-    SSD1306_sendCommand(7);
-#elif defined SSD1306_128_32
-    SSD1306_sendCommand(3);
-#elif defined SSD1306_96_16
-    SSD1306_sendCommand(1);
-#endif
-
-    i2cStart(SSD1306_I2C_DC_FLAG);
-
-    for (uint16_t i = SSD1306_SCREEN_BUFFER_SIZE; i > 0; --i) {
-        i2cWait();
-        SSP1BUF = 0;
+    static const uint8_t Commands[] = {
+        SSD1306_CMD_MEMORYMODE,
+        SSD1306_MEM_MODE_HORIZONTAL_ADDRESSING,
+
+        SSD1306_CMD_COLUMNADDR,
+        0,                      // Column start address (0 = reset)
+        SSD1306_LCDWIDTH - 1,   // Column end address (127 = reset)
+
+        SSD1306_CMD_PAGEADDR,
+        0,                      // Page start address (0 = reset)
+        SSD1306_PAGE_COUNT - 1  // Page end address
+    };
+
+    SSD1306_sendCommands(Commands, sizeof(Commands));
+    SSD1306_pageAddressingEnabled = false;
+
+    // The length of a queued transfer is 8 bits, send the GDDRAM content
+    // page by page
+    for (uint8_t page = SSD1306_PAGE_COUNT; page > 0; --page) {
+        SSD1306_beginData(SSD1306_LCDWIDTH, 0);
+        SSD1306_streamFill(0, SSD1306_LCDWIDTH);
     }
 
-    i2cStop();
-
 #ifdef SSD1306_DEBUG
     printf("SSD1306_update: finished\r\n");
 #endif
@@ -249,46 +379,48 @@ void SSD1306_clear()
 
 void SSD1306_sendCommand(const SSD1306_Command cmd)
 {
-    i2cStart(SSD1306_I2C_CO_FLAG);
-
-    i2cWait();
-    SSP1BUF = cmd;
-
-    i2cStop();
+    i2cStart(SSD1306_I2C_CO_FLAG, 1);
+    i2cWrite(cmd);
 
 #ifdef SSD1306_DEBUG
     printf("SSD1306_sendCommand: %02x. I2C status: %d\r\n", cmd, status);
 #endif
 }
 
-static void sendCommand2(
-    const SSD1306_Command cmd,
-    const uint8_t arg1,
-    const uint8_t arg2
+void SSD1306_sendCommands(
+    const uint8_t* commands,
+    uint8_t length
 )
 {
-    i2cStart(SSD1306_I2C_CO_FLAG);
-
-    i2cWait();
-    SSP1BUF = cmd;
-
-    i2cWait();
-    SSP1BUF = arg1;
-
-    i2cWait();
-    SSP1BUF = arg2;
+    // With the Co bit cleared in the control byte, every following byte
+    // is interpreted as a command until the end of the transaction
+    i2cStart(SSD1306_I2C_CO_FLAG, length);
 
-    i2cStop();
+    while (length-- > 0) {
+        i2cWrite(*commands++);
+    }
 }
 
 void SSD1306_setColumnAddress(const uint8_t start, const uint8_t end)
 {
-    sendCommand2(SSD1306_CMD_COLUMNADDR, start & 0x7F, end & 0x7F);
+    const uint8_t commands[] = {
+        SSD1306_CMD_COLUMNADDR,
+        start & 0x7F,
+        end & 0x7F
+    };
+
+    SSD1306_sendCommands(commands, sizeof(commands));
 }
 
 void SSD1306_setPageAddress(const uint8_t start, const uint8_t end)
 {
-    sendCommand2(SSD1306_CMD_PAGEADDR, start & 0b111, end & 0b111);
+    const uint8_t commands[] = {
+        SSD1306_CMD_PAGEADDR,
+        start & 0b111,
+        end & 0b111
+    };
+
+    SSD1306_sendCommands(commands, sizeof(commands));
 }
 
 void SSD1306_setPage(const uint8_t page)
@@ -298,10 +430,34 @@ void SSD1306_setPage(const uint8_t page)
 
 void SSD1306_setStartColumn(const uint8_t address)
 {
-    // Set lower nibble
-    SSD1306_sendCommand(SSD1306_CMD_SETLOWCOLUMN | (address & 0xF));
-    // Set upper nibble
-    SSD1306_sendCommand(SSD1306_CMD_SETHIGHCOLUMN | ((address >> 4) & 0x7));
+    const uint8_t commands[] = {
+        // Lower nibble
+        SSD1306_CMD_SETLOWCOLUMN | (address & 0xF),
+        // Upper nibble
+        SSD1306_CMD_SETHIGHCOLUMN | ((address >> 4) & 0x7)
+    };
+
+    SSD1306_sendCommands(commands, sizeof(commands));
+}
+
+void SSD1306_setPosition(const uint8_t page, const uint8_t column)
+{
+    uint8_t commands[5];
+    uint8_t length = 0;
+
+    // Memory addressing mode is only changed by SSD1306_clear(),
+    // skip it if the display is already in page addressing mode
+    if (!SSD1306_pageAddressingEnabled) {
+        commands[length++] = SSD1306_CMD_MEMORYMODE;
+        commands[length++] = SSD1306_MEM_MODE_PAGE_ADDRESSING;
+        SSD1306_pageAddressingEnabled = true;
+    }
+
+    commands[length++] = SSD1306_CMD_PAGESTARTADDR | (page & 0b111);
+    commands[length++] = SSD1306_CMD_SETLOWCOLUMN | (column & 0xF);
+    commands[length++] = SSD1306_CMD_SETHIGHCOLUMN | ((column >> 4) & 0x7);
+
+    SSD1306_sendCommands(commands, length);
 }
 
 void SSD1306_sendData(
@@ -314,59 +470,106 @@ void SSD1306_sendData(
 
 void SSD1306_sendData2(
     const uint8_t* const data,
-    uint8_t length,
+    const uint8_t length,
     const uint8_t flags
 )
 {
+    SSD1306_beginData(length, flags);
+    SSD1306_streamData(data, length);
+}
+
+static uint8_t transformByte(uint8_t byte, const uint8_t flags)
+{
+    if (flags & SSD1306_SEND_FLIPX) {
+        uint8_t reverse = 0;
+        for (uint8_t i = 8; i > 0; --i) {
+            reverse |= byte & 1;
+            byte >>= 1;
+            if (i > 1) {
+                reverse <<= 1;
+            }
+        }
+        byte = reverse;
+    }
+
     uint8_t bitShift = (flags >> 3) & 0b111;
-    uint8_t dataIndex = (flags & SSD1306_SEND_FLIPY) ? length - 1 : 0;
 
-    i2cStart(SSD1306_I2C_DC_FLAG);
+    if (bitShift) {
+        if (flags & SSD1306_SEND_BITSHIFT_REVERSE) {
+            byte >>= bitShift;
+        } else {
+            byte <<= bitShift;
+        }
+    }
+
+    if (flags & SSD1306_SEND_INVERT) {
+        byte = ~byte;
+    }
+
+    return byte;
+}
+
+void SSD1306_beginData(const uint8_t length, const uint8_t flags)
+{
+    i2cStart(SSD1306_I2C_DC_FLAG, length);
+
+    stream.remaining = length;
+    stream.flags = flags;
+}
+
+void SSD1306_streamData(const uint8_t* const data, uint8_t length)
+{
+    uint8_t dataIndex = (stream.flags & SSD1306_SEND_FLIPY) ? length - 1 : 0;
+
+    if (length > stream.remaining) {
+        length = stream.remaining;
+    }
+
+    stream.remaining -= length;
 
     while (length-- > 0) {
         uint8_t byte = data[dataIndex];
 
-        if (flags & SSD1306_SEND_FLIPY) {
+        if (stream.flags & SSD1306_SEND_FLIPY) {
             --dataIndex;
         } else {
             ++dataIndex;
         }
 
-        if (flags & SSD1306_SEND_FLIPX) {
-            uint8_t reverse = 0;
-            for (uint8_t i = 8; i > 0; --i) {
-                reverse |= byte & 1;
-                byte >>= 1;
-                if (i > 1) {
-                    reverse <<= 1;
-                }
-            }
-            byte = reverse;
-        }
+        i2cWrite(transformByte(byte, stream.flags));
+    }
+}
 
-        if (bitShift) {
-            if (flags & SSD1306_SEND_BITSHIFT_REVERSE) {
-                byte >>= bitShift;
-            } else {
-                byte <<= bitShift;
-            }
-        }
+void SSD1306_streamFill(const uint8_t pattern, uint8_t count)
+{
+    const uint8_t byte = transformByte(pattern, stream.flags);
 
-        if (flags & SSD1306_SEND_INVERT) {
-            byte = ~byte;
-        }
+    if (count > stream.remaining) {
+        count = stream.remaining;
+    }
+
+    stream.remaining -= count;
 
-        i2cWait();
-        SSP1BUF = byte;
+    while (count-- > 0) {
+        i2cWrite(byte);
     }
+}
 
-    i2cStop();
+void SSD1306_endData()
+{
+    // The queued transfer has a fixed length, pad it with the background
+    SSD1306_streamFill(0, stream.remaining);
 }
 
 void SSD1306_enablePageAddressing()
 {
-    SSD1306_sendCommand(SSD1306_CMD_MEMORYMODE);
-    SSD1306_sendCommand(SSD1306_MEM_MODE_PAGE_ADDRESSING);
+    static const uint8_t Commands[] = {
+        SSD1306_CMD_MEMORYMODE,
+        SSD1306_MEM_MODE_PAGE_ADDRESSING
+    };
+
+    SSD1306_sendCommands(Commands, sizeof(Commands));
+    SSD1306_pageAddressingEnabled = true;
 }
 
 void SSD1306_fillArea(
@@ -387,24 +590,20 @@ void SSD1306_fillAreaPattern(
     const uint8_t pages,
     const uint8_t pattern
 ) {
-    SSD1306_enablePageAddressing();
+    // Areas running off the screen are not drawn
+    if (x + width > SSD1306_LCDWIDTH) {
+        return;
+    }
 
     for (uint8_t i = pages, page = startPage; i > 0; --i, ++page) {
         if (page >= 8) {
             return;
         }
 
-        SSD1306_setPage(page);
-        SSD1306_setStartColumn(x);
+        SSD1306_setPosition(page, x);
 
-        i2cStart(SSD1306_I2C_DC_FLAG);
-
-        for (uint8_t j = width; j > 0 && x + j <= SSD1306_LCDWIDTH; --j) {
-            i2cWait();
-            SSP1BUF = pattern;
-        }
-
-        i2cStop();
+        SSD1306_beginData(width, 0);
+        SSD1306_streamFill(pattern, width);
     }
 }
 
@@ -426,6 +625,10 @@ bool SSD1306_isDisplayEnabled()
 
 void SSD1306_setPreChargePeriod(const uint8_t phase1, const uint8_t phase2)
 {
-    SSD1306_sendCommand(0xD9);
-    SSD1306_sendCommand(((phase2 & 0b1111u) << 4) | (phase1 & 0b1111u));
+    const uint8_t commands[] = {
+        SSD1306_CMD_SETPRECHARGE,
+        ((phase2 & 0b1111u) << 4) | (phase1 & 0b1111u)
+    };
+
+    SSD1306_sendCommands(commands, sizeof(commands));
 }
\ No newline at end of file
@@ -23,6 +23,10 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 #if !defined SSD1306_128_64 && !defined SSD1306_128_32 && !defined SSD1306_96_16
 #define SSD1306_128_64
 #endif
@@ -126,7 +130,39 @@ void SSD1306_fillArea(uint8_t x, uint8_t startPage, uint8_t width, uint8_t pages
 void SSD1306_fillAreaPattern(uint8_t x, uint8_t startPage, uint8_t width, uint8_t pages, uint8_t pattern);
 
 // Low level API
+
+/**
+ * Drives the queued I2C transfers. Must be called from the ISR when
+ * the MSSP1 interrupt flag is set (after clearing the flag).
+ */
+void SSD1306_handleInterrupt(void);
+
+/**
+ * Checks if there are queued transfers not yet sent to the display.
+ * @return True if the I2C transmit queue is not empty or a transfer is
+ * in progress
+ */
+bool SSD1306_isBusy(void);
+
+/**
+ * Waits until all the queued transfers are sent to the display.
+ * Must be called before entering Sleep mode as the MSSP stops in Sleep.
+ */
+void SSD1306_flush(void);
+
 void SSD1306_sendCommand(SSD1306_Command cmd);
+
+/**
+ * Sends a sequence of commands (with their arguments) in a single
+ * I2C transaction.
+ * @param commands Command and argument bytes
+ * @param length Number of bytes to send
+ */
+void SSD1306_sendCommands(
+    const uint8_t* commands,
+    uint8_t length
+);
+
 void SSD1306_sendData(
     const uint8_t* data,
     uint8_t length
@@ -138,6 +174,37 @@ void SSD1306_sendData2(
     uint8_t flags
 );
 
+/**
+ * Starts a data transfer. The bytes of the transfer can be sent in parts
+ * using SSD1306_streamData() and SSD1306_streamFill(), which makes it
+ * possible to draw multiple items with a single I2C transaction.
+ * @param length Total number of bytes in the transfer, bytes streamed
+ * after the length is reached are dropped
+ * @param flags Transformations applied to the streamed bytes,
+ * see SSD1306_SEND_*. SSD1306_SEND_FLIPY applies to each part separately.
+ */
+void SSD1306_beginData(uint8_t length, uint8_t flags);
+
+/**
+ * Sends the next part of the current data transfer.
+ * @param data Data bytes
+ * @param length Number of bytes to send
+ */
+void SSD1306_streamData(const uint8_t* data, uint8_t length);
+
+/**
+ * Sends the same byte multiple times in the current data transfer.
+ * @param pattern Data byte (transformed like the streamed data)
+ * @param count Number of bytes to send
+ */
+void SSD1306_streamFill(uint8_t pattern, uint8_t count);
+
+/**
+ * Completes the current data transfer by filling the remaining bytes
+ * with the background.
+ */
+void SSD1306_endData(void);
+
 void SSD1306_enablePageAddressing(void);
 
 void SSD1306_setColumnAddress(uint8_t start, uint8_t end);
@@ -146,6 +213,14 @@ void SSD1306_setPageAddress(uint8_t start, uint8_t end);
 void SSD1306_setPage(uint8_t page);
 void SSD1306_setStartColumn(uint8_t address);
 
+/**
+ * Switches to page addressing mode (if necessary) and sets the page and
+ * the start column in a single I2C transaction.
+ * @param page Page address (0..7)
+ * @param column Start column address (0..127)
+ */
+void SSD1306_setPosition(uint8_t page, uint8_t column);
+
 void SSD1306_setDisplayEnabled(bool enabled);
 bool SSD1306_isDisplayEnabled(void);
 
@@ -156,4 +231,8 @@ bool SSD1306_isDisplayEnabled(void);
  * @param phase1 Phase-1 period, max 15 DCLK
  * @param phase2 Phase-2 period, max 15 DCLK
  */
-void SSD1306_setPreChargePeriod(uint8_t phase1, uint8_t phase2);
\ No newline at end of file
+void SSD1306_setPreChargePeriod(uint8_t phase1, uint8_t phase2);
+
+#ifdef __cplusplus
+}
+#endif
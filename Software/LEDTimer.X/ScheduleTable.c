@@ -0,0 +1,230 @@
+/*
+    This file is part of LEDTimer.
+
+    LEDTimer is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LEDTimer is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LEDTimer.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-17
+*/
+
+#include "ScheduleTable.h"
+
+#include <stddef.h>
+
+// Larger than any interval index
+#define NoIndex 0x7F
+
+/*
+ * Restores the max-heap order of the switch times from the root, iteratively
+ * to keep the stack usage fixed
+ */
+static void siftDown(
+    ScheduleTable_Transition* const heap,
+    uint8_t root,
+    const uint8_t count
+)
+{
+    ScheduleTable_Transition item = heap[root];
+
+    while (true) {
+        uint8_t child = (uint8_t)(2 * root + 1);
+
+        if (child >= count) {
+            break;
+        }
+
+        if (child + 1 < count && heap[child + 1].time > heap[child].time) {
+            ++child;
+        }
+
+        if (heap[child].time <= item.time) {
+            break;
+        }
+
+        heap[root] = heap[child];
+        root = child;
+    }
+
+    heap[root] = item;
+}
+
+// Heapsort by the switch times
+static void sortSwitches(ScheduleTable_Transition* const switches, const uint8_t count)
+{
+    for (uint8_t i = count >> 1; i > 0; --i) {
+        siftDown(switches, i - 1, count);
+    }
+
+    for (uint8_t i = count; i > 1; --i) {
+        ScheduleTable_Transition last = switches[i - 1];
+        switches[i - 1] = switches[0];
+        switches[0] = last;
+
+        siftDown(switches, 0, i - 1);
+    }
+}
+
+/*
+ * Returns the index of the first transition after the specified time
+ * (or the count of the transitions if there is none before midnight)
+ */
+static uint8_t upperBound(const ScheduleTable* table, const Clock_Time time)
+{
+    uint8_t low = 0;
+    uint8_t high = table->count;
+
+    while (low < high) {
+        uint8_t mid = (low + high) >> 1;
+
+        if (table->transitions[mid].time <= time) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+
+    return low;
+}
+
+void ScheduleTable_begin(ScheduleTable* const table)
+{
+    // The switches are collected in the transitions until the table is finished
+    table->count = 0;
+    table->covering = 0;
+}
+
+void ScheduleTable_addInterval(
+    ScheduleTable* const table,
+    const uint8_t index,
+    const Clock_Time on,
+    const Clock_Time off
+)
+{
+    if (on == off) {
+        return;
+    }
+
+    if (on > off) {
+        ++table->covering;
+    }
+
+    ScheduleTable_Transition* sw = &table->transitions[table->count];
+
+    sw->time = on;
+    sw->on = 1;
+    sw->index = index;
+    ++sw;
+
+    sw->time = off;
+    sw->on = 0;
+    sw->index = index;
+
+    table->count += 2;
+}
+
+/*
+ * The switches of the active intervals are sorted in the table, then swept
+ * with the number of the intervals covering the current minute. The state
+ * changes where this number changes between zero and non-zero, the first
+ * interval wins if more intervals switch at the same time. The transitions
+ * are compacted into the front of the same array.
+ */
+void ScheduleTable_finish(ScheduleTable* const table)
+{
+    ScheduleTable_Transition* const switches = table->transitions;
+    const uint8_t switchCount = table->count;
+    // Intervals covering the last minute of the previous day
+    uint8_t covering = table->covering;
+
+    sortSwitches(switches, switchCount);
+
+    table->count = 0;
+
+    for (uint8_t i = 0; i < switchCount;) {
+        const Clock_Time time = switches[i].time;
+        const bool wasOn = covering > 0;
+        uint8_t onIndex = NoIndex;
+        uint8_t offIndex = NoIndex;
+
+        for (; i < switchCount && switches[i].time == time; ++i) {
+            if (switches[i].on) {
+                ++covering;
+                if (switches[i].index < onIndex) {
+                    onIndex = switches[i].index;
+                }
+            } else {
+                --covering;
+                if (switches[i].index < offIndex) {
+                    offIndex = switches[i].index;
+                }
+            }
+        }
+
+        if ((covering > 0) == wasOn) {
+            continue;
+        }
+
+        // Stays behind the switches still to be read
+        ScheduleTable_Transition* transition = &table->transitions[table->count++];
+        transition->time = time;
+        transition->on = !wasOn;
+        transition->index = wasOn ? offIndex : onIndex;
+    }
+
+    // Without transitions the state is the same for the whole day
+    table->alwaysOn = table->count == 0 && covering > 0;
+}
+
+void ScheduleTable_build(
+    ScheduleTable* const table,
+    const ScheduleTable_Interval* const intervals,
+    const uint8_t count
+)
+{
+    ScheduleTable_begin(table);
+
+    for (uint8_t i = 0; i < count; ++i) {
+        if (intervals[i].active) {
+            ScheduleTable_addInterval(table, i, intervals[i].on, intervals[i].off);
+        }
+    }
+
+    ScheduleTable_finish(table);
+}
+
+bool ScheduleTable_isOn(const ScheduleTable* table, const Clock_Time time)
+{
+    if (table->count == 0) {
+        return table->alwaysOn;
+    }
+
+    uint8_t i = upperBound(table, time);
+
+    // Before the first transition the last one of the previous day applies
+    return table->transitions[i > 0 ? i - 1 : table->count - 1].on;
+}
+
+const ScheduleTable_Transition* ScheduleTable_nextTransition(
+    const ScheduleTable* table,
+    const Clock_Time time
+)
+{
+    if (table->count == 0) {
+        return NULL;
+    }
+
+    uint8_t i = upperBound(table, time);
+
+    return &table->transitions[i < table->count ? i : 0];
+}
@@ -0,0 +1,130 @@
+/*
+    This file is part of LEDTimer.
+
+    LEDTimer is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LEDTimer is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LEDTimer.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-17
+*/
+
+#pragma once
+
+#include "Clock.h"
+#include "Config.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Compiled daily schedule of the interval scheduler
+ *
+ * The active intervals are compiled into the sorted list of the minutes
+ * where the output state actually changes. Overlapping intervals are merged,
+ * intervals crossing midnight are wrapped, so the state at any time of the
+ * day is given by the last transition before it (or the last transition of
+ * the day, wrapping around) and the next transition is the following entry.
+ * Building the table takes O(n log n) time, the lookups take O(log n).
+ */
+
+#ifndef ScheduleTable_MaxTransitions
+#define ScheduleTable_MaxTransitions (2 * Config_Settings_IntervalScheduleCount)
+#endif
+
+typedef struct
+{
+    Clock_Time on;
+    Clock_Time off;
+    bool active;
+} ScheduleTable_Interval;
+
+typedef struct
+{
+    Clock_Time time;
+    uint8_t on : 1;
+    uint8_t index : 7;  // Index of the interval with the switch of the transition
+} ScheduleTable_Transition;
+
+typedef struct
+{
+    ScheduleTable_Transition transitions[ScheduleTable_MaxTransitions];
+    uint8_t count;
+    uint8_t covering;   // Intervals covering midnight
+    bool alwaysOn;      // Valid if there are no transitions
+} ScheduleTable;
+
+/**
+ * Starts building the table, the intervals are added one by one so the
+ * caller doesn't need a copy of all of them.
+ * @param table Table to be built
+ */
+void ScheduleTable_begin(ScheduleTable* table);
+
+/**
+ * Adds the switches of an active interval to the table being built.
+ * @param table Table being built
+ * @param index Index of the interval (max. ScheduleTable_MaxTransitions / 2 - 1)
+ * @param on Switch on time in minutes from midnight
+ * @param off Switch off time in minutes from midnight
+ */
+void ScheduleTable_addInterval(
+    ScheduleTable* table,
+    uint8_t index,
+    Clock_Time on,
+    Clock_Time off
+);
+
+/**
+ * Compiles the added switches into the transitions of the table.
+ * @param table Table being built
+ */
+void ScheduleTable_finish(ScheduleTable* table);
+
+/**
+ * Compiles the table from the intervals.
+ * @param table Table to be built
+ * @param intervals Switch times of the intervals in minutes from midnight
+ * @param count Number of intervals (max. ScheduleTable_MaxTransitions / 2)
+ */
+void ScheduleTable_build(
+    ScheduleTable* table,
+    const ScheduleTable_Interval* intervals,
+    uint8_t count
+);
+
+/**
+ * Looks up the output state at the specified time.
+ * @param table Compiled table
+ * @param time Time value in minutes from midnight
+ * @return True if the output is switched on by the schedule
+ */
+bool ScheduleTable_isOn(const ScheduleTable* table, Clock_Time time);
+
+/**
+ * Looks up the first transition after the specified time.
+ * @param table Compiled table
+ * @param time Time value in minutes from midnight
+ * @return The next transition or NULL if the state never changes
+ */
+const ScheduleTable_Transition* ScheduleTable_nextTransition(
+    const ScheduleTable* table,
+    Clock_Time time
+);
+
+#ifdef __cplusplus
+}
+#endif
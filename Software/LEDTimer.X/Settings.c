@@ -20,59 +20,97 @@
 
 
 #include "Config.h"
+#include "NVM.h"
 #include "Settings.h"
 
 #include "mcc_generated_files/memory.h"
 
+#include <stddef.h>
 #include <stdio.h>
 #include <string.h>
 
-SettingsData Settings_data;
+Utils_InstanceStorage SettingsData Settings_data;
 
-static void saveData(
-    uint8_t address,
-    const uint8_t* data,
-    uint8_t size
-) {
-    while (size--) {
-        DATAEE_WriteByte(address++, *data++);
-    }
-}
+// Copy of the settings being written by the NVM engine. The UI can change
+// Settings_data during the write without mixing two versions in the EEPROM.
+// Settings_load() also uses it to read the second slot.
+static Utils_InstanceStorage SettingsData savedData;
+
+static Utils_InstanceStorage struct SettingsContext
+{
+    // Sequence number of the newest complete record
+    uint8_t sequence;
+    // Slot of the newest complete record
+    uint8_t slot : 1;
+    // The other slot is being written
+    uint8_t slotSwitchPending : 1;
+    uint8_t reserved : 6;
+} context = {
+    .sequence = 0,
+    .slot = 0,
+    .slotSwitchPending = 0,
+    .reserved = 0
+};
+
+#define SlotAddress(_Slot) \
+    (Config_Settings_DataBaseAddress + (_Slot) * sizeof(SettingsData))
+
+// Both slots must fit in the 256-byte data EEPROM
+typedef char Settings_SlotsFitInEeprom[
+    SlotAddress(2) <= 256 ? 1 : -1
+];
+
+static uint8_t updateCRC8(uint8_t crc, const uint8_t data)
+{
+#define Generator   0x07u
 
-static void loadData(
-    uint8_t address,
-    uint8_t* data,
-    uint8_t size
-) {
-    while (size--) {
-        *data++ = DATAEE_ReadByte(address++);
+    crc ^= data;
+
+    for (uint8_t i = 8; i > 0; --i) {
+        if (crc & 0x80) {
+            crc = (uint8_t)(crc << 1) ^ Generator;
+        } else {
+            crc <<= 1;
+        }
     }
+
+    return crc;
 }
 
 static uint8_t calculateCRC8(const uint8_t* data, uint8_t length)
 {
-#define Generator   0x07u
-#define Init        0u
-
-    uint8_t crc = Init;
+    uint8_t crc = 0;
 
     while (length--) {
-        crc ^= *data++;
-
-        for (uint8_t i = 8; i > 0; --i) {
-            if (crc & 0x80) {
-                crc = (uint8_t)(crc << 1) ^ Generator;
-            } else {
-                crc <<= 1;
-            }
-        }
+        crc = updateCRC8(crc, *data++);
     }
 
     return crc;
 }
 
+// Reads a slot and checks its CRC in the same pass
+static bool loadSlot(const uint8_t slot, SettingsData* const data)
+{
+    uint8_t address = SlotAddress(slot);
+    uint8_t* p = (uint8_t*)data;
+    uint8_t crc = 0;
+
+    for (uint8_t i = 0; i < sizeof(SettingsData); ++i) {
+        p[i] = DATAEE_ReadByte(address++);
+        crc = updateCRC8(crc, p[i]);
+    }
+
+    return crc == 0;
+}
+
 void Settings_init()
 {
+    NVM_init();
+
+    context.sequence = 0;
+    context.slot = 0;
+    context.slotSwitchPending = 0;
+
     Settings_loadDefaults();
 }
 
@@ -87,52 +125,90 @@ void Settings_load()
     puts("STNGS:load");
 #endif
 
-    // TODO potential optimization: calculate CRC8 while loading
-    loadData(
-        Config_Settings_DataBaseAddress,
-        (uint8_t*)&Settings_data,
-        sizeof(SettingsData)
-    );
+    bool validA = loadSlot(0, &Settings_data);
+    bool validB = loadSlot(1, &savedData);
 
-    uint8_t crc8 = calculateCRC8(
-        (uint8_t*)&Settings_data,
-        sizeof(SettingsData)
-    );
+    // The sequence number wraps around, the newer one is at most 127 ahead
+    if (
+        validB
+        && (
+            !validA
+            || (int8_t)(savedData.sequence - Settings_data.sequence) > 0
+        )
+    ) {
+        memcpy(&Settings_data, &savedData, sizeof(SettingsData));
+        context.slot = 1;
+    } else {
+        context.slot = 0;
+    }
 
-    if (crc8 != 0) {
+    context.slotSwitchPending = 0;
+
+    if (!validA && !validB) {
 #if DEBUG_ENABLE_PRINT
         puts("STNGS:crcCheckFailed");
 #endif
         Settings_loadDefaults();
     }
+
+    context.sequence = Settings_data.sequence;
 }
 
 void Settings_save()
 {
 #if DEBUG_ENABLE_PRINT
-    puts("STNGS:load");
+    puts("STNGS:save");
 #endif
 
+    // The previous save has finished, its slot has the newest record.
+    // A save during a write targets the same slot again.
+    if (context.slotSwitchPending && !NVM_isBusy()) {
+        context.slot ^= 1;
+        ++context.sequence;
+    }
+
+    context.slotSwitchPending = 1;
+    Settings_data.sequence = context.sequence + 1;
+
     Settings_data.crc8 = calculateCRC8(
         (uint8_t*)&Settings_data,
-        sizeof(SettingsData) - 1
+        offsetof(SettingsData, crc8)
     );
 
-    saveData(
-        Config_Settings_DataBaseAddress,
-        (uint8_t*)&Settings_data,
+    // A running write may pick up a few bytes of the new copy, but
+    // NVM_write() compares the whole region again, so the latest version
+    // ends up in the EEPROM
+    memcpy(&savedData, &Settings_data, sizeof(SettingsData));
+
+    // The changed bytes are written from the NVM interrupt, the newest
+    // complete record stays intact in the other slot
+    NVM_write(
+        SlotAddress(context.slot ^ 1),
+        (const uint8_t*)&savedData,
         sizeof(SettingsData)
     );
 }
 
+bool Settings_isSaving()
+{
+    return NVM_isBusy();
+}
+
 void SettingsData_initWithDefaults(SettingsData* const data)
 {
     memset(data, 0, sizeof(SettingsData));
 
     data->output.brightness = 255;
+    data->output.fadeInSeconds = Config_Output_DefaultFadeInSeconds;
+    data->output.fadeOutSeconds = Config_Output_DefaultFadeOutSeconds;
 
     data->display.brightness = 2;
 
+#if !SUNRISE_SUNSET_USE_LUT
+    data->location.latitudeBcd = Config_Settings_DefaultLatitudeBcd;
+    data->location.longitudeBcd = Config_Settings_DefaultLongitudeBcd;
+#endif
+
     // Default DST settings for EU
     // Source: https://en.wikipedia.org/wiki/Daylight_saving_time_by_country
     data->dst.startOrdinal = 2;
@@ -145,4 +221,79 @@ void SettingsData_initWithDefaults(SettingsData* const data)
     data->dst.endMonth = 9;
     data->dst.endShiftHours = 1;
 //    data->dst.endShiftHoursLocal = 0;
-}
\ No newline at end of file
+}
+
+static uint16_t packSwitch(const struct IntervalSwitch* sw)
+{
+    switch (sw->type) {
+        case Settings_IntervalSwitchType_Sunrise:
+            return Settings_SunriseCodeBase + (uint8_t)(sw->sunOffset + 128);
+
+        case Settings_IntervaSwitchType_Sunset:
+            return Settings_SunsetCodeBase + (uint8_t)(sw->sunOffset + 128);
+
+        default:
+            return sw->timeHour * 60u + sw->timeMinute;
+    }
+}
+
+static void unpackSwitch(uint16_t code, struct IntervalSwitch* const sw)
+{
+    sw->reserved = 0;
+
+    if (code >= Settings_SunsetCodeBase) {
+        sw->type = Settings_IntervaSwitchType_Sunset;
+        code -= Settings_SunsetCodeBase;
+    } else if (code >= Settings_SunriseCodeBase) {
+        sw->type = Settings_IntervalSwitchType_Sunrise;
+        code -= Settings_SunriseCodeBase;
+    } else {
+        sw->type = Settings_IntervalSwitchType_Time;
+        sw->sunOffset = 0;
+        sw->timeHour = (uint8_t)(code / 60);
+        sw->timeMinute = (uint8_t)(code % 60);
+        return;
+    }
+
+    sw->sunOffset = (int8_t)((int16_t)code - 128);
+    sw->timeHour = 0;
+    sw->timeMinute = 0;
+}
+
+void Settings_unpackInterval(
+    const Settings_PackedInterval* const packed,
+    struct IntervalScheduler* const interval
+)
+{
+    const uint8_t high = packed->data[2];
+
+    interval->active = high >> 7;
+    interval->reserved = 0;
+
+    unpackSwitch(
+        packed->data[0] | (uint16_t)(high & 0x07) << 8,
+        &interval->onSwitch
+    );
+
+    unpackSwitch(
+        packed->data[1] | (uint16_t)((high >> 3) & 0x07) << 8,
+        &interval->offSwitch
+    );
+}
+
+void Settings_packInterval(
+    Settings_PackedInterval* const packed,
+    const struct IntervalScheduler* const interval
+)
+{
+    const uint16_t on = packSwitch(&interval->onSwitch);
+    const uint16_t off = packSwitch(&interval->offSwitch);
+
+    packed->data[0] = (uint8_t)on;
+    packed->data[1] = (uint8_t)off;
+    packed->data[2] = (uint8_t)(
+        (interval->active ? 0x80 : 0)
+        | (uint8_t)((off >> 8) << 3)
+        | (uint8_t)(on >> 8)
+    );
+}
@@ -43,6 +43,51 @@ typedef enum
     Settings_IntervaSwitchType_Sunset
 } Settings_IntervalSwitchType;
 
+struct IntervalSwitch
+{
+    uint8_t type : 3;       // Settings_IntervalSwitchType
+    uint8_t reserved : 5;
+
+    int8_t sunOffset;
+
+    uint8_t timeHour;
+    uint8_t timeMinute;
+};
+
+// Interval with the decoded switches, the scheduler settings store it
+// packed (see Settings_PackedInterval)
+struct IntervalScheduler
+{
+    uint8_t active : 1;
+    uint8_t reserved : 7;
+
+    struct IntervalSwitch onSwitch, offSwitch;
+};
+
+/*
+ * Interval packed into 3 bytes
+ *
+ * Both switches are stored as an 11-bit code: the minute of the day
+ * (0..1439) for time switches, Settings_SunriseCodeBase or
+ * Settings_SunsetCodeBase plus the offset + 128 for the sun events.
+ * Byte 0 and 1 hold the low 8 bits of the on and off codes, byte 2 holds
+ * the high 3 bits of them (bits 0..2 and 3..5) and the active flag (bit 7).
+ * All zeros is an inactive 00:00-00:00 interval.
+ */
+typedef struct
+{
+    uint8_t data[3];
+} Settings_PackedInterval;
+
+#define Settings_SunriseCodeBase    (1440u)
+#define Settings_SunsetCodeBase     (Settings_SunriseCodeBase + 256u)
+
+// The EEPROM holds two copies of the settings, the host build must not pad
+// the structure to keep the same size as on the device
+#ifndef __XC8
+#pragma pack(push, 1)
+#endif
+
 typedef struct
 {
     struct Scheduler
@@ -52,27 +97,16 @@ typedef struct
 
         ScheduleSegmentData segmentData;
 
-        struct IntervalScheduler
-        {
-            uint8_t active : 1;
-            uint8_t reserved : 7;
-
-            struct IntervalSwitch
-            {
-                uint8_t type : 3;       // Settings_IntervalSwitchType
-                uint8_t reserved : 5;
-
-                int8_t sunOffset;
-
-                uint8_t timeHour;
-                uint8_t timeMinute;
-            } onSwitch, offSwitch;
-        } intervals[Config_Settings_IntervalScheduleCount];
+        Settings_PackedInterval intervals[Config_Settings_IntervalScheduleCount];
     } scheduler;
 
     struct Output
     {
+        // Level of the gamma-corrected brightness curve
         uint8_t brightness;
+        // Length of the ramps when the output is switched on and off
+        uint16_t fadeInSeconds;
+        uint16_t fadeOutSeconds;
     } output;
 
     struct Display
@@ -88,6 +122,12 @@ typedef struct
         uint8_t latitudeSign : 1;
         uint8_t longitudeSign : 1;
     } location;
+#else
+    struct Location
+    {
+        // Index in SunriseSunsetLUT_locations
+        uint8_t index;
+    } location;
 #endif
 
     struct Time
@@ -97,15 +137,47 @@ typedef struct
 
     Date_DstData dst;
 
+    // Incremented by each save to find the newer slot in the EEPROM
+    uint8_t sequence;
+
     // This must be the last field
     uint8_t crc8;
 } SettingsData;
 
-extern SettingsData Settings_data;
+#ifndef __XC8
+#pragma pack(pop)
+#endif
+
+extern Utils_InstanceStorage SettingsData Settings_data;
 
 void Settings_init(void);
 void Settings_loadDefaults(void);
 void Settings_load(void);
 void Settings_save(void);
 
-void SettingsData_initWithDefaults(SettingsData* data);
\ No newline at end of file
+/**
+ * @return True while the settings are being written to the EEPROM
+ */
+bool Settings_isSaving(void);
+
+void SettingsData_initWithDefaults(SettingsData* data);
+
+/**
+ * Decodes a packed interval.
+ * @param packed Interval in the settings
+ * @param interval Decoded interval
+ */
+void Settings_unpackInterval(
+    const Settings_PackedInterval* packed,
+    struct IntervalScheduler* interval
+);
+
+/**
+ * Encodes an interval.
+ * @param packed Interval in the settings
+ * @param interval Interval to be stored, the times must be valid
+ */
+void Settings_packInterval(
+    Settings_PackedInterval* packed,
+    const struct IntervalScheduler* interval
+);
\ No newline at end of file
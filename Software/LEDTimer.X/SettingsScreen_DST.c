@@ -39,58 +39,49 @@ void SettingsScreen_DST_init(Date_DstData* settings)
 
 static void drawDstSettingsLine(const bool start)
 {
-    static const char* OrdinalNames[4] = {
-        "1ST ",
-        "2ND ",
-        "LAST"
-    };
-
     char buf[5];
     uint8_t x = 5;
     uint8_t line = start ? 3 : 5;
     uint8_t itemIndex = start ? 0 : 4;
 
-    x = Text_draw(
-        OrdinalNames[
+    x = Graphics_drawLabel2(
+        Label_First + (
             start
                 ? context.settings->startOrdinal
                 : context.settings->endOrdinal
-        ],
+        ),
         line,
         x,
-        0,
-        context.selectionIndex == itemIndex
+        context.selectionIndex == itemIndex ? GRAPHICS_DRAW_INVERT : 0
     );
     x += 5;
     ++itemIndex;
 
-    x = Text_draw(
-        Date_DayShortNames[
+    x = Graphics_drawLabel2(
+        Label_Sunday + (
             start
                 ? context.settings->startDayOfWeek
                 : context.settings->endDayOfWeek
-        ],
+        ),
         line,
         x,
-        0,
-        context.selectionIndex == itemIndex
+        context.selectionIndex == itemIndex ? GRAPHICS_DRAW_INVERT : 0
     );
     x += 5;
     ++itemIndex;
 
-    x = Text_draw("OF", line, x, 0, false);
+    x = Graphics_drawLabel(Label_Of, line, x);
     x += 5;
 
-    x = Text_draw(
-        Date_MonthShortNames[
+    x = Graphics_drawLabel2(
+        Label_January + (
             start
                 ? context.settings->startMonth
                 : context.settings->endMonth
-        ],
+        ),
         line,
         x,
-        0,
-        context.selectionIndex == itemIndex
+        context.selectionIndex == itemIndex ? GRAPHICS_DRAW_INVERT : 0
     );
     x += 5;
     ++itemIndex;
@@ -108,7 +99,7 @@ static void drawDstSettingsLine(const bool start)
 void SettingsScreen_DST_update(const bool redraw)
 {
     if (redraw) {
-        Graphics_DrawScreenTitle("DST");
+        Graphics_drawScreenTitle(Label_DST);
         Graphics_DrawKeypadHelpBar(
             Graphics_ExitIcon,
             Graphics_ArrowDownIcon,
@@ -129,8 +120,8 @@ END                             @4
 
     if (redraw) {
         SSD1306_fillArea(0, 2, 128, 4, SSD1306_COLOR_BLACK);
-        Text_draw("START", 2, 0, 0, false);
-        Text_draw("END", 4, 0, 0, false);
+        Graphics_drawLabel(Label_Start, 2, 0);
+        Graphics_drawLabel(Label_End, 4, 0);
     }
 
     drawDstSettingsLine(true);
@@ -35,6 +35,10 @@ static struct SettingScreen_Date_Context {
     uint8_t day;
     uint8_t lastDayOfMonth;
     uint8_t selectionIndex;
+    uint8_t drawnSelectionIndex;
+    Text_7SegCache year7Seg;
+    Text_7SegCache month7Seg;
+    Text_7SegCache day7Seg;
 } context;
 
 void SettingsScreen_Date_init()
@@ -52,10 +56,18 @@ void SettingsScreen_Date_init()
 void SettingsScreen_Date_update(const bool redraw)
 {
     if (redraw) {
-        Graphics_DrawScreenTitle("DATE");
+        Graphics_drawScreenTitle(Label_Date);
         Graphics_DrawKeypadHelpBar(Graphics_ExitIcon, Graphics_ArrowRightIcon, Graphics_AdjustIcon);
+        Text_invalidate7SegCache(&context.year7Seg);
+        Text_invalidate7SegCache(&context.month7Seg);
+        Text_invalidate7SegCache(&context.day7Seg);
     }
 
+    // The selection marker is only drawn when it moves
+    const bool drawSelection =
+        redraw || context.drawnSelectionIndex != context.selectionIndex;
+    context.drawnSelectionIndex = context.selectionIndex;
+
     #define CharWidth 12u
     #define CharSpacing 2u
     #define TotalWidth (8u * CharWidth + 15u * CharSpacing)
@@ -68,22 +80,28 @@ void SettingsScreen_Date_update(const bool redraw)
 
     // Year
     sprintf(s, "%04u", (uint16_t)context.year + 1970);
-    x = Text_draw7Seg(s, 2, x, false);
-    SSD1306_fillAreaPattern(xPrev, 5, x - xPrev, 1, context.selectionIndex == 0 ? LinePattern : 0);
+    x = Text_draw7SegCached(s, 2, x, false, &context.year7Seg);
+    if (drawSelection) {
+        SSD1306_fillAreaPattern(xPrev, 5, x - xPrev, 1, context.selectionIndex == 0 ? LinePattern : 0);
+    }
     x += ExtraSpacing;
 
     // Month
     sprintf(s, "%02u", context.month);
     xPrev = x;
-    x = Text_draw7Seg(s, 2, x, false);
-    SSD1306_fillAreaPattern(xPrev, 5, x - xPrev, 1, context.selectionIndex == 1 ? LinePattern : 0);
+    x = Text_draw7SegCached(s, 2, x, false, &context.month7Seg);
+    if (drawSelection) {
+        SSD1306_fillAreaPattern(xPrev, 5, x - xPrev, 1, context.selectionIndex == 1 ? LinePattern : 0);
+    }
     x += ExtraSpacing - 1 /* to fit the last 2 numbers on the screen */;
 
     // Day
     sprintf(s, "%02u", context.day);
     xPrev = x;
-    x = Text_draw7Seg(s, 2, x, false);
-    SSD1306_fillAreaPattern(xPrev, 5, x - xPrev, 1, context.selectionIndex == 2 ? LinePattern : 0);
+    x = Text_draw7SegCached(s, 2, x, false, &context.day7Seg);
+    if (drawSelection) {
+        SSD1306_fillAreaPattern(xPrev, 5, x - xPrev, 1, context.selectionIndex == 2 ? LinePattern : 0);
+    }
 }
 
 bool SettingsScreen_Date_handleKeyPress(const uint8_t keyCode, const bool hold)
@@ -29,6 +29,7 @@
 
 static struct SettingScreen_DisplayBrightness_Context {
     struct Display* settings;
+    Text_7SegCache value;
 } context;
 
 void SettingsScreen_DisplayBrightness_init(struct Display* settings)
@@ -39,13 +40,20 @@ void SettingsScreen_DisplayBrightness_init(struct Display* settings)
 void SettingsScreen_DisplayBrightness_update(const bool redraw)
 {
     if (redraw) {
-        Graphics_DrawScreenTitle("DISP. BRIGHTNESS");
+        Graphics_drawScreenTitle(Label_DisplayBrightness);
         Graphics_DrawKeypadHelpBar(Graphics_ExitIcon, Graphics_SetIcon, Graphics_ClearIcon);
+        Text_invalidate7SegCache(&context.value);
     }
 
     char s[2];
     sprintf(s, "%u", context.settings->brightness);
-    Text_draw7Seg(s, 2, 64 - Text_calculateWidth7Seg(s) / 2, false);
+    Text_draw7SegCached(
+        s,
+        2,
+        64 - Text_calculateWidth7Seg(s) / 2,
+        false,
+        &context.value
+    );
 }
 
 bool SettingsScreen_DisplayBrightness_handleKeyPress(const uint8_t keyCode, const bool hold)
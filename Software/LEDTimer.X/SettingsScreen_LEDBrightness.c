@@ -18,13 +18,12 @@
     Created on 2023-01-31
 */
 
+#include "Fader.h"
 #include "Graphics.h"
 #include "Keypad.h"
 #include "SettingsScreen_LEDBrightness.h"
 #include "OutputController.h"
 
-#include "mcc_generated_files/pwm5.h"
-
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
@@ -32,13 +31,14 @@
 
 static struct SettingScreen_LEDBrightness_Context {
     struct Output* settings;
+    Text_7SegCache value;
 } context;
 
 void SettingsScreen_LEDBrightness_init(struct Output* settings)
 {
     context.settings = settings;
     OutputController_suspend(true);
-    PWM5_LoadDutyValue(context.settings->brightness);
+    Fader_setLevel(context.settings->brightness);
 }
 
 void SettingsScreen_LEDBrightness_close()
@@ -49,13 +49,20 @@ void SettingsScreen_LEDBrightness_close()
 void SettingsScreen_LEDBrightness_update(const bool redraw)
 {
     if (redraw) {
-        Graphics_DrawScreenTitle("LED BRIGHTNESS");
+        Graphics_drawScreenTitle(Label_LEDBrightness);
         Graphics_DrawKeypadHelpBar(Graphics_ExitIcon, Graphics_SetIcon, Graphics_ClearIcon);
+        Text_invalidate7SegCache(&context.value);
     }
 
     char s[4];
     sprintf(s, "%3u", context.settings->brightness);
-    Text_draw7Seg(s, 2, 64 - Text_calculateWidth7Seg(s) / 2, false);
+    Text_draw7SegCached(
+        s,
+        2,
+        64 - Text_calculateWidth7Seg(s) / 2,
+        false,
+        &context.value
+    );
 }
 
 bool SettingsScreen_LEDBrightness_handleKeyPress(const uint8_t keyCode, const bool hold)
@@ -74,7 +81,7 @@ bool SettingsScreen_LEDBrightness_handleKeyPress(const uint8_t keyCode, const bo
         case Keypad_Key2: {
             ++context.settings->brightness;
             SettingsScreen_LEDBrightness_update(false);
-            PWM5_LoadDutyValue(context.settings->brightness);
+            Fader_setLevel(context.settings->brightness);
             break;
         }
 
@@ -82,7 +89,7 @@ bool SettingsScreen_LEDBrightness_handleKeyPress(const uint8_t keyCode, const bo
         case Keypad_Key3: {
             --context.settings->brightness;
             SettingsScreen_LEDBrightness_update(false);
-            PWM5_LoadDutyValue(context.settings->brightness);
+            Fader_setLevel(context.settings->brightness);
             break;
         }
     }
@@ -44,8 +44,8 @@ void SettingsScreen_Location_init(struct Location* const settings)
 {
     context.latitudeBcd = settings->latitudeBcd;
     context.longitudeBcd = settings->longitudeBcd;
-    context.latitudeSign = 0;
-    context.longitudeSign = 0;
+    context.latitudeSign = settings->latitudeSign;
+    context.longitudeSign = settings->longitudeSign;
     context.settings = settings;
 }
 
@@ -73,11 +73,11 @@ static void drawBcdNumber(
 void SettingsScreen_Location_update(const bool redraw)
 {
     if (redraw) {
-        Graphics_DrawScreenTitle("LOCATION");
+        Graphics_drawScreenTitle(Label_Location);
         Graphics_DrawKeypadHelpBar(Graphics_ExitIcon, Graphics_ArrowRightIcon, Graphics_AdjustIcon);
 
-        LeftText("LAT.:", 3);
-        LeftText("LON.:", 4);
+        Graphics_drawLabel(Label_Latitude, 3, 0);
+        Graphics_drawLabel(Label_Longitude, 4, 0);
     }
 
     uint8_t x = CalculateTextWidth("LAT.: ");
@@ -165,4 +165,67 @@ bool SettingsScreen_Location_handleKeyPress(const uint8_t keyCode, const bool ho
     return true;
 }
 
-#endif
\ No newline at end of file
+#else
+
+#include "Graphics.h"
+#include "Keypad.h"
+#include "Settings.h"
+#include "SunriseSunsetLUT.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+static struct SettingScreen_Location_Context {
+    struct Location* settings;
+} context;
+
+void SettingsScreen_Location_init(struct Location* const settings)
+{
+    if (settings->index >= SunriseSunsetLUT_LocationCount) {
+        settings->index = 0;
+    }
+
+    context.settings = settings;
+}
+
+void SettingsScreen_Location_update(const bool redraw)
+{
+    if (redraw) {
+        Graphics_drawScreenTitle(Label_Location);
+        Graphics_DrawKeypadHelpBarLeftRight(Graphics_ExitIcon, Graphics_AdjustIcon);
+    }
+
+    // Name of the selected location from the compressed tables
+    const char* name = SunriseSunsetLUT_locations[context.settings->index].name;
+
+    SSD1306_fillArea(0, 3, 128, 1, SSD1306_COLOR_BLACK);
+    Text_draw(name, 3, 64 - Text_calculateWidth(name) / 2, 0, false);
+}
+
+bool SettingsScreen_Location_handleKeyPress(const uint8_t keyCode, const bool hold)
+{
+    switch (keyCode) {
+        // Exit
+        case Keypad_Key1: {
+            if (hold) {
+                break;
+            }
+
+            return false;
+        }
+
+        // Next location
+        case Keypad_Key3: {
+            if (++context.settings->index >= SunriseSunsetLUT_LocationCount) {
+                context.settings->index = 0;
+            }
+
+            SettingsScreen_Location_update(false);
+            break;
+        }
+    }
+
+    return true;
+}
+
+#endif
@@ -29,6 +29,9 @@
 
 static struct SettingScreen_Scheduler_Context {
     struct Scheduler* settings;
+    // Decoded copy of the interval being edited
+    struct IntervalScheduler interval;
+    uint8_t intervalIndex;
     uint8_t selection : 4;
     uint8_t schedulerTypeChanged : 1;
     uint8_t onSwitchChanged : 1;
@@ -36,8 +39,7 @@ static struct SettingScreen_Scheduler_Context {
     uint8_t selectionChanged : 1;
     uint8_t intervalIndexChanged : 1;
     uint8_t activeStateChanged : 1;
-    uint8_t intervalIndex : 3;
-    uint8_t reserved : 3;
+    uint8_t reserved : 6;
 } context;
 
 void SettingsScreen_Scheduler_init(struct Scheduler* settings)
@@ -51,22 +53,25 @@ void SettingsScreen_Scheduler_init(struct Scheduler* settings)
     context.intervalIndexChanged = 0;
     context.activeStateChanged = 0;
     context.intervalIndex = 0;
+
+    Settings_unpackInterval(&settings->intervals[0], &context.interval);
 }
 
 void SettingsScreen_Scheduler_update(const bool redraw)
 {
     if (redraw) {
-        Graphics_DrawScreenTitle("SCHEDULER");
+        Graphics_drawScreenTitle(Label_Scheduler);
         Graphics_DrawKeypadHelpBar(Graphics_ExitIcon, Graphics_ArrowDownIcon, Graphics_AdjustIcon);
     }
 
-    static const char* SchedulerTypes[] = { "INTERVAL", "SEGMENT", "OFF" };
-    static const char* SwitchTypes[] = { "TIME", "SUNRISE", "SUNSET" };
-
     #define InvertForSelectionIndex(_Index) (\
         context.selection == _Index \
     )
 
+    #define LabelFlagsForSelectionIndex(_Index) (\
+        context.selection == _Index ? GRAPHICS_DRAW_INVERT : 0 \
+    )
+
     #define PositionAfter(_Label) (\
         CalculateTextWidth(_Label) + 5 /* space */ \
     )
@@ -84,7 +89,7 @@ void SettingsScreen_Scheduler_update(const bool redraw)
     if (redraw) {
         SSD1306_fillArea(0, 1, 128, 6, SSD1306_COLOR_BLACK);
 
-        Text_draw("TYPE:", 1, 0, 0, false);
+        Graphics_drawLabel(Label_Type, 1, 0);
 
         // Trigger update of all fields
         context.schedulerTypeChanged = true;
@@ -104,36 +109,40 @@ void SettingsScreen_Scheduler_update(const bool redraw)
 
     if (context.schedulerTypeChanged || context.selectionChanged) {
         // Scheduler type
-        Text_draw(
-            SchedulerTypes[context.settings->type],
+        Graphics_drawLabel2(
+            Label_SchedulerTypeInterval + context.settings->type,
             1,
             PositionAfter("TYPE:"),
-            0,
-            InvertForSelectionIndex(0)
+            LabelFlagsForSelectionIndex(0)
         );
     }
 
     if (context.settings->type == Settings_SchedulerType_Interval) {
         if (context.schedulerTypeChanged) {
             // Interval scheduler program index title
-            LeftText("SCHEDULE:", 2);
+            Graphics_drawLabel(Label_Schedule, 2, 0);
             // Interval active state title
-            Text_draw("ACTIVE:", 2, PositionAfter("SCHEDULE: x"), 0, false);
+            Graphics_drawLabel(Label_Active, 2, PositionAfter("SCHEDULE: xx"));
         }
 
         if (context.schedulerTypeChanged || context.intervalIndexChanged || context.selectionChanged) {
             // Interval scheduler program index
-            char s[2];
+            char s[3];
             sprintf(s, "%u", context.intervalIndex + 1);
-            Text_draw(s, 2, PositionAfter("SCHEDULE:"), 0, InvertForSelectionIndex(1));
+            uint8_t x = Text_draw(s, 2, PositionAfter("SCHEDULE:"), 0, InvertForSelectionIndex(1));
+
+            // Clean the second digit after wrapping around to the first interval
+            if (context.intervalIndexChanged && !context.schedulerTypeChanged && context.intervalIndex == 0) {
+                SSD1306_fillArea(x, 2, CalculateTextWidth("0"), 1, SSD1306_COLOR_BLACK);
+            }
         }
 
         if (context.schedulerTypeChanged || context.activeStateChanged || context.selectionChanged) {
             // Interval active state value
             Text_draw(
-                context.settings->intervals[context.intervalIndex].active ? "1" : "0",
+                context.interval.active ? "1" : "0",
                 2,
-                PositionAfter("SCHEDULE: x ACTIVE:"),
+                PositionAfter("SCHEDULE: xx ACTIVE:"),
                 false,
                 InvertForSelectionIndex(2)
             );
@@ -149,62 +158,62 @@ void SettingsScreen_Scheduler_update(const bool redraw)
         // Draw the fixed labels for the current scheduler type
         switch (context.settings->type) {
             case Settings_SchedulerType_Segment:
-                CenterText("CHANGE SETTINGS", 3);
-                CenterText("ON SGMT. SCHD. SCREEN", 4);
+                Graphics_DrawCenterLabel(Label_ChangeSettings, 3);
+                Graphics_DrawCenterLabel(Label_OnSegmentSchedulerScreen, 4);
                 break;
 
             case Settings_SchedulerType_Interval:
                 // Switch on schedule label
-                LeftText("ON:", 3);
+                Graphics_drawLabel(Label_On, 3, 0);
                 // Switch off schedule label
-                LeftText("OFF:", 5);
+                Graphics_drawLabel(Label_Off, 5, 0);
 
-                switch (context.settings->intervals[context.intervalIndex].onSwitch.type) {
+                switch (context.interval.onSwitch.type) {
                     case Settings_IntervalSwitchType_Sunrise:
                     case Settings_IntervaSwitchType_Sunset: {
                         // Switch on schedule setting label
-                        uint8_t x = LeftText("OFFSET:", 4);
+                        uint8_t x = Graphics_drawLabel(Label_Offset, 4, 0);
                         SSD1306_fillArea(x, 4, 128 - x, 1, SSD1306_COLOR_BLACK);
                         // Unit label
-                        Text_draw("MIN", 4, PositionAfter("OFFSET: xxx"), 0, false);
+                        Graphics_drawLabel(Label_Minutes, 4, PositionAfter("OFFSET: xxx"));
                         break;
                     }
 
                     case Settings_IntervalSwitchType_Time: {
                         // Switch on time setting label
-                        uint8_t x = LeftText("TIME:", 4);
+                        uint8_t x = Graphics_drawLabel(Label_TimeField, 4, 0);
                         SSD1306_fillArea(x, 4, 128 - x, 1, SSD1306_COLOR_BLACK);
                         // Time hour-minute separator
-                        Text_draw(":", 4, CalculateTextWidth("TIME: xx"), 0, false);
+                        Graphics_drawLabel(Label_Colon, 4, CalculateTextWidth("TIME: xx"));
                         break;
                     }
                 }
 
-                switch (context.settings->intervals[context.intervalIndex].offSwitch.type) {
+                switch (context.interval.offSwitch.type) {
                     case Settings_IntervalSwitchType_Sunrise:
                     case Settings_IntervaSwitchType_Sunset: {
                         // Switch off schedule setting label
-                        uint8_t x = LeftText("OFFSET:", 6);
+                        uint8_t x = Graphics_drawLabel(Label_Offset, 6, 0);
                         SSD1306_fillArea(x, 6, 128 - x, 1, SSD1306_COLOR_BLACK);
                         // Unit label
-                        Text_draw("MIN", 6, PositionAfter("OFFSET: xxx"), 0, false);
+                        Graphics_drawLabel(Label_Minutes, 6, PositionAfter("OFFSET: xxx"));
                         break;
                     }
 
                     case Settings_IntervalSwitchType_Time: {
                         // Switch off time setting label
-                        uint8_t x = LeftText("TIME:", 6);
+                        uint8_t x = Graphics_drawLabel(Label_TimeField, 6, 0);
                         SSD1306_fillArea(x, 6, 128 - x, 1, SSD1306_COLOR_BLACK);
                         // Time hour-minute separator
-                        Text_draw(":", 6, CalculateTextWidth("TIME: xx"), 0, false);
+                        Graphics_drawLabel(Label_Colon, 6, CalculateTextWidth("TIME: xx"));
                         break;
                     }
                 }
                 break;
 
             case Settings_SchedulerType_Off:
-                CenterText("The output will only", 3);
-                CenterText("be switched manually", 4);
+                Graphics_DrawCenterLabel(Label_OutputWillOnly, 3);
+                Graphics_DrawCenterLabel(Label_BeSwitchedManually, 4);
                 break;
         }
     }
@@ -222,9 +231,9 @@ void SettingsScreen_Scheduler_update(const bool redraw)
                 || context.selectionChanged
                 || context.intervalIndexChanged
             ) {
-                uint8_t x = Text_draw(
-                    SwitchTypes[context.settings->intervals[context.intervalIndex].onSwitch.type],
-                    3, PositionAfter("ON:"), 0, InvertForSelectionIndex(3)
+                uint8_t x = Graphics_drawLabel2(
+                    Label_SwitchTypeTime + context.interval.onSwitch.type,
+                    3, PositionAfter("ON:"), LabelFlagsForSelectionIndex(3)
                 );
                 // Clean the background after the text
                 SSD1306_fillArea(x, 3, 128 - x, 1, SSD1306_COLOR_BLACK);
@@ -237,20 +246,20 @@ void SettingsScreen_Scheduler_update(const bool redraw)
                 || context.selectionChanged
                 || context.intervalIndexChanged
             ) {
-                uint8_t x = Text_draw(
-                    SwitchTypes[context.settings->intervals[context.intervalIndex].offSwitch.type],
-                    5, PositionAfter("OFF:"), 0, InvertForSelectionIndex(6)
+                uint8_t x = Graphics_drawLabel2(
+                    Label_SwitchTypeTime + context.interval.offSwitch.type,
+                    5, PositionAfter("OFF:"), LabelFlagsForSelectionIndex(6)
                 );
                 // Clean the background after the text
                 SSD1306_fillArea(x, 5, 128 - x, 1, SSD1306_COLOR_BLACK);
             }
 
-            switch (context.settings->intervals[context.intervalIndex].onSwitch.type) {
+            switch (context.interval.onSwitch.type) {
                 case Settings_IntervalSwitchType_Sunrise:
                 case Settings_IntervaSwitchType_Sunset: {
                     // Offset value label
                     char s[4];
-                    FormatSunOffset(s, context.settings->intervals[context.intervalIndex].onSwitch.sunOffset);
+                    FormatSunOffset(s, context.interval.onSwitch.sunOffset);
                     Text_draw(s, 4, PositionAfter("OFFSET:"), 0, InvertForSelectionIndex(4));
                     break;
                 }
@@ -259,22 +268,22 @@ void SettingsScreen_Scheduler_update(const bool redraw)
                     char s[3];
 
                     // Time hour value label
-                    sprintf(s, "%2u", context.settings->intervals[context.intervalIndex].onSwitch.timeHour);
+                    sprintf(s, "%2u", context.interval.onSwitch.timeHour);
                     Text_draw(s, 4, PositionAfter("TIME:"), 0, InvertForSelectionIndex(4));
 
                     // Time minute value label
-                    sprintf(s, "%02u", context.settings->intervals[context.intervalIndex].onSwitch.timeMinute);
+                    sprintf(s, "%02u", context.interval.onSwitch.timeMinute);
                     Text_draw(s, 4, CalculateTextWidth("TIME: xx:"), 0, InvertForSelectionIndex(5));
                     break;
                 }
             }
 
-            switch (context.settings->intervals[context.intervalIndex].offSwitch.type) {
+            switch (context.interval.offSwitch.type) {
                 case Settings_IntervalSwitchType_Sunrise:
                 case Settings_IntervaSwitchType_Sunset: {
                     // Offset value label
                     char s[4];
-                    FormatSunOffset(s, context.settings->intervals[context.intervalIndex].offSwitch.sunOffset);
+                    FormatSunOffset(s, context.interval.offSwitch.sunOffset);
                     Text_draw(s, 6, PositionAfter("OFFSET:"), 0, InvertForSelectionIndex(7));
                     break;
                 }
@@ -283,11 +292,11 @@ void SettingsScreen_Scheduler_update(const bool redraw)
                     char s[3];
 
                     // Time hour value label
-                    sprintf(s, "%2u", context.settings->intervals[context.intervalIndex].offSwitch.timeHour);
+                    sprintf(s, "%2u", context.interval.offSwitch.timeHour);
                     Text_draw(s, 6, PositionAfter("TIME:"), 0, InvertForSelectionIndex(7));
 
                     // Time minute value label
-                    sprintf(s, "%02u", context.settings->intervals[context.intervalIndex].offSwitch.timeMinute);
+                    sprintf(s, "%02u", context.interval.offSwitch.timeMinute);
                     Text_draw(s, 6, CalculateTextWidth("TIME: xx:"), 0, InvertForSelectionIndex(8));
                     break;
                 }
@@ -328,11 +337,11 @@ static void selectNextItem()
     ++context.selection;
     context.selectionChanged = true;
 
-    if (context.selection == 5 && context.settings->intervals[context.intervalIndex].onSwitch.type != Settings_IntervalSwitchType_Time) {
+    if (context.selection == 5 && context.interval.onSwitch.type != Settings_IntervalSwitchType_Time) {
         ++context.selection;
     }
 
-    if (context.selection == 8 && context.settings->intervals[context.intervalIndex].offSwitch.type != Settings_IntervalSwitchType_Time) {
+    if (context.selection == 8 && context.interval.offSwitch.type != Settings_IntervalSwitchType_Time) {
         ++context.selection;
     }
 
@@ -381,32 +390,36 @@ static void adjustSelectedItem()
             if (++context.intervalIndex >= Config_Settings_IntervalScheduleCount) {
                 context.intervalIndex = 0;
             }
+            Settings_unpackInterval(
+                &context.settings->intervals[context.intervalIndex],
+                &context.interval
+            );
             context.intervalIndexChanged = true;
             break;
         }
 
         case 2: {
-            ++context.settings->intervals[context.intervalIndex].active;
+            ++context.interval.active;
             context.activeStateChanged = true;
             break;
         }
 
         case 3: {
-            RotateSwitchType(context.settings->intervals[context.intervalIndex].onSwitch.type);
+            RotateSwitchType(context.interval.onSwitch.type);
             context.onSwitchChanged = true;
             break;
         }
 
         case 4: {
-            switch (context.settings->intervals[context.intervalIndex].onSwitch.type) {
+            switch (context.interval.onSwitch.type) {
                 case Settings_IntervalSwitchType_Time: {
-                    RotateHour(context.settings->intervals[context.intervalIndex].onSwitch.timeHour);
+                    RotateHour(context.interval.onSwitch.timeHour);
                     break;
                 }
 
                 case Settings_IntervalSwitchType_Sunrise:
                 case Settings_IntervaSwitchType_Sunset: {
-                    RotateSunOffset(context.settings->intervals[context.intervalIndex].onSwitch.sunOffset);
+                    RotateSunOffset(context.interval.onSwitch.sunOffset);
                     break;
                 }
 
@@ -417,28 +430,28 @@ static void adjustSelectedItem()
         }
 
         case 5: {
-            if (context.settings->intervals[context.intervalIndex].onSwitch.type == Settings_IntervalSwitchType_Time) {
-                RotateMinute(context.settings->intervals[context.intervalIndex].onSwitch.timeMinute);
+            if (context.interval.onSwitch.type == Settings_IntervalSwitchType_Time) {
+                RotateMinute(context.interval.onSwitch.timeMinute);
             }
             break;
         }
 
         case 6: {
-            RotateSwitchType(context.settings->intervals[context.intervalIndex].offSwitch.type);
+            RotateSwitchType(context.interval.offSwitch.type);
             context.offSwitchChanged = true;
             break;
         }
 
         case 7: {
-            switch (context.settings->intervals[context.intervalIndex].offSwitch.type) {
+            switch (context.interval.offSwitch.type) {
                 case Settings_IntervalSwitchType_Time: {
-                    RotateHour(context.settings->intervals[context.intervalIndex].offSwitch.timeHour);
+                    RotateHour(context.interval.offSwitch.timeHour);
                     break;
                 }
 
                 case Settings_IntervalSwitchType_Sunrise:
                 case Settings_IntervaSwitchType_Sunset: {
-                    RotateSunOffset(context.settings->intervals[context.intervalIndex].offSwitch.sunOffset);
+                    RotateSunOffset(context.interval.offSwitch.sunOffset);
                     break;
                 }
 
@@ -449,8 +462,8 @@ static void adjustSelectedItem()
         }
 
         case 8: {
-            if (context.settings->intervals[context.intervalIndex].offSwitch.type == Settings_IntervalSwitchType_Time) {
-                RotateMinute(context.settings->intervals[context.intervalIndex].offSwitch.timeMinute);
+            if (context.interval.offSwitch.type == Settings_IntervalSwitchType_Time) {
+                RotateMinute(context.interval.offSwitch.timeMinute);
             }
             break;
         }
@@ -458,6 +471,13 @@ static void adjustSelectedItem()
         default:
             break;
     }
+
+    if (context.selection >= 2) {
+        Settings_packInterval(
+            &context.settings->intervals[context.intervalIndex],
+            &context.interval
+        );
+    }
 }
 
 bool SettingsScreen_Scheduler_handleKeyPress(const uint8_t keyCode, const bool hold)
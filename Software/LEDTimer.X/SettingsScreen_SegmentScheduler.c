@@ -28,21 +28,25 @@
 #include <stdio.h>
 #include <string.h>
 
+#define NoChangedSegment 0xFFu
+
 static struct SettingScreen_SegmentScheduler_Context {
     struct Scheduler* settings;
     uint8_t segmentIndex;
+    uint8_t changedSegmentIndex;
 } context;
 
 void SettingsScreen_SegmentScheduler_init(struct Scheduler* settings)
 {
     context.settings = settings;
     context.segmentIndex = 0;
+    context.changedSegmentIndex = NoChangedSegment;
 }
 
 void SettingsScreen_SegmentScheduler_update(const bool redraw)
 {
     if (redraw) {
-        Graphics_DrawScreenTitle("Segment schd.");
+        Graphics_drawScreenTitle(Label_SegmentSchedulerTitle);
         Graphics_DrawKeypadHelpBar(Graphics_ExitIcon, Graphics_SetIcon, Graphics_ClearIcon);
     }
 
@@ -62,7 +66,19 @@ void SettingsScreen_SegmentScheduler_update(const bool redraw)
     );
 
     Graphics_drawScheduleSegmentIndicator(4, context.segmentIndex, 0);
-    Graphics_drawScheduleBar(5, context.settings->segmentData, 0);
+
+    if (redraw) {
+        Graphics_drawScheduleBar(5, context.settings->segmentData, 0);
+    } else if (context.changedSegmentIndex != NoChangedSegment) {
+        Graphics_drawScheduleBarSegment(
+            5,
+            context.settings->segmentData,
+            context.changedSegmentIndex,
+            0
+        );
+    }
+
+    context.changedSegmentIndex = NoChangedSegment;
 }
 
 static void adjustScheduleSegmentAndStepForward(const bool set)
@@ -73,6 +89,8 @@ static void adjustScheduleSegmentAndStepForward(const bool set)
         set
     );
 
+    context.changedSegmentIndex = context.segmentIndex;
+
     if (++context.segmentIndex >= 48) {
         context.segmentIndex = 0;
     }
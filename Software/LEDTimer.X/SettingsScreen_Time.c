@@ -33,6 +33,9 @@ static struct SettingScreen_Time_Context {
     uint8_t hours : 5;
     uint8_t clockAdjusted : 1;
     uint8_t selectionIndex : 1;
+    uint8_t drawnSelectionIndex : 1;
+    Text_7SegCache hours7Seg;
+    Text_7SegCache minutes7Seg;
 } context;
 
 void SettingsScreen_Time_init()
@@ -46,10 +49,17 @@ void SettingsScreen_Time_init()
 void SettingsScreen_Time_update(const bool redraw)
 {
     if (redraw) {
-        Graphics_DrawScreenTitle("TIME");
+        Graphics_drawScreenTitle(Label_Time);
         Graphics_DrawKeypadHelpBar(Graphics_ExitIcon, Graphics_ArrowRightIcon, Graphics_AdjustIcon);
+        Text_invalidate7SegCache(&context.hours7Seg);
+        Text_invalidate7SegCache(&context.minutes7Seg);
     }
 
+    // The selection marker is only drawn when it moves
+    const bool drawSelection =
+        redraw || context.drawnSelectionIndex != context.selectionIndex;
+    context.drawnSelectionIndex = context.selectionIndex;
+
     #define CharWidth 12u
     #define CharSpacing 2u
     #define ColonWidth 4u
@@ -62,19 +72,25 @@ void SettingsScreen_Time_update(const bool redraw)
 
     // Hour
     sprintf(s, "%02u", context.hours);
-    x = Text_draw7Seg(s, 2, x, false);
-    SSD1306_fillAreaPattern(xPrev, 5, x - xPrev, 1, context.selectionIndex == 0 ? LinePattern : 0);
+    x = Text_draw7SegCached(s, 2, x, false, &context.hours7Seg);
+    if (drawSelection) {
+        SSD1306_fillAreaPattern(xPrev, 5, x - xPrev, 1, context.selectionIndex == 0 ? LinePattern : 0);
+    }
     x += CharSpacing;
 
     // Separator
-    x = Text_draw7Seg(":", 2, x, false);
-    x += CharSpacing;
+    if (redraw) {
+        Text_draw7Seg(":", 2, x, false);
+    }
+    x += ColonWidth + CharSpacing;
 
     // Minute
     sprintf(s, "%02u", context.minutes);
     xPrev = x;
-    x = Text_draw7Seg(s, 2, x, false);
-    SSD1306_fillAreaPattern(xPrev, 5, x - xPrev, 1, context.selectionIndex == 1 ? LinePattern : 0);
+    x = Text_draw7SegCached(s, 2, x, false, &context.minutes7Seg);
+    if (drawSelection) {
+        SSD1306_fillAreaPattern(xPrev, 5, x - xPrev, 1, context.selectionIndex == 1 ? LinePattern : 0);
+    }
 }
 
 bool SettingsScreen_Time_handleKeyPress(const uint8_t keyCode, const bool hold)
@@ -41,7 +41,7 @@ void SettingsScreen_TimeZone_init(struct Time* settings)
 void SettingsScreen_TimeZone_update(const bool redraw)
 {
     if (redraw) {
-        Graphics_DrawScreenTitle("TIME ZONE");
+        Graphics_drawScreenTitle(Label_TimeZone);
         Graphics_DrawKeypadHelpBarLeftRight(Graphics_ExitIcon, Graphics_AdjustIcon);
     }
 
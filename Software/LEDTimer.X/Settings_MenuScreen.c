@@ -27,21 +27,19 @@
 
 #include <string.h>
 
-static const char* MenuItems[] = {
-    "SCHEDULER",
-    "SEGMENT SCHEDULER",
-    "LED BRIGHTNES",
-    "DISP. BRIGHTNESS",
-    "DATE",
-    "TIME",
-    "TIME ZONE",
-    "DST",
-#if !SUNRISE_SUNSET_USE_LUT
-    "LOCATION"
-#endif
+static const Label MenuItems[] = {
+    Label_Scheduler,
+    Label_SegmentScheduler,
+    Label_LEDBrightness,
+    Label_DisplayBrightness,
+    Label_Date,
+    Label_Time,
+    Label_TimeZone,
+    Label_DST,
+    Label_Location
 };
 
-#define MenuItemCount   (sizeof(MenuItems) / sizeof(char*))
+#define MenuItemCount   (sizeof(MenuItems) / sizeof(MenuItems[0]))
 
 static const uint8_t PositionIndicatorEmpty[] = {
     0b10101010,
@@ -72,7 +70,7 @@ static void drawMenuItems()
             SSD1306_fillArea(0, line, sizeof(Graphics_ArrowRightIcon), 1, SSD1306_COLOR_BLACK);
         }
 
-        uint8_t x = Text_draw(MenuItems[itemIndex], line, sizeof(Graphics_ArrowRightIcon) + 2, 0, false);
+        uint8_t x = Graphics_drawLabel(MenuItems[itemIndex], line, sizeof(Graphics_ArrowRightIcon) + 2);
         if (x < (127 - sizeof(PositionIndicatorEmpty))) {
             SSD1306_fillArea(x, line, 127 - x - sizeof(PositionIndicatorEmpty), 1, SSD1306_COLOR_BLACK);
         }
@@ -106,7 +104,7 @@ void Settings_MenuScreen_init()
 void Settings_MenuScreen_update(const bool redraw)
 {
     if (redraw) {
-        Graphics_DrawScreenTitle("SETTINGS");
+        Graphics_drawScreenTitle(Label_Settings);
         Graphics_DrawKeypadHelpBar(Graphics_ExitIcon, Graphics_ArrowDownIcon, Graphics_SelectIcon);
 
         drawMenuItems();
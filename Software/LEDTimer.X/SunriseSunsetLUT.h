@@ -0,0 +1,29 @@
+// Made by SunriseSunsetLUTGenerator, do not edit.
+
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SunriseSunsetLUT_Harmonics          (3)
+#define SunriseSunsetLUT_Coefficients       (1 + 2 * SunriseSunsetLUT_Harmonics)
+#define SunriseSunsetLUT_LocationCount      (8)
+
+// Fourier series of the sunrise and sunset times over the 366 days of a
+// leap year: c[0] + sum(c[2k - 1] * cos(k * w) + c[2k] * sin(k * w)),
+// where w = 2 * pi * day / 366. The coefficients are minutes from
+// midnight in UTC with 4 fraction bits.
+typedef struct {
+    const char* name;
+    int16_t sunrise[SunriseSunsetLUT_Coefficients];
+    int16_t sunset[SunriseSunsetLUT_Coefficients];
+} SunriseSunsetLUT_Location;
+
+extern const SunriseSunsetLUT_Location SunriseSunsetLUT_locations[SunriseSunsetLUT_LocationCount];
+
+#ifdef __cplusplus
+}
+#endif
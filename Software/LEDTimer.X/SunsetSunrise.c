@@ -22,58 +22,74 @@
 */
 
 #include "Clock.h"
+#include "FixedPoint.h"
 #include "Settings.h"
 #include "SunsetSunrise.h"
 
-static struct SunriseSunsetContext {
+static Utils_InstanceStorage struct SunriseSunsetContext {
     Clock_Time sunrise;
     Clock_Time sunset;
 } context;
 
-#if !SUNRISE_SUNSET_USE_LUT
-#include <math.h>
-
-#define COS_SUN_ANGLE_BELOW_HORIZON (-0.014538080502497)    // cos(rad(90.833))
-#define DEG_TO_RAD_FACTOR           (0.017453292519943)     // Pi / 180
-#define RAD_TO_DEG_FACTOR           (57.295779513082321)    // 180 / Pi
-
-static double rad(const double deg)
-{
-    return deg * DEG_TO_RAD_FACTOR;
-}
-
-static double deg(const double rad)
+static Clock_Time wrapAroundMidnight(Clock_Time minutes)
 {
-    return rad * RAD_TO_DEG_FACTOR;
-}
+    if (minutes < 0) {
+        minutes += 24 * 60;
+    } else if (minutes >= 24 * 60) {
+        minutes -= 24 * 60;
+    }
 
-static double quadrant(const double deg)
-{
-    return 90 * floor(deg / 90);
+    return minutes;
 }
 
-static double clamp(const double deg)
+#if !SUNRISE_SUNSET_USE_LUT
+/*
+ * Fixed-point implementation of the calculation. Linear quantities are
+ * 32-bit values with 16 fraction bits (degrees, hours, days), angles of the
+ * trigonometric functions are binary angles where 65536 is a full turn.
+ * Sine, cosine and arc tangent are calculated with the CORDIC iterations
+ * of FixedPoint.c.
+ */
+
+typedef FixedPoint_Angle Angle;
+
+#define Q16_DAY_HOURS               (24l * FixedPoint_One)
+
+// Constants of the algorithm with 16 fraction bits
+#define COS_SUN_ANGLE_BELOW_HORIZON (-953l)         // cos(rad(90.833))
+#define MEAN_ANOMALY_DEG_PER_DAY    (64592l)        // 0.9856
+#define MEAN_ANOMALY_OFFSET_DEG     (215548l)       // 3.289
+#define CENTER_EQUATION_1_DEG       (125567l)       // 1.916
+#define CENTER_EQUATION_2_DEG       (1311l)         // 0.02
+#define PERIHELION_LONGITUDE_DEG    (18522702l)     // 282.634
+#define OBLIQUITY_COS               (60138l)        // 0.91764
+#define OBLIQUITY_SIN               (26072l)        // 0.39782
+#define SIDEREAL_TIME_OFFSET_HOURS  (433979l)       // 6.622
+
+// 0.06571 hours per day with 20 fraction bits
+#define SIDEREAL_TIME_HOURS_PER_DAY_Q20 (68902l)
+
+static Angle degreesToAngle(const int32_t degrees)
 {
-    return deg - 360 * floor(deg / 360);
+    // Wraps around to a full turn
+    return (Angle)((degrees + (degrees < 0 ? -180 : 180)) / 360);
 }
 
 void SunriseSunset_setPosition(
     SunriseSunsetData* const data,
-    const double longitude,
-    const double latitude
+    const int32_t longitude,
+    const int32_t latitude
 ) {
-    double latitudeRad = rad(latitude);
-    data->latitudeCos = cos(latitudeRad);
-    data->latitudeSin = sin(latitudeRad);
+    FixedPoint_sinCos(degreesToAngle(latitude), &data->latitudeSin, &data->latitudeCos);
     data->longitudeHour = longitude / 15;
 }
 
 void SunriseSunset_setTimeZone(
     SunriseSunsetData* const data,
-    const int8_t timeZoneOffset,
+    const int8_t timeZoneOffsetHalfHours,
     const bool dst
 ) {
-    data->timeOffset = timeZoneOffset + (dst ? 1 : 0);
+    data->timeOffsetMinutes = timeZoneOffsetHalfHours * 30 + (dst ? 60 : 0);
 }
 
 Clock_Time SunriseSunset_calculate(
@@ -81,59 +97,111 @@ Clock_Time SunriseSunset_calculate(
     const bool sunset,
     const uint16_t dayOfYear
 ) {
-    double t = dayOfYear + ((sunset ? 18 : 6) - data->longitudeHour) / 24;
-
-    // Mean anomaly
-    double mDeg = 0.9856 * t - 3.289;
-    double mRad = rad(mDeg);
-
-    // True latitude of the Sun
-    double lDeg = clamp(mDeg + 1.916 * sin(mRad) + 0.02 * sin(2 * mRad) + 282.634);
-    double lRad = rad(lDeg);
-
-    // Right ascension
-    double ra1Deg = clamp(deg(atan(0.91764 * tan(lRad))));
-    double raDeg = ra1Deg + quadrant(lDeg) - quadrant(ra1Deg);
+    int32_t t = ((int32_t)dayOfYear << 16)
+        + (((int32_t)(sunset ? 18 : 6) << 16) - data->longitudeHour) / 24;
 
-    double sunDeclinationRad = asin(0.39782 * sin(lRad));
+    int32_t unused;
 
-    double hourAngleDeg = deg(
-        acos(
-            (COS_SUN_ANGLE_BELOW_HORIZON - sin(sunDeclinationRad) * data->latitudeSin)
-            / (cos(sunDeclinationRad) * data->latitudeCos)
-        )
+    // Mean anomaly
+    int32_t mDeg = FixedPoint_multiply(t, MEAN_ANOMALY_DEG_PER_DAY) - MEAN_ANOMALY_OFFSET_DEG;
+    Angle m = degreesToAngle(mDeg);
+
+    int32_t mSin;
+    int32_t m2Sin;
+    FixedPoint_sinCos(m, &mSin, &unused);
+    FixedPoint_sinCos((Angle)(m << 1), &m2Sin, &unused);
+
+    // True longitude of the Sun
+    Angle l = degreesToAngle(
+        mDeg
+        + FixedPoint_multiply(CENTER_EQUATION_1_DEG, mSin)
+        + FixedPoint_multiply(CENTER_EQUATION_2_DEG, m2Sin)
+        + PERIHELION_LONGITUDE_DEG
     );
 
-    if (!sunset) {
-        hourAngleDeg = 360 - hourAngleDeg;
+    int32_t lSin;
+    int32_t lCos;
+    FixedPoint_sinCos(l, &lSin, &lCos);
+
+    // Right ascension, in the same quadrant as the true longitude
+    Angle ra = FixedPoint_arcTan2(FixedPoint_multiply(OBLIQUITY_COS, lSin), lCos);
+
+    // Declination, cos = sqrt(1 - sin^2) calculated with 15 fraction bits
+    int32_t declinationSin = FixedPoint_multiply(OBLIQUITY_SIN, lSin);
+    int32_t declinationSinHalf = declinationSin >> 1;
+    int32_t declinationCos = (int32_t)FixedPoint_squareRoot(
+        (1ul << 30) - (uint32_t)(declinationSinHalf * declinationSinHalf)
+    ) << 1;
+
+    // Hour angle, acos(n / d) = atan2(sqrt(d^2 - n^2), n)
+    int32_t n = COS_SUN_ANGLE_BELOW_HORIZON - FixedPoint_multiply(declinationSin, data->latitudeSin);
+    int32_t d = FixedPoint_multiply(declinationCos, data->latitudeCos);
+
+    Angle hourAngle;
+
+    if (n >= d) {
+        // The Sun doesn't rise on this day
+        hourAngle = 0;
+    } else if (n <= -d) {
+        // The Sun doesn't set on this day
+        hourAngle = FixedPoint_Angle180;
+    } else {
+        int32_t nHalf = n >> 1;
+        int32_t dHalf = d >> 1;
+        hourAngle = FixedPoint_arcTan2(
+            (int32_t)FixedPoint_squareRoot((uint32_t)(dHalf * dHalf - nHalf * nHalf)),
+            nHalf
+        );
     }
 
-    double localTime = hourAngleDeg / 15 + raDeg / 15 - 0.06571 * t - 6.622 - data->longitudeHour;
+    if (!sunset) {
+        hourAngle = (Angle)(0u - hourAngle);
+    }
 
-    double adjustedTime = localTime + data->timeOffset;
-    adjustedTime = (adjustedTime - 24 * floor(adjustedTime / 24));
+    // UTC in hours, a full turn of the angles is 24 hours
+    int32_t time = ((int32_t)hourAngle + ra) * 24
+        - (FixedPoint_multiply(t, SIDEREAL_TIME_HOURS_PER_DAY_Q20) >> 4)
+        - SIDEREAL_TIME_OFFSET_HOURS
+        - data->longitudeHour;
 
-    uint8_t hour = (uint8_t)(floor(adjustedTime));
-    uint8_t minute = (uint8_t)(round((adjustedTime - hour) * 60.0));
+    time %= Q16_DAY_HOURS;
+    if (time < 0) {
+        time += Q16_DAY_HOURS;
+    }
 
     // Convert to minutes since midnight
-    return (Clock_Time)hour * 60 + minute;
+    return wrapAroundMidnight(
+        (Clock_Time)((time * 60 + 0x8000) >> 16) + data->timeOffsetMinutes
+    );
 }
 #else
-extern const uint8_t SunriseSunsetLUT[366][2];
-
 Clock_Time SunriseSunset_calculate(
+    const uint8_t location,
     const bool sunset,
     const uint16_t dayOfYear
 ) {
-    if (dayOfYear >= 365) {
-        return 0;
-    }
+    const int16_t* coefficients = sunset
+        ? SunriseSunsetLUT_locations[location].sunset
+        : SunriseSunsetLUT_locations[location].sunrise;
+
+    // Position in the year as a binary angle
+    FixedPoint_Angle angle = (FixedPoint_Angle)(((uint32_t)dayOfYear << 16) / 366);
 
-    Clock_Time t = (Clock_Time)SunriseSunsetLUT[dayOfYear][sunset ? 1 : 0] * 6;
-    t += Settings_data.time.timeZoneOffsetHalfHours * 30;
+    // Minutes with 4 fraction bits
+    int32_t t = *coefficients++;
 
-    return t;
+    for (uint8_t k = 1; k <= SunriseSunsetLUT_Harmonics; ++k) {
+        int32_t sin;
+        int32_t cos;
+        FixedPoint_sinCos((FixedPoint_Angle)(angle * k), &sin, &cos);
+
+        t += FixedPoint_multiply(*coefficients++, cos);
+        t += FixedPoint_multiply(*coefficients++, sin);
+    }
+
+    return wrapAroundMidnight(
+        (Clock_Time)((t + 8) >> 4) + Settings_data.time.timeZoneOffsetHalfHours * 30
+    );
 }
 #endif
 
@@ -154,32 +222,41 @@ void SunriseSunset_update()
 
     SunriseSunset_setPosition(
         &data,
-        Types_bcdToDouble(
-            Settings_data.location.latitudeBcd,
-            Settings_data.location.latitudeSign
-        ),
-        Types_bcdToDouble(
+        Types_bcdToFixedPoint(
             Settings_data.location.longitudeBcd,
             Settings_data.location.longitudeSign
+        ),
+        Types_bcdToFixedPoint(
+            Settings_data.location.latitudeBcd,
+            Settings_data.location.latitudeSign
         )
     );
 
-    // TODO get time zone data from settings
-    SunriseSunset_setTimeZone(&data, 1, false);
+    SunriseSunset_setTimeZone(&data, Settings_data.time.timeZoneOffsetHalfHours, false);
+#else
+    uint8_t location = Settings_data.location.index;
+    if (location >= SunriseSunsetLUT_LocationCount) {
+        location = 0;
+    }
 #endif
 
     uint16_t dayOfYear = Clock_getDayOfYear();
 
 #if SUNRISE_SUNSET_USE_LUT
-    // Adjust the index for non-leap years after February 29th
-    if (!Clock_isLeapYear() && dayOfYear > 59) {
+    // Adjust the index for non-leap years from March 1st (index of February 29th)
+    if (!Clock_isLeapYear() && dayOfYear >= 59) {
         dayOfYear += 1;
     }
+#else
+    // The algorithm counts the days from 1
+    dayOfYear += 1;
 #endif
 
     context.sunrise = SunriseSunset_calculate(
 #if !SUNRISE_SUNSET_USE_LUT
         &data,
+#else
+        location,
 #endif
         false,
         dayOfYear
@@ -188,6 +265,8 @@ void SunriseSunset_update()
     context.sunset = SunriseSunset_calculate(
 #if !SUNRISE_SUNSET_USE_LUT
         &data,
+#else
+        location,
 #endif
         true,
         dayOfYear
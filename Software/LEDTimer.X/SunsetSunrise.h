@@ -32,32 +32,59 @@ typedef struct {
     uint8_t minute;
 } SunriseSunset_Time;
 
+// Position and time zone for the calculation, fixed-point values have 16
+// fraction bits
 typedef struct {
-    double latitudeCos;
-    double latitudeSin;
-    double longitudeHour;
-    int8_t timeOffset;
+    int32_t latitudeSin;
+    int32_t latitudeCos;
+    int32_t longitudeHour;
+    int16_t timeOffsetMinutes;
 } SunriseSunsetData;
 
+/**
+ * @param longitude Fixed-point degrees (16 fraction bits), positive for East
+ * @param latitude Fixed-point degrees (16 fraction bits), positive for North
+ */
 void SunriseSunset_setPosition(
     SunriseSunsetData* data,
-    double longitude,
-    double latitude
+    int32_t longitude,
+    int32_t latitude
 );
 
+/**
+ * @param timeZoneOffsetHalfHours Offset from UTC in 30 minute units
+ * @param dst Adds one hour to the offset
+ */
 void SunriseSunset_setTimeZone(
     SunriseSunsetData* data,
-    int8_t timeZoneOffset,
+    int8_t timeZoneOffsetHalfHours,
     bool dst
 );
 
+/**
+ * Calculates the time of the event with 32-bit fixed-point arithmetic
+ * and CORDIC iterations, the run time doesn't depend on the input.
+ *
+ * @param dayOfYear Day of the year, 1 for January 1st
+ * @return Minutes since midnight in local time
+ */
 Clock_Time SunriseSunset_calculate(
     SunriseSunsetData* data,
     bool sunset,
     uint16_t dayOfYear
 );
 #else
+#include "SunriseSunsetLUT.h"
+
+/**
+ * Decodes the time of the event from the compressed table.
+ *
+ * @param location Index in SunriseSunsetLUT_locations
+ * @param dayOfYear Index in the 366 days of a leap year
+ * @return Minutes since midnight in local time
+ */
 Clock_Time SunriseSunset_calculate(
+    uint8_t location,
     bool sunset,
     uint16_t dayOfYear
 );
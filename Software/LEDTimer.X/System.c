@@ -20,6 +20,7 @@
 
 #include "Clock.h"
 #include "Config.h"
+#include "SSD1306.h"
 #include "System.h"
 
 #include "mcc_generated_files/adc.h"
@@ -211,7 +212,7 @@ System_SleepResult System_sleep()
 #endif
 
     // Send out all the data before going to sleep
-    while (UART1MD == 0 && TRMT == 0);
+    while (PMD4bits.UART1MD == 0 && TX1STAbits.TRMT == 0);
 
     // Disable the FVR to conserve power
     FVRCONbits.FVREN = 0;
@@ -225,6 +226,9 @@ System_SleepResult System_sleep()
     UI_updateDebugDisplay();
 #endif
 
+    // The MSSP stops in Sleep, finish the pending display transfers
+    SSD1306_flush();
+
     SLEEP();
 
     // The next instruction will always be executed before the ISR
@@ -99,7 +99,7 @@ void System_onWakeUp(System_WakeUpReason reason);
  * Returns the last reason why the system was woken up from sleep mode.
  * @return Reason why the system woke up from sleep.
  */
-inline System_WakeUpReason System_getLastWakeUpReason();
+Utils_Inline System_WakeUpReason System_getLastWakeUpReason();
 
 /**
  * Puts the MCU into sleep mode. The system wakes up if there is an external
@@ -113,7 +113,7 @@ System_SleepResult System_sleep(void);
  * logic level of the LDO_SENSE input.
  * @return True: running from backup battery, false; running from main power
  */
-inline bool System_isRunningFromBackupBattery();
+Utils_Inline bool System_isRunningFromBackupBattery();
 
 /**
  * Returns the estimated VDD voltage of the MCU. It;s measured via the ADC
@@ -137,4 +137,4 @@ uint16_t System_getVBatMilliVolts(void);
  * is far from linear, the value is only a rough indication of its state.
  * @return A value from 0 to 10.
  */
-inline uint8_t System_getBatteryLevel(void);
\ No newline at end of file
+Utils_Inline uint8_t System_getBatteryLevel(void);
\ No newline at end of file
@@ -1031,29 +1031,36 @@ uint8_t Text_draw(
         return x;
     }
 
-    SSD1306_enablePageAddressing();
-    SSD1306_setPage(line);
+    // Every character (including space) has the same advance, characters
+    // are drawn while they start on the screen
+    static const uint8_t Advance =
+        ASCIIReduced_CharWidth + ASCIIReduced_CharSpacing;
+
+    uint8_t count = (uint8_t)(SSD1306_LCDWIDTH - x + Advance - 1) / Advance;
+    if (count > length) {
+        count = length;
+    }
+
+    // Columns which don't fit on the screen are not sent
+    uint8_t columns = SSD1306_LCDWIDTH - x;
+    if (count * Advance < columns) {
+        columns = count * Advance;
+    }
 
     uint8_t sendFlags = SSD1306_SEND_BITSHIFT(yOffset);
     if (invert) {
         sendFlags |= SSD1306_SEND_INVERT;
     }
 
-    for (uint8_t i = length; i > 0; --i) {
-        // Stop if the next character won't fit
-        if (x > SSD1306_LCDWIDTH - 1) {
-            return x;
-        }
-
-        SSD1306_setStartColumn(x);
+    // Draw the whole run with a single data transfer
+    SSD1306_setPosition(line, x);
+    SSD1306_beginData(columns, sendFlags);
 
+    for (uint8_t i = count; i > 0; --i) {
         char c = (char)toupper(*s++);
 
         if (c == ' ') {
-            for (uint8_t j = ASCIIReduced_SpaceWidth; j > 0; --j) {
-                const uint8_t data = 0;
-                SSD1306_sendData2(&data, 1, sendFlags);
-            }
+            SSD1306_streamFill(0, ASCIIReduced_SpaceWidth);
         } else {
             const uint8_t* charData;
 
@@ -1066,21 +1073,102 @@ uint8_t Text_draw(
                 charData = ASCIIReduced[c - '!'];
             }
 
-            // Send data to the display
-            SSD1306_sendData2(charData, ASCIIReduced_CharWidth, sendFlags);
+            SSD1306_streamData(charData, ASCIIReduced_CharWidth);
         }
 
-        x += ASCIIReduced_CharWidth;
-
         // Clear the pixels between the characters
-        for (uint8_t j = ASCIIReduced_CharSpacing; j > 0; --j) {
-            static const uint8_t data = 0;
-            SSD1306_sendData2(&data, 1, sendFlags);
-            ++x;
+        SSD1306_streamFill(0, ASCIIReduced_CharSpacing);
+    }
+
+    SSD1306_endData();
+
+    return x + count * Advance;
+}
+
+typedef struct
+{
+    // Column data of the glyph in the current page, if NULL, the glyph
+    // columns are filled with the pattern
+    const uint8_t* data;
+    uint8_t pattern;
+    uint8_t width;
+    uint8_t spacing;
+} Text_Glyph7Seg;
+
+static Text_Glyph7Seg glyph7Seg(
+    const char c,
+    const uint8_t page,
+    const bool last
+)
+{
+    Text_Glyph7Seg glyph = {
+        .data = 0,
+        .pattern = 0,
+        .width = Numbers7Seg_CharWidth,
+        .spacing = last ? 0 : Numbers7Seg_CharSpacing
+    };
+
+    if (c >= '0' && c <= '9') {
+        glyph.data = Numbers7Seg[c - '0'][page];
+    } else if (c == ':') {
+        glyph.data = Colon7Seg[page];
+        glyph.width = Colon7Seg_CharWidth;
+    } else if (c == '-') {
+        // Cost-efficient dash symbol
+        if (page == 1) {
+            glyph.pattern = 0b00011100;
+        }
+        glyph.width = Numbers7Seg_CharWidth - 5;
+        glyph.spacing = Numbers7Seg_CharSpacing;
+    } else if (c == '+') {
+        if (page == 1) {
+            glyph.data = Plus7Seg;
         }
+        glyph.width = Plus7Seg_CharWidth;
+        glyph.spacing = Numbers7Seg_CharSpacing;
+    }
+
+    return glyph;
+}
+
+// Draws the characters from `first` to `last` (exclusive) of a 7-segment
+// run, starting at column x
+static void drawRun7Seg(
+    const char* number,
+    const uint8_t length,
+    const uint8_t first,
+    const uint8_t last,
+    const uint8_t line,
+    const uint8_t x,
+    const uint8_t sendFlags
+)
+{
+    uint8_t columns = 0;
+
+    for (uint8_t i = first; i < last; ++i) {
+        Text_Glyph7Seg glyph = glyph7Seg(number[i], 0, i == length - 1);
+        columns += glyph.width + glyph.spacing;
     }
 
-    return x;
+    // Draw each page of the run with a single data transfer
+    for (uint8_t page = 0; page < Numbers7Seg_Pages; ++page) {
+        SSD1306_setPosition(line + page, x);
+        SSD1306_beginData(columns, sendFlags);
+
+        for (uint8_t i = first; i < last; ++i) {
+            Text_Glyph7Seg glyph = glyph7Seg(number[i], page, i == length - 1);
+
+            if (glyph.data) {
+                SSD1306_streamData(glyph.data, glyph.width);
+            } else {
+                SSD1306_streamFill(glyph.pattern, glyph.width);
+            }
+
+            SSD1306_streamFill(0, glyph.spacing);
+        }
+
+        SSD1306_endData();
+    }
 }
 
 uint8_t Text_draw7Seg(
@@ -1095,83 +1183,165 @@ uint8_t Text_draw7Seg(
         return x;
     }
 
-    uint8_t sendFlags = 0;
-    if (invert) {
-        sendFlags |= SSD1306_SEND_INVERT;
-    }
-
-    SSD1306_enablePageAddressing();
+    // Lay out the run to find the characters which fit on the screen
+    uint8_t count = 0;
+    uint8_t columns = 0;
 
-    for (uint8_t i = length; i > 0; --i) {
+    for (; count < length; ++count) {
         // Stop if the next character won't fit
-        if (x + Numbers7Seg_CharWidth + 1 > SSD1306_LCDWIDTH - 1) {
-            return x;
+        if (x + columns + Numbers7Seg_CharWidth + 1 > SSD1306_LCDWIDTH - 1) {
+            break;
         }
 
-        char c = *number++;
-
-        if (c != ' ') {
-            if (c == '-') {
-                SSD1306_setStartColumn(x);
-                SSD1306_setPage(line + 1);
+        Text_Glyph7Seg glyph = glyph7Seg(number[count], 0, count == length - 1);
+        columns += glyph.width + glyph.spacing;
+    }
 
-                // Cost-efficient dash symbol
-                uint8_t charData = 0b00011100;
-                for (uint8_t j = Numbers7Seg_CharWidth - 5; j > 0; --j) {
-                    SSD1306_sendData2(&charData, 1, sendFlags);
-                }
+    if (count > 0) {
+        drawRun7Seg(
+            number,
+            length,
+            0,
+            count,
+            line,
+            x,
+            invert ? SSD1306_SEND_INVERT : 0
+        );
+    }
 
-                x += Numbers7Seg_CharWidth - 5 + Numbers7Seg_CharSpacing;
-            } else if (c == '+') {
-                SSD1306_setStartColumn(x);
-                SSD1306_setPage(line + 1);
-                SSD1306_sendData2(Plus7Seg, sizeof(Plus7Seg), sendFlags);
+    return x + columns;
+}
 
-                x += Plus7Seg_CharWidth + Numbers7Seg_CharSpacing;
-            } else {
-                uint8_t width = Numbers7Seg_CharWidth;
+// Clears the columns of a wider text drawn the last time at the same position
+static void clearTail7Seg(
+    const uint8_t line,
+    const uint8_t endX,
+    const uint8_t previousEndX,
+    const bool invert
+)
+{
+    if (endX < previousEndX) {
+        SSD1306_fillArea(
+            endX,
+            line,
+            previousEndX - endX,
+            Numbers7Seg_Pages,
+            invert ? 1 : 0
+        );
+    }
+}
 
-                // Draw the pages of the character
-                for (uint8_t page = 0; page < Numbers7Seg_Pages; ++page) {
-                    SSD1306_setPage(line + page);
-                    SSD1306_setStartColumn(x);
+void Text_invalidate7SegCache(Text_7SegCache* cache)
+{
+    cache->text[0] = 0;
+}
 
-                    const uint8_t* charData = 0;
+uint8_t Text_draw7SegCached(
+    const char* number,
+    const uint8_t line,
+    const uint8_t x,
+    const bool invert,
+    Text_7SegCache* cache
+) {
+    uint8_t length = (uint8_t)strlen(number);
 
-                    if (c >= '0' && c <= '9') {
-                        charData = Numbers7Seg[c - '0'][page];
-                    } else if (c == ':') {
-                        width = Colon7Seg_CharWidth;
-                        charData = Colon7Seg[page];
-                    }
+    if (length == 0 || line > (7 - Numbers7Seg_Pages) || x > 127) {
+        return x;
+    }
 
-                    SSD1306_sendData2(charData, width, sendFlags);
-                }
+    if (
+        length >= Text_7SegCacheSize
+        || length != (uint8_t)strlen(cache->text)
+        || line != cache->line
+        || x != cache->x
+        || invert != cache->invert
+    ) {
+        // The layout differs from the last one, draw the whole text
+        const uint8_t endX = Text_draw7Seg(number, line, x, invert);
 
-                x += width;
+        if (
+            cache->text[0] != 0
+            && line == cache->line
+            && x == cache->x
+            && invert == cache->invert
+        ) {
+            clearTail7Seg(line, endX, cache->endX, invert);
+        }
 
-                if (i > 1) {
-                    x += Numbers7Seg_CharSpacing;
-                }
-            }
+        if (length < Text_7SegCacheSize) {
+            strcpy(cache->text, number);
+            cache->line = line;
+            cache->x = x;
+            cache->endX = endX;
+            cache->invert = invert;
         } else {
-            for (uint8_t page = 0; page < Numbers7Seg_Pages; ++page) {
-                SSD1306_setPage(line + page);
-                SSD1306_setStartColumn(x);
+            Text_invalidate7SegCache(cache);
+        }
+
+        return endX;
+    }
 
-                uint8_t charData[Numbers7Seg_CharWidth] = { 0 };
-                SSD1306_sendData2(charData, sizeof(charData), sendFlags);
+    // Find the changed characters which fit on the screen
+    uint8_t count = 0;
+    uint8_t columns = 0;
+    uint8_t first = 0xFF;
+    uint8_t last = 0;
+    uint8_t firstX = x;
+    bool shifted = false;
+
+    for (; count < length; ++count) {
+        // Stop if the next character won't fit
+        if (x + columns + Numbers7Seg_CharWidth + 1 > SSD1306_LCDWIDTH - 1) {
+            break;
+        }
+
+        const bool lastChar = count == length - 1;
+        Text_Glyph7Seg glyph = glyph7Seg(number[count], 0, lastChar);
+
+        if (number[count] != cache->text[count]) {
+            if (first == 0xFF) {
+                first = count;
+                firstX = x + columns;
             }
 
-            x += Numbers7Seg_CharWidth;
+            last = count + 1;
+
+            Text_Glyph7Seg previous = glyph7Seg(cache->text[count], 0, lastChar);
 
-            if (i > 1) {
-                x += Numbers7Seg_CharSpacing;
+            // The characters after a glyph with different size move
+            if (previous.width + previous.spacing != glyph.width + glyph.spacing) {
+                shifted = true;
             }
         }
+
+        columns += glyph.width + glyph.spacing;
     }
 
-    return x;
+    strcpy(cache->text, number);
+
+    if (shifted) {
+        last = count;
+    }
+
+    if (first < last) {
+        drawRun7Seg(
+            number,
+            length,
+            first,
+            last,
+            line,
+            firstX,
+            invert ? SSD1306_SEND_INVERT : 0
+        );
+    }
+
+    if (shifted) {
+        clearTail7Seg(line, x + columns, cache->endX, invert);
+    }
+
+    cache->endX = x + columns;
+
+    return x + columns;
 }
 
 uint8_t Text_calculateWidth(const char* s)
@@ -1199,22 +1369,12 @@ uint8_t Text_calculateWidth7Seg(const char* s)
 {
     uint8_t width = 0;
 
+    // Measured with the glyphs of the renderer, so the result is the same
+    // as the run drawn by Text_draw7Seg()
     while (*s) {
-        char c = *s++;
-
-        if ((c >= '0' && c <= '9') || c == ' ') {
-            width += Numbers7Seg_CharWidth;
-        } else if (c == ':') {
-            width += Colon7Seg_CharWidth;
-        } else if (c == '-') {
-            width += Numbers7Seg_CharWidth - 2;
-        } else if (c == '+') {
-            width += Plus7Seg_CharWidth;
-        }
-
-        if (*s != 0) {
-            width += Numbers7Seg_CharSpacing;
-        }
+        const char c = *s++;
+        Text_Glyph7Seg glyph = glyph7Seg(c, 0, *s == 0);
+        width += glyph.width + glyph.spacing;
     }
 
     return width;
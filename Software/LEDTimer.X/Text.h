@@ -23,6 +23,10 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 /**
  * Draws a text with the default font.
  * @param s Input string
@@ -54,6 +58,48 @@ uint8_t Text_draw7Seg(
     bool invert
 );
 
+// Longest text (including the terminator) kept by Text_7SegCache
+#define Text_7SegCacheSize 6
+
+/**
+ * Text drawn the last time by Text_draw7SegCached() at a call site
+ */
+typedef struct
+{
+    char text[Text_7SegCacheSize];
+    uint8_t line;
+    uint8_t x;
+    uint8_t endX;
+    bool invert;
+} Text_7SegCache;
+
+/**
+ * Draws a text with large 7-Segment LCD font, sending only the characters
+ * which changed since the last call with the same cache. The whole text is
+ * drawn if the position or the length of the text changes. The columns left
+ * over from a wider previous text at the same position are cleared.
+ * @param number String with the following characters allowed: 0-9, -, <space>, :
+ * @param line Position of the text from the top, measured in pages (8 pixels)
+ * @param x Position of the text from the left
+ * @param invert Set to True to draw the text inverted
+ * @param cache Text drawn the last time at the call site
+ * @return Position of the end of the text from the left
+ */
+uint8_t Text_draw7SegCached(
+    const char* number,
+    uint8_t line,
+    uint8_t x,
+    bool invert,
+    Text_7SegCache* cache
+);
+
+/**
+ * Forces the next Text_draw7SegCached() call to draw the whole text,
+ * e.g. after the screen was cleared.
+ * @param cache Text drawn the last time at the call site
+ */
+void Text_invalidate7SegCache(Text_7SegCache* cache);
+
 uint8_t Text_calculateWidth(const char* s);
 
 uint8_t Text_calculateWidth7Seg(const char* s);
@@ -76,4 +122,8 @@ uint8_t Text_calculateWidth7Seg(const char* s);
 
 #define CenterHelpText(_Text) CenterText((_Text), 0)
 
-#define RightHelpText(_Text) RightText((_Text), 0)
\ No newline at end of file
+#define RightHelpText(_Text) RightText((_Text), 0)
+
+#ifdef __cplusplus
+}
+#endif
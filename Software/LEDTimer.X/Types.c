@@ -55,21 +55,25 @@ void Types_setScheduleSegmentBit(
     }
 }
 
-double Types_bcdToDouble(const uint32_t bcd, const bool negative)
+int32_t Types_bcdToFixedPoint(const uint32_t bcd, const bool negative)
 {
-    double result = 0;
-    double multiplier = 100; // First 3 digits are the integer part
+    uint16_t integer = 0;
+    uint32_t fraction = 0;
 
+    // First 3 digits are the integer part, the last 5 are the fraction
     for (uint8_t i = 8; i > 0; --i) {
         uint8_t offset = (i - 1) * 4;
-        uint32_t mask = (uint32_t)(0b1111u) << offset;
-        result += (double)((bcd & mask) >> offset) * multiplier;
-        multiplier /= 10;
-    }
+        uint8_t digit = (uint8_t)((bcd >> offset) & 0b1111u);
 
-    if (negative) {
-        result *= -1;
+        if (i > 5) {
+            integer = integer * 10 + digit;
+        } else {
+            fraction = fraction * 10 + digit;
+        }
     }
 
-    return result;
+    // 65536 / 100000 = 2048 / 3125
+    int32_t result = ((int32_t)integer << 16) + (int32_t)((fraction * 2048 + 1562) / 3125);
+
+    return negative ? -result : result;
 }
\ No newline at end of file
@@ -35,7 +35,7 @@ typedef uint8_t ScheduleSegmentData[6];
  * @param minutes Elapsed minutes from midnight.
  * @return Segment index from 0 to 47.
  */
-inline uint8_t Types_calculateScheduleSegmentIndex(Clock_Time minutes);
+Utils_Inline uint8_t Types_calculateScheduleSegmentIndex(Clock_Time minutes);
 
 bool Types_getScheduleSegmentBit(
     const ScheduleSegmentData data,
@@ -48,4 +48,8 @@ void Types_setScheduleSegmentBit(
     bool value
 );
 
-double Types_bcdToDouble(uint32_t bcd, bool negative);
\ No newline at end of file
+/**
+ * Converts a BCD number with 3 integer and 5 fraction digits (e.g. a
+ * latitude or longitude) to a fixed-point value with 16 fraction bits.
+ */
+int32_t Types_bcdToFixedPoint(uint32_t bcd, bool negative);
\ No newline at end of file
@@ -157,9 +157,7 @@ void UI_updateDebugDisplay()
 {
     static const uint8_t Page = 1;
 
-    SSD1306_enablePageAddressing();
-    SSD1306_setStartColumn(0);
-    SSD1306_setPage(Page);
+    SSD1306_setPosition(Page, 0);
 
     // First column pixels:
     //  0: sleeping (white = true)
@@ -247,9 +245,7 @@ static void updateScreen(const bool redraw)
             break;
 
         case UI_Screen_Settings_Location:
-#if !SUNRISE_SUNSET_USE_LUT
             SettingsScreen_Location_update(redraw);
-#endif
             break;
 
         default:
@@ -439,6 +435,7 @@ void UI_keyEvent(uint8_t keyCode)
                     // Save settings
                     memcpy(&Settings_data, &context.modifiedSettings, sizeof(SettingsData));
                     updateDisplayContrast();
+                    OutputController_invalidateSchedule();
                     OutputController_updateState();
                     Settings_save();
                     SunriseSunset_update();
@@ -484,12 +481,10 @@ void UI_keyEvent(uint8_t keyCode)
                             SettingsScreen_DST_init(&context.modifiedSettings.dst);
                             switchToScreen(UI_Screen_Settings_DST);
                             break;
-#if !SUNRISE_SUNSET_USE_LUT
                         case 8:
                             SettingsScreen_Location_init(&context.modifiedSettings.location);
                             switchToScreen(UI_Screen_Settings_Location);
                             break;
-#endif
                         default:
                             break;
                     }
@@ -546,13 +541,11 @@ void UI_keyEvent(uint8_t keyCode)
             }
             break;
 
-#if !SUNRISE_SUNSET_USE_LUT
         case UI_Screen_Settings_Location:
             if (!SettingsScreen_Location_handleKeyPress(keyCode, hold)) {
                 switchToScreen(UI_Screen_Settings);
             }
             break;
-#endif
 
         default:
             break;
@@ -20,6 +20,8 @@
 
 #pragma once
 
+#include "Utils.h"
+
 #include <stdbool.h>
 #include <stdint.h>
 
@@ -71,4 +73,4 @@ typedef enum
     UI_ExternalEvent_OutputStateChanged =               (1 << 4)
 } UI_ExternalEvent;
 
-inline void UI_setExternalEvent(UI_ExternalEvent event);
\ No newline at end of file
+Utils_Inline void UI_setExternalEvent(UI_ExternalEvent event);
\ No newline at end of file
@@ -51,6 +51,136 @@ bool Date_isLeapYear(const YearsFrom1970 year)
     return (y % 4 == 0 && y % 100 != 0) || y % 400 == 0;
 }
 
+// Days from 1970-01-01 to the first day of the year
+static uint16_t daysBeforeYear(const YearsFrom1970 year)
+{
+    // Leap years from 1 AD to the end of the previous year
+    #define LeapYearsBefore(_Y) ((_Y) / 4 - (_Y) / 100 + (_Y) / 400)
+
+    uint16_t y = year + 1970 - 1;
+
+    return (uint16_t)(
+        365u * year
+        + LeapYearsBefore(y)
+        - LeapYearsBefore(1969u)
+    );
+}
+
+void Date_calendarFromEpoch(Date_Calendar* const calendar, const Date_Epoch epoch)
+{
+    uint16_t days = (uint16_t)(epoch / 86400u);
+    uint32_t secondOfDay = epoch - (uint32_t)days * 86400u;
+
+    calendar->hour = (uint8_t)(secondOfDay / 3600u);
+
+    uint16_t secondOfHour = (uint16_t)(secondOfDay - (uint32_t)calendar->hour * 3600u);
+
+    calendar->minute = (uint8_t)(secondOfHour / 60u);
+    calendar->second = (uint8_t)(secondOfHour - calendar->minute * 60u);
+
+    // 1970-01-01 was Thursday
+    calendar->weekday = (uint8_t)((days + 4u) % 7u);
+
+    calendar->year = 0;
+    calendar->leapYear = false;
+
+    while (true) {
+        uint16_t daysInYear = calendar->leapYear ? 366 : 365;
+
+        if (days < daysInYear) {
+            break;
+        }
+
+        days -= daysInYear;
+        calendar->leapYear = Date_isLeapYear(++calendar->year);
+    }
+
+    calendar->dayOfYear = days;
+    calendar->month = 1;
+
+    while (true) {
+        uint8_t daysInMonth = Date_lastDayOfMonth(calendar->month, calendar->leapYear);
+
+        if (days < daysInMonth) {
+            break;
+        }
+
+        days -= daysInMonth;
+        ++calendar->month;
+    }
+
+    calendar->day = (uint8_t)days + 1;
+}
+
+Date_Epoch Date_calendarToEpoch(const Date_Calendar* const calendar)
+{
+    // Days before the months in a non-leap year
+    static const uint16_t DaysBeforeMonth[12] = {
+        0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334
+    };
+
+    uint16_t days = daysBeforeYear(calendar->year)
+        + DaysBeforeMonth[calendar->month - 1]
+        + calendar->day - 1;
+
+    if (calendar->month > 2 && Date_isLeapYear(calendar->year)) {
+        ++days;
+    }
+
+    return (Date_Epoch)days * 86400u
+        + (uint32_t)calendar->hour * 3600u
+        + (uint16_t)calendar->minute * 60u
+        + calendar->second;
+}
+
+static void advanceCalendarDay(Date_Calendar* const calendar)
+{
+    if (++calendar->weekday > 6) {
+        calendar->weekday = 0;
+    }
+
+    ++calendar->dayOfYear;
+
+    if (++calendar->day <= Date_lastDayOfMonth(calendar->month, calendar->leapYear)) {
+        return;
+    }
+
+    calendar->day = 1;
+
+    if (++calendar->month <= 12) {
+        return;
+    }
+
+    calendar->month = 1;
+    calendar->dayOfYear = 0;
+    calendar->leapYear = Date_isLeapYear(++calendar->year);
+}
+
+void Date_advanceCalendar(Date_Calendar* const calendar, const uint8_t seconds)
+{
+    uint16_t second = calendar->second + seconds;
+
+    while (second >= 60) {
+        second -= 60;
+
+        if (++calendar->minute < 60) {
+            continue;
+        }
+
+        calendar->minute = 0;
+
+        if (++calendar->hour < 24) {
+            continue;
+        }
+
+        calendar->hour = 0;
+
+        advanceCalendarDay(calendar);
+    }
+
+    calendar->second = (uint8_t)second;
+}
+
 uint8_t Date_lastDayOfMonth(const uint8_t month, const bool leapYear)
 {
     static const uint8_t Days[12] = {
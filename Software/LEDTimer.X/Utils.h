@@ -28,6 +28,25 @@
 extern "C" {
 #endif
 
+/*
+ * Storage class of the module state. Empty on the device, the host
+ * simulators define it as thread-local to run a device on each thread.
+ */
+#ifndef Utils_InstanceStorage
+#define Utils_InstanceStorage
+#endif
+
+/*
+ * Specifier of the inline functions declared in the headers. XC8 uses C90
+ * inline semantics, the C++ sources of the host builds call the external
+ * definitions of the C modules instead.
+ */
+#ifdef __cplusplus
+#define Utils_Inline
+#else
+#define Utils_Inline inline
+#endif
+
 extern const char* Date_DayShortNames[7];
 extern const char* Date_MonthShortNames[12];
 
@@ -51,8 +70,47 @@ typedef struct {
     uint8_t endHour : 4;
 } Date_DstData;
 
+// Seconds since 1970-01-01 00:00:00
+typedef uint32_t Date_Epoch;
+
+typedef struct {
+    uint8_t second;         // 0..59
+    uint8_t minute;         // 0..59
+    uint8_t hour;           // 0..23
+    uint8_t day;            // 1..31
+    uint8_t month;          // 1..12
+    uint8_t weekday;        // 0..6, 0: Sunday
+    YearsFrom1970 year;
+    uint16_t dayOfYear;     // 0..365
+    bool leapYear;
+} Date_Calendar;
+
 bool Date_isLeapYear(YearsFrom1970 year);
 
+/**
+ * Calculates the calendar fields of a point in time. Uses 32-bit divisions,
+ * only needed when the time is set, Date_advanceCalendar() is cheaper
+ * for following the time.
+ * @param calendar Calendar to set
+ * @param epoch Seconds since 1970-01-01 00:00:00
+ */
+void Date_calendarFromEpoch(Date_Calendar* calendar, Date_Epoch epoch);
+
+/**
+ * Calculates the point in time of the calendar fields. The weekday and the
+ * day of the year are not used.
+ * @param calendar Calendar with valid date and time fields
+ * @return Seconds since 1970-01-01 00:00:00
+ */
+Date_Epoch Date_calendarToEpoch(const Date_Calendar* calendar);
+
+/**
+ * Moves the calendar forward with carrying the seconds to the other fields.
+ * @param calendar Calendar to advance
+ * @param seconds Elapsed seconds
+ */
+void Date_advanceCalendar(Date_Calendar* calendar, uint8_t seconds);
+
 uint8_t Date_lastDayOfMonth(uint8_t month, bool leapYear);
 
 int8_t Date_dayOfMonth(
@@ -0,0 +1,38 @@
+/*
+    This file is part of LEDTimer.
+
+    LEDTimer is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LEDTimer is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LEDTimer.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-17
+*/
+
+#include "Widget.h"
+
+void Widget_updateAll(
+    const Widget* widgets,
+    Widget_State* states,
+    uint8_t count,
+    const bool redraw
+)
+{
+    for (; count > 0; --count, ++widgets, ++states) {
+        Widget_State state = widgets->state();
+
+        if (redraw || state != *states) {
+            *states = state;
+            widgets->draw(redraw);
+        }
+    }
+}
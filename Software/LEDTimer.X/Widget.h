@@ -0,0 +1,69 @@
+/*
+    This file is part of LEDTimer.
+
+    LEDTimer is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    LEDTimer is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LEDTimer.  If not, see <http://www.gnu.org/licenses/>.
+
+    Author: Tamas Karpati
+    Created on 2026-10-17
+*/
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Retained screen widgets
+ *
+ * A widget describes its content with a state key (e.g. the displayed
+ * minute or battery level). The key of the last drawn content is stored
+ * by the screen and the widget is only drawn again if the key changes,
+ * so periodic screen updates cost no I2C traffic while nothing changes.
+ */
+
+typedef uint32_t Widget_State;
+
+typedef struct
+{
+    /** Returns the state key of the content to be displayed */
+    Widget_State (*state)(void);
+
+    /**
+     * Draws the content
+     * @param redraw True if the whole screen is being redrawn
+     */
+    void (*draw)(bool redraw);
+} Widget;
+
+/**
+ * Draws the widgets whose state changed since they were drawn the last time.
+ * @param widgets Widgets of the screen
+ * @param states Last drawn state keys of the widgets (one per widget)
+ * @param count Number of widgets
+ * @param redraw Draws every widget regardless of the state
+ */
+void Widget_updateAll(
+    const Widget* widgets,
+    Widget_State* states,
+    uint8_t count,
+    bool redraw
+);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,691 @@
+#define HOST_DEVICE_IMPLEMENTATION
+#include "xc.h"
+
+#include "Device.hpp"
+
+// Bus event encoding of the SSD1306 emulator
+#include "../tests/mock/xc.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+// Interrupt service routine of the firmware (main.c)
+extern "C" void isr(void);
+
+volatile Host_INTCON_t Host_INTCON;
+volatile Host_PIR0_t Host_PIR0;
+volatile Host_PIE0_t Host_PIE0;
+volatile Host_PIR1_t Host_PIR1;
+volatile Host_PIE1_t Host_PIE1;
+volatile Host_PIR2_t Host_PIR2;
+volatile Host_PIE2_t Host_PIE2;
+volatile Host_PORTA_t Host_PORTA;
+volatile Host_PORTC_t Host_PORTC;
+volatile Host_IOCAF_t Host_IOCAF;
+volatile Host_IOCCF_t Host_IOCCF;
+volatile Host_IOCAN_t Host_IOCAN;
+volatile Host_IOCAP_t Host_IOCAP;
+volatile Host_IOCCN_t Host_IOCCN;
+volatile Host_IOCCP_t Host_IOCCP;
+volatile Host_T1CON_t Host_T1CON;
+volatile Host_T2CON_t Host_T2CON;
+volatile Host_PR2_t Host_PR2;
+volatile Host_T4CON_t Host_T4CON;
+volatile Host_PR4_t Host_PR4;
+volatile Host_SSP1CON1_t Host_SSP1CON1;
+volatile Host_SSP1CON2_t Host_SSP1CON2;
+volatile Host_SSP1ADD_t Host_SSP1ADD;
+volatile Host_NVMCON1_t Host_NVMCON1;
+volatile Host_NVMADRL_t Host_NVMADRL;
+volatile Host_NVMADRH_t Host_NVMADRH;
+volatile Host_NVMDATL_t Host_NVMDATL;
+volatile Host_PWM5CON_t Host_PWM5CON;
+volatile Host_PWM5DCH_t Host_PWM5DCH;
+volatile Host_PWM5DCL_t Host_PWM5DCL;
+volatile Host_FVRCON_t Host_FVRCON;
+volatile Host_ADCON0_t Host_ADCON0;
+volatile Host_ADRESH_t Host_ADRESH;
+volatile Host_ADRESL_t Host_ADRESL;
+volatile Host_OSCCON3_t Host_OSCCON3;
+volatile Host_OSCSTAT1_t Host_OSCSTAT1;
+volatile Host_PMD4_t Host_PMD4;
+volatile Host_TX1STA_t Host_TX1STA;
+volatile Host_PCON0_t Host_PCON0;
+volatile Host_BORCON_t Host_BORCON;
+volatile Host_VREGCON_t Host_VREGCON;
+
+namespace host {
+
+namespace {
+
+// Cycles from the interrupt request to the first instruction of the ISR
+constexpr uint64_t InterruptLatencyCycles = 3;
+
+// 11.5 TAD with the dedicated RC oscillator (about 1.6 us)
+constexpr uint64_t AdcConversionCycles = 74;
+
+// Data EEPROM byte write time (4 ms)
+constexpr uint64_t EepromWriteCycles = Device::InstructionFrequencyHz / 250;
+
+constexpr uint8_t TimerPrescalers[] = { 1, 4, 16, 64 };
+
+constexpr uint8_t Tmr1On = 0x01;
+constexpr uint8_t Tmr2On = 0x04;
+
+constexpr uint8_t FvrChannel = 0x3F;
+constexpr uint16_t FvrMilliVolts = 1024;
+
+}
+
+Device::Device()
+{
+    m_eeprom.fill(0xFF);
+}
+
+Device& Device::instance()
+{
+    static Device device;
+    return device;
+}
+
+void Device::reset()
+{
+    const auto eeprom = m_eeprom;
+
+    *this = Device{};
+    m_eeprom = eeprom;
+
+    for (auto* reg : {
+        &Host_INTCON.value, &Host_PIR0.value, &Host_PIE0.value,
+        &Host_PIR1.value, &Host_PIE1.value, &Host_PIR2.value, &Host_PIE2.value,
+        &Host_PORTA.value, &Host_PORTC.value,
+        &Host_IOCAF.value, &Host_IOCCF.value, &Host_IOCAN.value,
+        &Host_IOCAP.value, &Host_IOCCN.value, &Host_IOCCP.value,
+        &Host_T1CON.value, &Host_T2CON.value, &Host_PR2.value,
+        &Host_T4CON.value, &Host_PR4.value,
+        &Host_SSP1CON1.value, &Host_SSP1CON2.value, &Host_SSP1ADD.value,
+        &Host_NVMCON1.value, &Host_NVMADRL.value, &Host_NVMADRH.value,
+        &Host_NVMDATL.value, &Host_PWM5CON.value, &Host_PWM5DCH.value,
+        &Host_PWM5DCL.value, &Host_FVRCON.value, &Host_ADCON0.value,
+        &Host_ADRESH.value, &Host_ADRESL.value, &Host_OSCCON3.value,
+        &Host_OSCSTAT1.value, &Host_PMD4.value, &Host_TX1STA.value,
+        &Host_PCON0.value, &Host_BORCON.value, &Host_VREGCON.value
+    }) {
+        *reg = 0;
+    }
+
+    // Released keys (pulled up), running from the external power input
+    Host_PORTA.bits.RA0 = 1;
+    Host_PORTA.bits.RA1 = 1;
+    Host_PORTC.bits.RC5 = 1;
+
+    // Power-on reset, stable oscillator, idle transmitter
+    Host_PCON0.value = 0x1D;
+    Host_BORCON.bits.BORRDY = 1;
+    Host_OSCCON3.bits.ORDY = 1;
+    Host_OSCSTAT1.bits.HFOR = 1;
+    Host_TX1STA.bits.TRMT = 1;
+}
+
+void Device::setStopTime(const uint64_t cycle, std::function<void()> handler)
+{
+    m_stopCycle = cycle;
+    m_stopHandler = std::move(handler);
+    updateNextEvent();
+}
+
+void Device::setInput(const Input input, const bool level)
+{
+    applyInput(input, level);
+}
+
+void Device::scheduleInput(const uint64_t cycle, const Input input, const bool level)
+{
+    m_inputEvents.emplace(cycle, std::make_pair(input, level));
+    updateNextEvent();
+}
+
+uint16_t Device::pwmDutyValue() const
+{
+    return static_cast<uint16_t>((Host_PWM5DCH.value << 2) | (Host_PWM5DCL.value >> 6));
+}
+
+void Device::access()
+{
+    ++m_statistics.registerAccesses;
+    syncRegisters();
+    advanceTo(m_cycles + 1);
+}
+
+void Device::delay(const uint64_t cycles)
+{
+    syncRegisters();
+    advanceTo(m_cycles + cycles);
+}
+
+void Device::sleep()
+{
+    access();
+
+    ++m_statistics.sleeps;
+
+    const uint64_t start = m_cycles;
+
+    // Only the events of the Timer1, the NVM controller and the inputs
+    // happen in Sleep
+    m_sleeping = true;
+    updateNextEvent();
+
+    // Any enabled interrupt wakes up the device, even with GIE cleared
+    while (!interruptPending()) {
+        if (m_nextEvent == Never) {
+            // Nothing can wake up the device
+            stop();
+        }
+
+        m_cycles = std::max(m_cycles, m_nextEvent);
+        processEvents();
+    }
+
+    m_sleeping = false;
+
+    // The Fosc based peripherals continue from where they stopped
+    const uint64_t slept = m_cycles - start;
+    m_statistics.sleepCycles += slept;
+
+    m_tmr2Start += slept;
+    for (auto* next : { &m_tmr2Next, &m_tmr4Next, &m_adcDone, &m_i2c.done }) {
+        if (*next != Never) {
+            *next += slept;
+        }
+    }
+
+    updateNextEvent();
+}
+
+volatile uint8_t* Device::ssp1BufferWrite()
+{
+    access();
+    m_i2c.bufferWritten = true;
+    return &m_i2c.buffer;
+}
+
+volatile uint8_t* Device::nvmCon2Write()
+{
+    access();
+    m_nvm.previousCon2 = m_nvm.con2;
+    return &m_nvm.con2;
+}
+
+uint16_t Device::tmr1Read()
+{
+    access();
+    countTmr1();
+    return m_tmr1;
+}
+
+void Device::tmr1Write(const uint16_t value)
+{
+    access();
+    countTmr1();
+    m_tmr1 = value;
+    m_tmr1Prescaler = 0;
+    scheduleTmr1();
+    updateNextEvent();
+}
+
+void Device::mainLoopIteration()
+{
+    ++m_statistics.mainLoopIterations;
+    delay(MainLoopIterationCycles);
+}
+
+void Device::advanceTo(const uint64_t target)
+{
+    while (m_nextEvent <= target) {
+        m_cycles = std::max(m_cycles, m_nextEvent);
+        processEvents();
+        dispatchInterrupts();
+    }
+
+    m_cycles = std::max(m_cycles, target);
+    dispatchInterrupts();
+}
+
+void Device::syncRegisters()
+{
+    if (Host_T1CON.value != m_t1con) {
+        // Counted with the previous configuration until now
+        countTmr1();
+        m_t1con = Host_T1CON.value;
+        scheduleTmr1();
+        updateNextEvent();
+    }
+
+    const bool tmr2InterruptEnabled = Host_PIE1.bits.TMR2IE;
+    if (Host_T2CON.value != m_t2con || tmr2InterruptEnabled != m_tmr2InterruptEnabled) {
+        if (!(m_t2con & Tmr2On) && (Host_T2CON.value & Tmr2On)) {
+            m_tmr2Start = m_cycles;
+        }
+        m_t2con = Host_T2CON.value;
+        m_tmr2InterruptEnabled = tmr2InterruptEnabled;
+        scheduleTmr2();
+        updateNextEvent();
+    }
+
+    if (Host_T4CON.value != m_t4con) {
+        m_t4con = Host_T4CON.value;
+        m_tmr4Next = Host_T4CON.bits.TMR4ON ? m_cycles + tmr4Period() : Never;
+        updateNextEvent();
+    }
+
+    if (Host_ADCON0.bits.ADGO != (m_adcDone != Never)) {
+        // Started or aborted
+        m_adcDone = Host_ADCON0.bits.ADGO ? m_cycles + AdcConversionCycles : Never;
+        updateNextEvent();
+    }
+
+    if (m_i2c.done == Never) {
+        if (Host_SSP1CON2.bits.SEN) {
+            startI2CEvent(Mock_I2C_Start, 1);
+        } else if (Host_SSP1CON2.bits.PEN) {
+            startI2CEvent(Mock_I2C_Stop, 1);
+        } else if (m_i2c.bufferWritten) {
+            m_i2c.bufferWritten = false;
+            startI2CEvent(m_i2c.buffer, 9);
+        }
+    } else {
+        // Operations started while the previous one is in progress
+        const bool collision =
+            m_i2c.bufferWritten
+            || (Host_SSP1CON2.bits.SEN && m_i2c.event != Mock_I2C_Start)
+            || (Host_SSP1CON2.bits.PEN && m_i2c.event != Mock_I2C_Stop);
+
+        if (collision) {
+            ++m_statistics.i2cCollisions;
+            m_i2c.bufferWritten = false;
+            uint16_t event = Mock_I2C_Collision;
+            m_display.process(&event, 1);
+        }
+    }
+
+    if (Host_NVMCON1.bits.RD) {
+        if (Host_NVMCON1.bits.NVMREGS && Host_NVMADRH.value == 0x70) {
+            Host_NVMDATL.value = m_eeprom[Host_NVMADRL.value];
+        }
+        Host_NVMCON1.bits.RD = 0;
+    }
+
+    if (Host_NVMCON1.bits.WR && m_nvm.done == Never) {
+        // The write needs the unlock sequence with the interrupts disabled
+        const bool unlocked =
+            m_nvm.previousCon2 == 0x55
+            && m_nvm.con2 == 0xAA
+            && Host_NVMCON1.bits.WREN
+            && !Host_INTCON.bits.GIE;
+
+        if (unlocked && Host_NVMCON1.bits.NVMREGS && Host_NVMADRH.value == 0x70) {
+            m_nvm.address = Host_NVMADRL.value;
+            m_nvm.data = Host_NVMDATL.value;
+            m_nvm.done = m_cycles + EepromWriteCycles;
+            updateNextEvent();
+        } else {
+            ++m_statistics.nvmErrors;
+            Host_NVMCON1.bits.WR = 0;
+        }
+
+        m_nvm.con2 = 0;
+        m_nvm.previousCon2 = 0;
+    }
+
+    Host_FVRCON.bits.FVRRDY = Host_FVRCON.bits.FVREN;
+    Host_PIR0.bits.IOCIF = (Host_IOCAF.value | Host_IOCCF.value) != 0;
+}
+
+void Device::processEvents()
+{
+    if (m_cycles >= m_stopCycle) {
+        stop();
+    }
+
+    if (!m_sleeping) {
+        if (m_tmr4Next <= m_cycles) {
+            Host_PIR2.bits.TMR4IF = 1;
+            m_tmr4Next += tmr4Period();
+        }
+
+        if (m_tmr2Next <= m_cycles) {
+            Host_PIR1.bits.TMR2IF = 1;
+            m_tmr2Next += tmr2Period();
+        }
+
+        if (m_adcDone <= m_cycles) {
+            finishConversion();
+        }
+
+        if (m_i2c.done <= m_cycles) {
+            finishI2CEvent();
+        }
+    }
+
+    if (m_tmr1Overflow <= m_cycles) {
+        countTmr1();
+        scheduleTmr1();
+    }
+
+    if (m_nvm.done <= m_cycles) {
+        finishEepromWrite();
+    }
+
+    while (!m_inputEvents.empty() && m_inputEvents.begin()->first <= m_cycles) {
+        const auto [input, level] = m_inputEvents.begin()->second;
+        m_inputEvents.erase(m_inputEvents.begin());
+        applyInput(input, level);
+    }
+
+    updateNextEvent();
+}
+
+void Device::updateNextEvent()
+{
+    uint64_t next = std::min({ m_stopCycle, m_tmr1Overflow, m_nvm.done });
+
+    if (!m_inputEvents.empty()) {
+        next = std::min(next, m_inputEvents.begin()->first);
+    }
+
+    if (!m_sleeping) {
+        next = std::min({ next, m_tmr4Next, m_tmr2Next, m_adcDone, m_i2c.done });
+    }
+
+    m_nextEvent = next;
+}
+
+void Device::dispatchInterrupts()
+{
+    while (!m_inIsr && Host_INTCON.bits.GIE && interruptPending()) {
+        const uint8_t pir1 = Host_PIR1.value & Host_PIE1.value;
+        const uint8_t pir2 = Host_PIR2.value & Host_PIE2.value;
+
+        auto& counts = m_statistics.interrupts;
+        counts[Interrupt_IOC] += Host_PIE0.bits.IOCIE && (Host_IOCAF.value | Host_IOCCF.value);
+        if (Host_INTCON.bits.PEIE) {
+            counts[Interrupt_TMR1] += (pir1 & 0x01) != 0;
+            counts[Interrupt_TMR2] += (pir1 & 0x02) != 0;
+            counts[Interrupt_SSP1] += (pir1 & 0x08) != 0;
+            counts[Interrupt_ADC] += (pir1 & 0x40) != 0;
+            counts[Interrupt_TMR4] += (pir2 & 0x01) != 0;
+            counts[Interrupt_NVM] += (pir2 & 0x10) != 0;
+        }
+
+        // GIE is cleared while the ISR runs and set again by RETFIE
+        m_inIsr = true;
+        Host_INTCON.bits.GIE = 0;
+        m_cycles += InterruptLatencyCycles;
+
+        isr();
+
+        syncRegisters();
+        Host_INTCON.bits.GIE = 1;
+        m_inIsr = false;
+    }
+}
+
+bool Device::interruptPending() const
+{
+    if (Host_PIE0.bits.IOCIE && (Host_IOCAF.value | Host_IOCCF.value)) {
+        return true;
+    }
+
+    if (!Host_INTCON.bits.PEIE) {
+        return false;
+    }
+
+    return (Host_PIR1.value & Host_PIE1.value) || (Host_PIR2.value & Host_PIE2.value);
+}
+
+void Device::stop()
+{
+    m_stopCycle = Never;
+
+    if (auto handler = std::move(m_stopHandler)) {
+        handler();
+    }
+
+    std::exit(EXIT_SUCCESS);
+}
+
+uint64_t Device::rtcTicksAt(const uint64_t cycle) const
+{
+    return static_cast<uint64_t>(
+        static_cast<unsigned __int128>(cycle) * RtcFrequencyHz / InstructionFrequencyHz
+    );
+}
+
+void Device::countTmr1()
+{
+    const uint64_t tick = rtcTicksAt(m_cycles);
+
+    if (m_t1con & Tmr1On) {
+        const uint8_t shift = (m_t1con >> 4) & 0x03;
+        const uint64_t prescaled = m_tmr1Prescaler + (tick - m_tmr1Tick);
+        const uint64_t count = m_tmr1 + (prescaled >> shift);
+
+        if (count > 0xFFFF) {
+            Host_PIR1.bits.TMR1IF = 1;
+        }
+
+        m_tmr1 = static_cast<uint16_t>(count);
+        m_tmr1Prescaler = static_cast<uint8_t>(prescaled & ((1u << shift) - 1));
+    }
+
+    m_tmr1Tick = tick;
+}
+
+void Device::scheduleTmr1()
+{
+    if (!(m_t1con & Tmr1On)) {
+        m_tmr1Overflow = Never;
+        return;
+    }
+
+    const uint8_t shift = (m_t1con >> 4) & 0x03;
+    const uint64_t overflowTick =
+        m_tmr1Tick + ((0x10000ull - m_tmr1) << shift) - m_tmr1Prescaler;
+
+    // First cycle where the RTC tick count reaches the overflow
+    m_tmr1Overflow = static_cast<uint64_t>(
+        (static_cast<unsigned __int128>(overflowTick) * InstructionFrequencyHz
+            + RtcFrequencyHz - 1)
+        / RtcFrequencyHz
+    );
+}
+
+uint64_t Device::tmr2Period() const
+{
+    return uint64_t{ TimerPrescalers[m_t2con & 0x03] }
+        * (Host_PR2.value + 1u)
+        * (((m_t2con >> 3) & 0x0F) + 1u);
+}
+
+uint64_t Device::tmr4Period() const
+{
+    return uint64_t{ TimerPrescalers[m_t4con & 0x03] }
+        * (Host_PR4.value + 1u)
+        * (((m_t4con >> 3) & 0x0F) + 1u);
+}
+
+void Device::scheduleTmr2()
+{
+    // TMR2IF is only used for the dithering interrupt, the periods aren't
+    // simulated while it's disabled
+    if (!(m_t2con & Tmr2On) || !m_tmr2InterruptEnabled) {
+        m_tmr2Next = Never;
+        return;
+    }
+
+    const uint64_t period = tmr2Period();
+    m_tmr2Next = m_tmr2Start + ((m_cycles - m_tmr2Start) / period + 1) * period;
+}
+
+void Device::startI2CEvent(const uint16_t event, const uint32_t bits)
+{
+    m_i2c.event = event;
+    m_i2c.done = m_cycles + uint64_t{ bits } * (Host_SSP1ADD.value + 1u);
+    updateNextEvent();
+}
+
+void Device::finishI2CEvent()
+{
+    uint16_t event = m_i2c.event;
+    m_i2c.done = Never;
+
+    if (event == Mock_I2C_Start) {
+        Host_SSP1CON2.bits.SEN = 0;
+    } else if (event == Mock_I2C_Stop) {
+        Host_SSP1CON2.bits.PEN = 0;
+    }
+
+    m_display.process(&event, 1);
+
+    Host_PIR1.bits.SSP1IF = 1;
+}
+
+void Device::finishConversion()
+{
+    m_adcDone = Never;
+
+    // Right justified, VDD reference
+    uint16_t result = 0;
+    if (Host_ADCON0.bits.CHS == FvrChannel && Host_FVRCON.bits.FVRRDY) {
+        result = static_cast<uint16_t>(
+            std::min<uint32_t>(1023, FvrMilliVolts * 1023u / m_vddMilliVolts)
+        );
+    }
+
+    Host_ADRESH.value = static_cast<uint8_t>(result >> 8);
+    Host_ADRESL.value = static_cast<uint8_t>(result);
+    Host_ADCON0.bits.ADGO = 0;
+    Host_PIR1.bits.ADIF = 1;
+}
+
+void Device::finishEepromWrite()
+{
+    m_nvm.done = Never;
+    m_eeprom[m_nvm.address] = m_nvm.data;
+    ++m_statistics.eepromWrites;
+
+    Host_NVMCON1.bits.WR = 0;
+    Host_PIR2.bits.NVMIF = 1;
+}
+
+void Device::applyInput(const Input input, const bool level)
+{
+    volatile uint8_t* port = &Host_PORTA.value;
+    volatile uint8_t* flags = &Host_IOCAF.value;
+    uint8_t negativeEdge = Host_IOCAN.value;
+    uint8_t positiveEdge = Host_IOCAP.value;
+    uint8_t mask = 0;
+
+    switch (input) {
+        case Input::Key1:
+            mask = 1u << 0;
+            break;
+
+        case Input::Key2:
+            mask = 1u << 1;
+            break;
+
+        case Input::LdoSense:
+            mask = 1u << 2;
+            break;
+
+        case Input::Key3:
+            port = &Host_PORTC.value;
+            flags = &Host_IOCCF.value;
+            negativeEdge = Host_IOCCN.value;
+            positiveEdge = Host_IOCCP.value;
+            mask = 1u << 5;
+            break;
+    }
+
+    if (((*port & mask) != 0) == level) {
+        return;
+    }
+
+    *port = static_cast<uint8_t>(level ? (*port | mask) : (*port & ~mask));
+
+    if ((level ? positiveEdge : negativeEdge) & mask) {
+        *flags = static_cast<uint8_t>(*flags | mask);
+        Host_PIR0.bits.IOCIF = 1;
+    }
+}
+
+}
+
+using host::Device;
+
+extern "C" {
+
+void Host_access(void)
+{
+    Device::instance().access();
+}
+
+void Host_delay(const uint64_t cycles)
+{
+    Device::instance().delay(cycles);
+}
+
+void Host_sleep(void)
+{
+    Device::instance().sleep();
+}
+
+volatile uint8_t* Host_SSP1BUF_write(void)
+{
+    return Device::instance().ssp1BufferWrite();
+}
+
+volatile uint8_t* Host_NVMCON2_write(void)
+{
+    return Device::instance().nvmCon2Write();
+}
+
+uint16_t Host_TMR1_read(void)
+{
+    return Device::instance().tmr1Read();
+}
+
+void Host_TMR1_write(const uint16_t value)
+{
+    Device::instance().tmr1Write(value);
+}
+
+// The main loop of the firmware calls Clock_task() in every iteration, the
+// linker redirects the call here (--wrap) to account for its run time
+void __real_Clock_task(void);
+
+void __wrap_Clock_task(void)
+{
+    Device::instance().mainLoopIteration();
+    __real_Clock_task();
+}
+
+// The bus traffic is passed to the SSD1306 emulator directly, these only
+// complete SSD1306Emulator::processRecordedEvents()
+size_t Mock_SSP1_eventCount(void)
+{
+    return 0;
+}
+
+const uint16_t* Mock_SSP1_events(void)
+{
+    return nullptr;
+}
+
+void Mock_SSP1_clearEvents(void)
+{
+}
+
+}
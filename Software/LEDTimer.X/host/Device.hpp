@@ -0,0 +1,186 @@
+#pragma once
+
+#include "SSD1306Emulator.hpp"
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+
+namespace host {
+
+/*
+ * Simulated PIC16F18326 running the firmware on the host.
+ *
+ * Time is counted in instruction cycles (Fosc / 4). It advances by one
+ * cycle per register access, by the requested amount in the __delay_*()
+ * macros and by a fixed cost per main loop iteration; the code between the
+ * register accesses runs in zero simulated time.
+ *
+ * The peripherals are updated from the register writes (see xc.h) and from
+ * a timeline of events: Timer1 (32768 Hz SOSC, runs in Sleep), Timer2 (PWM
+ * period, only while its interrupt is enabled), Timer4, the ADC, the MSSP
+ * in I2C master mode (the traffic is decoded by an SSD1306Emulator), the
+ * data EEPROM writes of the NVM controller and the scheduled input changes
+ * of the keys and the LDO_SENSE pin with interrupt-on-change.
+ */
+class Device
+{
+public:
+    static constexpr uint32_t InstructionFrequencyHz = 4'000'000;
+    static constexpr uint32_t RtcFrequencyHz = 32'768;
+
+    // Time spent in the main loop outside of the register accesses
+    static constexpr uint32_t MainLoopIterationCycles = 100;
+
+    enum class Input : uint8_t {
+        Key1,       // RA0, active low
+        Key2,       // RA1, active low
+        Key3,       // RC5, active low
+        LdoSense    // RA2, high while running from the backup battery
+    };
+
+    enum Interrupt : uint8_t {
+        Interrupt_IOC,
+        Interrupt_TMR1,
+        Interrupt_TMR2,
+        Interrupt_TMR4,
+        Interrupt_ADC,
+        Interrupt_SSP1,
+        Interrupt_NVM,
+        Interrupt_Count
+    };
+
+    struct Statistics {
+        uint64_t sleeps = 0;
+        uint64_t sleepCycles = 0;
+        uint64_t mainLoopIterations = 0;
+        uint64_t registerAccesses = 0;
+        std::array<uint64_t, Interrupt_Count> interrupts{};
+        uint64_t eepromWrites = 0;
+        uint64_t nvmErrors = 0;
+        uint64_t i2cCollisions = 0;
+    };
+
+    Device();
+
+    static Device& instance();
+
+    // Power-on reset of the registers and the peripherals, the content of
+    // the EEPROM is kept
+    void reset();
+
+    [[nodiscard]] uint64_t cycles() const { return m_cycles; }
+    [[nodiscard]] static double seconds(uint64_t cycles) {
+        return static_cast<double>(cycles) / InstructionFrequencyHz;
+    }
+    [[nodiscard]] static uint64_t cyclesOf(double seconds) {
+        return static_cast<uint64_t>(seconds * InstructionFrequencyHz);
+    }
+
+    // The handler is called (once) when the simulated time reaches the cycle
+    void setStopTime(uint64_t cycle, std::function<void()> handler);
+
+    void setInput(Input input, bool level);
+    void scheduleInput(uint64_t cycle, Input input, bool level);
+
+    void setVddMilliVolts(uint16_t milliVolts) { m_vddMilliVolts = milliVolts; }
+
+    [[nodiscard]] std::array<uint8_t, 256>& eeprom() { return m_eeprom; }
+    [[nodiscard]] const mock::SSD1306Emulator& display() const { return m_display; }
+    [[nodiscard]] const Statistics& statistics() const { return m_statistics; }
+
+    // Current duty cycle of PWM5 (0..1023)
+    [[nodiscard]] uint16_t pwmDutyValue() const;
+
+    [[nodiscard]] bool sleeping() const { return m_sleeping; }
+
+    // Simulation hooks of xc.h
+    void access();
+    void delay(uint64_t cycles);
+    void sleep();
+    volatile uint8_t* ssp1BufferWrite();
+    volatile uint8_t* nvmCon2Write();
+    uint16_t tmr1Read();
+    void tmr1Write(uint16_t value);
+    void mainLoopIteration();
+
+private:
+    static constexpr uint64_t Never = UINT64_MAX;
+
+    void advanceTo(uint64_t target);
+    void syncRegisters();
+    void processEvents();
+    void updateNextEvent();
+    void dispatchInterrupts();
+    [[nodiscard]] bool interruptPending() const;
+    void stop();
+
+    // Timer1
+    [[nodiscard]] uint64_t rtcTicksAt(uint64_t cycle) const;
+    void countTmr1();
+    void scheduleTmr1();
+
+    // Timer2 and Timer4 (Fosc / 4 clock)
+    [[nodiscard]] uint64_t tmr2Period() const;
+    [[nodiscard]] uint64_t tmr4Period() const;
+    void scheduleTmr2();
+
+    void startI2CEvent(uint16_t event, uint32_t bits);
+    void finishI2CEvent();
+    void finishConversion();
+    void finishEepromWrite();
+    void applyInput(Input input, bool level);
+
+    uint64_t m_cycles = 0;
+    uint64_t m_nextEvent = Never;
+    bool m_inIsr = false;
+    bool m_sleeping = false;
+
+    uint64_t m_stopCycle = Never;
+    std::function<void()> m_stopHandler;
+
+    std::multimap<uint64_t, std::pair<Input, bool>> m_inputEvents;
+
+    // Register values the peripherals were last updated from
+    uint8_t m_t1con = 0;
+    uint8_t m_t2con = 0;
+    uint8_t m_t4con = 0;
+    bool m_tmr2InterruptEnabled = false;
+
+    // Timer1 counter, prescaler and the RTC tick they were updated at
+    uint16_t m_tmr1 = 0;
+    uint8_t m_tmr1Prescaler = 0;
+    uint64_t m_tmr1Tick = 0;
+    uint64_t m_tmr1Overflow = Never;
+
+    // Timer2 counts from this cycle, shifted by the time spent in Sleep
+    uint64_t m_tmr2Start = 0;
+    uint64_t m_tmr2Next = Never;
+    uint64_t m_tmr4Next = Never;
+
+    uint64_t m_adcDone = Never;
+    uint16_t m_vddMilliVolts = 3300;
+
+    struct I2C {
+        volatile uint8_t buffer = 0;
+        bool bufferWritten = false;
+        uint16_t event = 0;
+        uint64_t done = Never;
+    } m_i2c;
+    mock::SSD1306Emulator m_display;
+
+    struct Nvm {
+        volatile uint8_t con2 = 0;
+        uint8_t previousCon2 = 0;
+        uint8_t address = 0;
+        uint8_t data = 0;
+        uint64_t done = Never;
+    } m_nvm;
+    std::array<uint8_t, 256> m_eeprom;
+
+    Statistics m_statistics;
+};
+
+}
@@ -0,0 +1,100 @@
+#include "ThreadPool.hpp"
+
+#include <algorithm>
+#include <thread>
+
+namespace host {
+
+ThreadPool::ThreadPool(const unsigned threads)
+    : m_threads{ std::max(threads, 1u) }
+    , m_queues(m_threads)
+{
+}
+
+void ThreadPool::run(const size_t count, const std::function<void(size_t)>& task)
+{
+    m_steals = 0;
+
+    for (unsigned i = 0; i < m_threads; ++i) {
+        auto& queue = m_queues[i];
+        const size_t first = count * i / m_threads;
+        const size_t last = count * (i + 1) / m_threads;
+
+        std::lock_guard lock{ queue.mutex };
+        queue.tasks.clear();
+
+        for (size_t index = first; index < last; ++index) {
+            queue.tasks.push_back(index);
+        }
+    }
+
+    std::vector<std::thread> workers;
+    workers.reserve(m_threads - 1);
+
+    for (unsigned i = 1; i < m_threads; ++i) {
+        workers.emplace_back(&ThreadPool::work, this, i, std::cref(task));
+    }
+
+    // The calling thread is the first worker
+    work(0, task);
+
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+void ThreadPool::work(const unsigned worker, const std::function<void(size_t)>& task)
+{
+    uint64_t steals = 0;
+    size_t index = 0;
+
+    while (true) {
+        if (!take(worker, index)) {
+            // No new tasks are added during a run, the pool is done when
+            // there's nothing left to steal
+            if (!steal(worker, index)) {
+                break;
+            }
+
+            ++steals;
+        }
+
+        task(index);
+    }
+
+    std::lock_guard lock{ m_stealsMutex };
+    m_steals += steals;
+}
+
+bool ThreadPool::take(const unsigned worker, size_t& index)
+{
+    auto& queue = m_queues[worker];
+    std::lock_guard lock{ queue.mutex };
+
+    if (queue.tasks.empty()) {
+        return false;
+    }
+
+    index = queue.tasks.front();
+    queue.tasks.pop_front();
+
+    return true;
+}
+
+bool ThreadPool::steal(const unsigned worker, size_t& index)
+{
+    for (unsigned i = 1; i < m_threads; ++i) {
+        auto& queue = m_queues[(worker + i) % m_threads];
+        std::lock_guard lock{ queue.mutex };
+
+        if (!queue.tasks.empty()) {
+            index = queue.tasks.back();
+            queue.tasks.pop_back();
+            return true;
+        }
+    }
+
+    return false;
+}
+
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+namespace host {
+
+/*
+ * Work-stealing thread pool for a fixed set of independent tasks, shared by
+ * the host simulators and the sunrise/sunset table generator.
+ *
+ * The task indices are split into contiguous blocks, one per worker. Each
+ * worker takes the tasks from the front of its own queue and, when it runs
+ * out of work, steals from the back of the other queues, so the workers
+ * with the cheaper tasks help out the others.
+ */
+class ThreadPool
+{
+public:
+    explicit ThreadPool(unsigned threads);
+
+    // Runs task(index) for each index below the count, returns when all
+    // of them have finished
+    void run(size_t count, const std::function<void(size_t)>& task);
+
+    [[nodiscard]] unsigned threads() const { return m_threads; }
+
+    // Tasks taken from the queue of another worker in the last run
+    [[nodiscard]] uint64_t steals() const { return m_steals; }
+
+private:
+    struct Queue {
+        std::mutex mutex;
+        std::deque<size_t> tasks;
+    };
+
+    void work(unsigned worker, const std::function<void(size_t)>& task);
+    [[nodiscard]] bool take(unsigned worker, size_t& index);
+    [[nodiscard]] bool steal(unsigned worker, size_t& index);
+
+    unsigned m_threads;
+    std::vector<Queue> m_queues;
+    uint64_t m_steals = 0;
+    std::mutex m_stealsMutex;
+};
+
+}
@@ -0,0 +1,6 @@
+/*
+ * Host replacement of the XC8 console I/O header, the firmware doesn't use
+ * its functions.
+ */
+
+#pragma once
@@ -0,0 +1,232 @@
+/*
+ * Runs the firmware of the LED Timer natively against the simulated
+ * peripherals of Device.cpp, for profiling the real main loop (perf,
+ * callgrind) and trying out UI flows without the hardware.
+ *
+ * The simulation stops after the given simulated time and prints the
+ * statistics of the run.
+ */
+
+#include "Device.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+
+extern "C" void Firmware_main(void);
+
+namespace {
+
+using host::Device;
+
+struct Options {
+    double durationSeconds = 60;
+    bool battery = false;
+    uint16_t vddMilliVolts = 3300;
+    std::string eepromPath;
+    bool screen = false;
+};
+
+void printUsage(const char* program)
+{
+    std::printf(
+        "Usage: %s [options]\n"
+        "  --duration SECONDS     Simulated run time (default: 60)\n"
+        "  --battery              Start from the backup battery (the device sleeps)\n"
+        "  --power SECONDS:SOURCE Switch to 'battery' or 'mains' at the given time\n"
+        "  --press SECONDS:KEYS[:MS]\n"
+        "                         Press the keys (e.g. 1, 23) at the given time\n"
+        "                         for MS milliseconds (default: 100)\n"
+        "  --vdd MILLIVOLTS       Supply voltage measured by the ADC (default: 3300)\n"
+        "  --eeprom FILE          Load the data EEPROM from the file and save it at the end\n"
+        "  --screen               Print the content of the display at the end\n",
+        program
+    );
+}
+
+bool parsePress(Device& device, const char* arg)
+{
+    double seconds = 0;
+    char keys[8] = {};
+    unsigned milliseconds = 100;
+
+    if (std::sscanf(arg, "%lf:%7[0-9]:%u", &seconds, keys, &milliseconds) < 2) {
+        return false;
+    }
+
+    const uint64_t press = Device::cyclesOf(seconds);
+    const uint64_t release = press + Device::cyclesOf(milliseconds / 1000.0);
+
+    for (const char* key = keys; *key; ++key) {
+        Device::Input input;
+
+        switch (*key) {
+            case '1': input = Device::Input::Key1; break;
+            case '2': input = Device::Input::Key2; break;
+            case '3': input = Device::Input::Key3; break;
+            default: return false;
+        }
+
+        // Active low
+        device.scheduleInput(press, input, false);
+        device.scheduleInput(release, input, true);
+    }
+
+    return true;
+}
+
+bool parsePower(Device& device, const char* arg)
+{
+    double seconds = 0;
+    char source[8] = {};
+
+    if (std::sscanf(arg, "%lf:%7s", &seconds, source) != 2) {
+        return false;
+    }
+
+    const bool battery = std::strcmp(source, "battery") == 0;
+    if (!battery && std::strcmp(source, "mains") != 0) {
+        return false;
+    }
+
+    device.scheduleInput(Device::cyclesOf(seconds), Device::Input::LdoSense, battery);
+
+    return true;
+}
+
+void loadEeprom(Device& device, const std::string& path)
+{
+    std::ifstream file{ path, std::ios::binary };
+    if (file) {
+        auto& eeprom = device.eeprom();
+        file.read(reinterpret_cast<char*>(eeprom.data()), eeprom.size());
+    }
+}
+
+void saveEeprom(Device& device, const std::string& path)
+{
+    std::ofstream file{ path, std::ios::binary };
+    const auto& eeprom = device.eeprom();
+    file.write(reinterpret_cast<const char*>(eeprom.data()), eeprom.size());
+}
+
+void printReport(Device& device, const double wallSeconds)
+{
+    const auto& stats = device.statistics();
+    const double simulated = Device::seconds(device.cycles());
+
+    std::printf("Simulated time:      %.3f s (%.1f%% in Sleep, %llu sleeps)\n",
+        simulated,
+        device.cycles() > 0 ? 100.0 * stats.sleepCycles / device.cycles() : 0.0,
+        static_cast<unsigned long long>(stats.sleeps)
+    );
+    std::printf("Host time:           %.3f s (%.0fx real time)\n",
+        wallSeconds,
+        wallSeconds > 0 ? simulated / wallSeconds : 0.0
+    );
+    std::printf("Main loop:           %llu iterations\n",
+        static_cast<unsigned long long>(stats.mainLoopIterations)
+    );
+    std::printf("Register accesses:   %llu\n",
+        static_cast<unsigned long long>(stats.registerAccesses)
+    );
+
+    static const char* const Names[] = { "IOC", "TMR1", "TMR2", "TMR4", "ADC", "SSP1", "NVM" };
+    std::printf("Interrupts:         ");
+    for (size_t i = 0; i < Device::Interrupt_Count; ++i) {
+        std::printf(" %s=%llu", Names[i], static_cast<unsigned long long>(stats.interrupts[i]));
+    }
+    std::printf("\n");
+
+    const auto& display = device.display();
+    std::printf("Display:             %zu bytes, %zu errors\n",
+        display.statistics().bytes,
+        display.errors().size()
+    );
+    std::printf("EEPROM:              %llu byte writes, %llu errors\n",
+        static_cast<unsigned long long>(stats.eepromWrites),
+        static_cast<unsigned long long>(stats.nvmErrors)
+    );
+    std::printf("I2C collisions:      %llu\n",
+        static_cast<unsigned long long>(stats.i2cCollisions)
+    );
+    std::printf("PWM5 duty:           %u\n", device.pwmDutyValue());
+}
+
+}
+
+int main(int argc, char* argv[])
+{
+    auto& device = Device::instance();
+    device.reset();
+
+    Options options;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+        bool valid = true;
+
+        if (arg == "--duration" && value) {
+            options.durationSeconds = std::atof(value);
+            ++i;
+        } else if (arg == "--battery") {
+            options.battery = true;
+        } else if (arg == "--power" && value) {
+            valid = parsePower(device, value);
+            ++i;
+        } else if (arg == "--press" && value) {
+            valid = parsePress(device, value);
+            ++i;
+        } else if (arg == "--vdd" && value) {
+            options.vddMilliVolts = static_cast<uint16_t>(std::atoi(value));
+            ++i;
+        } else if (arg == "--eeprom" && value) {
+            options.eepromPath = value;
+            ++i;
+        } else if (arg == "--screen") {
+            options.screen = true;
+        } else {
+            valid = false;
+        }
+
+        if (!valid || options.vddMilliVolts == 0) {
+            printUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (!options.eepromPath.empty()) {
+        loadEeprom(device, options.eepromPath);
+    }
+
+    device.setInput(Device::Input::LdoSense, options.battery);
+    device.setVddMilliVolts(options.vddMilliVolts);
+
+    const auto start = std::chrono::steady_clock::now();
+
+    device.setStopTime(Device::cyclesOf(options.durationSeconds), [&] {
+        const std::chrono::duration<double> elapsed =
+            std::chrono::steady_clock::now() - start;
+
+        printReport(device, elapsed.count());
+
+        if (options.screen) {
+            std::printf("\n%s", device.display().render().c_str());
+        }
+
+        if (!options.eepromPath.empty()) {
+            saveEeprom(device, options.eepromPath);
+        }
+
+        std::fflush(stdout);
+    });
+
+    // Returns only through the stop handler
+    Firmware_main();
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,148 @@
+/*
+ * Host implementation of the MCC generated drivers used by the firmware.
+ *
+ * The initialization follows the generated code for the simulated registers
+ * (see xc.h), the other functions have the same register level behavior as
+ * the generated ones. Timer1 is counted by the simulator, so it's accessed
+ * through Host_TMR1_read() and Host_TMR1_write() instead of TMR1H / TMR1L.
+ */
+
+#include "xc.h"
+
+#include "mcc_generated_files/mcc.h"
+
+void PIN_MANAGER_Initialize(void)
+{
+    // SW1 (RA0), SW2 (RA1) and SW3 (RC5) on the falling edge,
+    // LDO_SENSE (RA2) on both edges
+    IOCAF = 0;
+    IOCCF = 0;
+    IOCAN = 0x07;
+    IOCAP = 0x04;
+    IOCCN = 0x20;
+    IOCCP = 0x00;
+
+    PIE0bits.IOCIE = 1;
+}
+
+void I2C1_Initialize(void)
+{
+    SSP1CON1 = 0x08;
+    SSP1CON2 = 0x00;
+    SSP1ADD = 0x09;
+    SSP1CON1bits.SSPEN = 0;
+}
+
+void FVR_Initialize(void)
+{
+    // FVREN enabled; ADFVR 1x (1.024 V)
+    FVRCON = 0x81;
+}
+
+void ADC_Initialize(void)
+{
+    ADRESL = 0x00;
+    ADRESH = 0x00;
+    ADCON0 = 0x7D;
+    PIE1bits.ADIE = 1;
+}
+
+void TMR4_Initialize(void)
+{
+    // 100 Hz: 1:16 prescaler, 1:10 postscaler
+    PR4 = 0xF9;
+    PIR2bits.TMR4IF = 0;
+    PIE2bits.TMR4IE = 1;
+    T4CON = 0x4E;
+}
+
+void PWM5_Initialize(void)
+{
+    PWM5CON = 0x80;
+    PWM5DCH = 0x00;
+    PWM5DCL = 0x00;
+}
+
+void TMR2_Initialize(void)
+{
+    PR2 = 0xFF;
+    PIR1bits.TMR2IF = 0;
+    T2CON = 0x04;
+}
+
+void TMR1_Initialize(void)
+{
+    Host_TMR1_write(0);
+    PIR1bits.TMR1IF = 0;
+    PIE1bits.TMR1IE = 1;
+
+    // SOSC 32768 Hz, not synchronized (runs in Sleep), 1:1 prescaler
+    T1CON = 0x8D;
+}
+
+void SYSTEM_Initialize(void)
+{
+    // UART1MD: EUSART disabled
+    PMD4 = 0x24;
+
+    I2C1_Initialize();
+    PIN_MANAGER_Initialize();
+    FVR_Initialize();
+    ADC_Initialize();
+    TMR4_Initialize();
+    PWM5_Initialize();
+    TMR2_Initialize();
+    TMR1_Initialize();
+}
+
+void ADC_SelectChannel(adc_channel_t channel)
+{
+    ADCON0bits.CHS = channel;
+    ADCON0bits.ADON = 1;
+}
+
+void ADC_StartConversion(void)
+{
+    ADCON0bits.ADGO = 1;
+
+    // The firmware can wait for the interrupt in a loop which doesn't
+    // access any register, so the conversion is finished here
+    while (ADCON0bits.ADGO);
+}
+
+uint8_t DATAEE_ReadByte(uint8_t bAdd)
+{
+    NVMADRH = 0x70;
+    NVMADRL = bAdd;
+    NVMCON1bits.NVMREGS = 1;
+    NVMCON1bits.RD = 1;
+    NOP();
+
+    return NVMDATL;
+}
+
+void PWM5_LoadDutyValue(uint16_t dutyValue)
+{
+    PWM5DCH = (uint8_t)((dutyValue & 0x03FC) >> 2);
+    PWM5DCL = (uint8_t)((dutyValue & 0x0003) << 6);
+}
+
+void TMR1_StartTimer(void)
+{
+    T1CONbits.TMR1ON = 1;
+}
+
+void TMR1_StopTimer(void)
+{
+    T1CONbits.TMR1ON = 0;
+}
+
+uint16_t TMR1_ReadTimer(void)
+{
+    return Host_TMR1_read();
+}
+
+void TMR1_WriteTimer(uint16_t timerVal)
+{
+    Host_TMR1_write(timerVal);
+}
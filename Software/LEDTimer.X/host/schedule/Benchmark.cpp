@@ -0,0 +1,198 @@
+/*
+ * Benchmark of the schedule table by the number of intervals.
+ *
+ * Random interval sets with 5, 16, 32 and 64 active intervals are compiled
+ * into schedule tables (sized for 64 intervals by the build), then the state
+ * and the next transition are looked up at every minute of the day. The
+ * cost of a lookup is compared with the scan of all intervals the table
+ * replaces, the two must give the same state at every minute.
+ *
+ * The exit code is non-zero if the table and the scan differ.
+ */
+
+extern "C" {
+#include <ScheduleTable.h>
+}
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr Clock_Time MinutesPerDay = 1440;
+constexpr size_t IntervalCounts[] = { 5, 16, 32, 64 };
+
+struct Options {
+    size_t sets = 100;
+    uint64_t seed = 1;
+};
+
+void printUsage(const char* program)
+{
+    std::printf(
+        "Usage: %s [options]\n"
+        "  --sets N                 Random interval sets per size (default: 100)\n"
+        "  --seed N                 Seed of the interval sets (default: 1)\n",
+        program
+    );
+}
+
+using Intervals = std::vector<ScheduleTable_Interval>;
+
+// The intervals cover about half of the day, so the number of the
+// transitions grows with them, some of the intervals cross midnight
+Intervals generate(std::mt19937_64& random, const size_t count)
+{
+    const auto uniform = [&](const int low, const int high) {
+        return std::uniform_int_distribution<int>{ low, high }(random);
+    };
+
+    Intervals intervals(count);
+
+    const int maxLength = MinutesPerDay / static_cast<int>(count);
+
+    for (auto& interval : intervals) {
+        interval.on = static_cast<Clock_Time>(uniform(0, MinutesPerDay - 1));
+        interval.off = static_cast<Clock_Time>((interval.on + uniform(1, maxLength)) % MinutesPerDay);
+        interval.active = true;
+    }
+
+    return intervals;
+}
+
+// Evaluation without the table: every interval is checked
+bool scanIsOn(const Intervals& intervals, const Clock_Time time)
+{
+    for (const auto& interval : intervals) {
+        const bool inside = interval.on <= interval.off
+            ? time >= interval.on && time < interval.off
+            : time >= interval.on || time < interval.off;
+
+        if (interval.active && inside) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+ScheduleTable build(const Intervals& intervals)
+{
+    ScheduleTable table;
+    ScheduleTable_build(&table, intervals.data(), static_cast<uint8_t>(intervals.size()));
+    return table;
+}
+
+template<typename Function>
+double nanosecondsPerCall(const size_t calls, Function&& function)
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    for (size_t i = 0; i < calls; ++i) {
+        function(i);
+    }
+
+    const std::chrono::duration<double, std::nano> elapsed =
+        std::chrono::steady_clock::now() - start;
+
+    return elapsed.count() / calls;
+}
+
+}
+
+int main(int argc, char* argv[])
+{
+    Options options;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+        bool valid = true;
+
+        if (arg == "--sets" && value) {
+            const int sets = std::atoi(value);
+            valid = sets > 0;
+            options.sets = static_cast<size_t>(sets);
+            ++i;
+        } else if (arg == "--seed" && value) {
+            options.seed = std::strtoull(value, nullptr, 10);
+            ++i;
+        } else {
+            valid = false;
+        }
+
+        if (!valid) {
+            printUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    std::printf("Intervals   Transitions   Build (ns)   Scan (ns/call)   isOn (ns/call)   Next (ns/call)\n");
+
+    std::mt19937_64 random{ options.seed };
+    size_t mismatches = 0;
+
+    for (const size_t count : IntervalCounts) {
+        std::vector<Intervals> sets;
+        std::vector<ScheduleTable> tables;
+
+        for (size_t i = 0; i < options.sets; ++i) {
+            sets.push_back(generate(random, count));
+            tables.push_back(build(sets.back()));
+        }
+
+        size_t transitions = 0;
+
+        for (size_t i = 0; i < sets.size(); ++i) {
+            transitions += tables[i].count;
+
+            for (Clock_Time time = 0; time < MinutesPerDay; ++time) {
+                mismatches += ScheduleTable_isOn(&tables[i], time) != scanIsOn(sets[i], time);
+            }
+        }
+
+        // Every set is looked up at every minute of the day
+        const size_t calls = sets.size() * MinutesPerDay;
+        volatile bool sink = false;
+
+        const double buildTime = nanosecondsPerCall(sets.size() * 10, [&](const size_t i) {
+            ScheduleTable table = build(sets[i % sets.size()]);
+            sink = table.alwaysOn;
+        });
+
+        const double scanTime = nanosecondsPerCall(calls, [&](const size_t i) {
+            sink = scanIsOn(sets[i / MinutesPerDay], static_cast<Clock_Time>(i % MinutesPerDay));
+        });
+
+        const double isOnTime = nanosecondsPerCall(calls, [&](const size_t i) {
+            sink = ScheduleTable_isOn(&tables[i / MinutesPerDay], static_cast<Clock_Time>(i % MinutesPerDay));
+        });
+
+        const double nextTime = nanosecondsPerCall(calls, [&](const size_t i) {
+            sink = ScheduleTable_nextTransition(
+                &tables[i / MinutesPerDay],
+                static_cast<Clock_Time>(i % MinutesPerDay)
+            ) != nullptr;
+        });
+
+        std::printf("%9zu   %11.1f   %10.1f   %14.1f   %14.1f   %14.1f\n",
+            count,
+            static_cast<double>(transitions) / sets.size(),
+            buildTime,
+            scanTime,
+            isOnTime,
+            nextTime
+        );
+    }
+
+    if (mismatches > 0) {
+        std::printf("\nThe table differs from the scan at %zu minutes\n", mismatches);
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,379 @@
+/*
+ * Runs the scheduler modules of the firmware for a fleet of devices, each
+ * with its own location, time zone, power source and intervals, on
+ * a work-stealing thread pool (see Simulation.hpp and ThreadPool.hpp).
+ *
+ * The fleet is generated randomly or loaded from a file with one device per
+ * line:
+ *
+ *     LATITUDE LONGITUDE TIMEZONE mains|battery ON,OFF [ON,OFF ...]
+ *
+ * The simulation can be repeated with different thread counts to measure
+ * the scaling, the results must be the same in every run.
+ *
+ * The exit code is non-zero if a switch of any device was late, missed or
+ * spurious.
+ */
+
+#include "Simulation.hpp"
+#include "../ThreadPool.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using namespace host::schedule;
+
+struct Options {
+    size_t devices = 1000;
+    uint64_t seed = 1;
+    std::string fleetPath;
+    std::chrono::year_month_day start{ std::chrono::year{ 2024 }, std::chrono::January, std::chrono::day{ 1 } };
+    unsigned days = 30;
+    std::vector<unsigned> threads;
+    bool scaling = false;
+};
+
+struct Run {
+    unsigned threads = 0;
+    double seconds = 0;
+    uint64_t steals = 0;
+    Statistics total;
+    std::vector<size_t> failed;
+};
+
+void printUsage(const char* program)
+{
+    std::printf(
+        "Usage: %s [options]\n"
+        "  --devices N              Number of generated devices (default: 1000)\n"
+        "  --seed N                 Seed of the generated fleet (default: 1)\n"
+        "  --fleet FILE             Load the devices from the file\n"
+        "  --start YYYY-MM-DD       First simulated day (default: 2024-01-01)\n"
+        "  --days N                 Simulated days per device (default: 30)\n"
+        "  --threads N[,N...]       Thread counts of the runs (default: all cores)\n"
+        "  --scaling                Run with 1, 2, 4, ... threads up to all cores\n",
+        program
+    );
+}
+
+std::string formatSwitchTime(const unsigned minutes)
+{
+    char buffer[8];
+    std::snprintf(buffer, sizeof(buffer), "%02u:%02u", minutes / 60 % 24, minutes % 60);
+    return buffer;
+}
+
+std::string formatSunSwitch(const char* event, const int offset)
+{
+    char buffer[16];
+    std::snprintf(buffer, sizeof(buffer), "%s%+d", event, offset);
+    return buffer;
+}
+
+/*
+ * Typical setups: lights in the evening until a fixed time, in the morning
+ * until the sunrise, or through the night.
+ */
+std::vector<DeviceConfig> generateFleet(const size_t count, const uint64_t seed)
+{
+    std::mt19937_64 random{ seed };
+
+    const auto uniform = [&](const int low, const int high) {
+        return std::uniform_int_distribution<int>{ low, high }(random);
+    };
+
+    std::vector<DeviceConfig> fleet(count);
+
+    for (auto& device : fleet) {
+        const Location location{
+            std::uniform_real_distribution<double>{ -60, 65 }(random),
+            std::uniform_real_distribution<double>{ -180, 180 }(random)
+        };
+
+        device.location = location;
+        device.timeZoneHours = std::round(location.longitude / 15) + (uniform(0, 9) == 0 ? 0.5 : 0);
+        device.battery = uniform(0, 4) == 0;
+
+        const int intervals = uniform(1, 3);
+
+        for (int i = 0; i < intervals; ++i) {
+            std::string on;
+            std::string off;
+
+            switch (uniform(0, 2)) {
+                case 0:
+                    on = uniform(0, 1)
+                        ? formatSunSwitch("sunset", uniform(-60, 60))
+                        : formatSwitchTime(static_cast<unsigned>(uniform(17 * 60, 20 * 60)));
+                    off = formatSwitchTime(static_cast<unsigned>(uniform(21 * 60, 24 * 60 + 59)));
+                    break;
+
+                case 1:
+                    on = formatSwitchTime(static_cast<unsigned>(uniform(5 * 60, 7 * 60)));
+                    off = formatSunSwitch("sunrise", uniform(-30, 60));
+                    break;
+
+                default:
+                    on = formatSunSwitch("sunset", uniform(-30, 30));
+                    off = formatSunSwitch("sunrise", uniform(-30, 30));
+                    break;
+            }
+
+            device.intervals.push_back(on + "," + off);
+        }
+    }
+
+    return fleet;
+}
+
+bool loadFleet(const std::string& path, std::vector<DeviceConfig>& fleet)
+{
+    std::ifstream file{ path };
+    if (!file) {
+        return false;
+    }
+
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+
+        std::istringstream fields{ line };
+        Location location;
+        DeviceConfig device;
+        std::string power;
+
+        if (!(fields >> location.latitude >> location.longitude >> device.timeZoneHours >> power)) {
+            return false;
+        }
+
+        if (power != "mains" && power != "battery") {
+            return false;
+        }
+
+        device.location = location;
+        device.battery = power == "battery";
+
+        for (std::string interval; fields >> interval;) {
+            device.intervals.push_back(interval);
+        }
+
+        if (!isValid(device)) {
+            return false;
+        }
+
+        fleet.push_back(std::move(device));
+    }
+
+    return true;
+}
+
+bool parseThreads(const char* text, std::vector<unsigned>& threads)
+{
+    std::istringstream list{ text };
+
+    for (std::string item; std::getline(list, item, ',');) {
+        const int count = std::atoi(item.c_str());
+        if (count <= 0) {
+            return false;
+        }
+        threads.push_back(static_cast<unsigned>(count));
+    }
+
+    return !threads.empty();
+}
+
+Run runFleet(
+    const std::vector<DeviceConfig>& fleet,
+    const Options& options,
+    const std::chrono::year_month_day end,
+    const unsigned threads
+) {
+    std::vector<Statistics> results(fleet.size());
+    host::ThreadPool pool{ threads };
+
+    const auto start = std::chrono::steady_clock::now();
+
+    pool.run(fleet.size(), [&](const size_t index) {
+        results[index] = simulate(fleet[index], options.start, end);
+    });
+
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    Run run;
+    run.threads = pool.threads();
+    run.seconds = elapsed.count();
+    run.steals = pool.steals();
+
+    // Summed in the order of the devices, independently of the scheduling
+    for (size_t i = 0; i < results.size(); ++i) {
+        run.total += results[i];
+
+        if (!results[i].passed()) {
+            run.failed.push_back(i);
+        }
+    }
+
+    return run;
+}
+
+}
+
+int main(int argc, char* argv[])
+{
+    Options options;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+        bool valid = true;
+
+        if (arg == "--devices" && value) {
+            const int devices = std::atoi(value);
+            valid = devices > 0;
+            options.devices = static_cast<size_t>(devices);
+            ++i;
+        } else if (arg == "--seed" && value) {
+            options.seed = std::strtoull(value, nullptr, 10);
+            ++i;
+        } else if (arg == "--fleet" && value) {
+            options.fleetPath = value;
+            ++i;
+        } else if (arg == "--start" && value) {
+            const auto date = parseDate(value);
+            valid = date.has_value();
+            options.start = date.value_or(options.start);
+            ++i;
+        } else if (arg == "--days" && value) {
+            const int days = std::atoi(value);
+            valid = days > 0;
+            options.days = static_cast<unsigned>(days);
+            ++i;
+        } else if (arg == "--threads" && value) {
+            valid = parseThreads(value, options.threads);
+            ++i;
+        } else if (arg == "--scaling") {
+            options.scaling = true;
+        } else {
+            valid = false;
+        }
+
+        if (!valid) {
+            printUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    const std::chrono::year_month_day end{
+        std::chrono::sys_days{ options.start } + std::chrono::days{ options.days }
+    };
+
+    if (static_cast<int>(end.year()) > 2100) {
+        printUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    std::vector<DeviceConfig> fleet;
+
+    if (options.fleetPath.empty()) {
+        fleet = generateFleet(options.devices, options.seed);
+    } else if (!loadFleet(options.fleetPath, fleet) || fleet.empty()) {
+        std::fprintf(stderr, "Invalid fleet file: %s\n", options.fleetPath.c_str());
+        return EXIT_FAILURE;
+    }
+
+    const unsigned cores = std::max(std::thread::hardware_concurrency(), 1u);
+
+    if (options.scaling) {
+        for (unsigned threads = 1; threads < cores; threads *= 2) {
+            options.threads.push_back(threads);
+        }
+        options.threads.push_back(cores);
+    } else if (options.threads.empty()) {
+        options.threads.push_back(cores);
+    }
+
+    size_t battery = 0;
+    for (const auto& device : fleet) {
+        battery += device.battery;
+    }
+
+    std::printf("Fleet:             %zu devices (%zu on battery), %u days from %04d-%02u-%02u, %u cores\n\n",
+        fleet.size(),
+        battery,
+        options.days,
+        static_cast<int>(options.start.year()),
+        static_cast<unsigned>(options.start.month()),
+        static_cast<unsigned>(options.start.day()),
+        cores
+    );
+
+    std::printf("Threads   Time (s)   Device-days/s   Speedup   Efficiency   Steals\n");
+
+    std::vector<Run> runs;
+
+    for (const unsigned threads : options.threads) {
+        runs.push_back(runFleet(fleet, options, end, threads));
+
+        const auto& run = runs.back();
+        const auto& base = runs.front();
+
+        // Relative to the first run
+        const double speedup = run.seconds > 0 ? base.seconds / run.seconds : 0;
+        const double efficiency = speedup * base.threads / run.threads;
+
+        std::printf("%7u   %8.3f   %13.0f   %6.2fx   %9.0f%%   %6llu\n",
+            run.threads,
+            run.seconds,
+            run.seconds > 0 ? run.total.days / run.seconds : 0.0,
+            speedup,
+            efficiency * 100,
+            static_cast<unsigned long long>(run.steals)
+        );
+    }
+
+    const Run& result = runs.front();
+    bool consistent = true;
+
+    for (const auto& run : runs) {
+        consistent = consistent && run.total == result.total && run.failed == result.failed;
+    }
+
+    std::printf("\n");
+    printStatistics(result.total);
+    std::printf("Failed devices:    %zu\n", result.failed.size());
+
+    for (size_t i = 0; i < result.failed.size() && i < 10; ++i) {
+        const auto& device = fleet[result.failed[i]];
+        const auto location = device.location.value_or(Location{});
+
+        std::printf("  #%-6zu %9.4f %9.4f %+5.1f %-7s",
+            result.failed[i],
+            location.latitude,
+            location.longitude,
+            device.timeZoneHours,
+            device.battery ? "battery" : "mains"
+        );
+        for (const auto& interval : device.intervals) {
+            std::printf(" %s", interval.c_str());
+        }
+        std::printf("\n");
+    }
+
+    if (!consistent) {
+        std::printf("The results of the runs differ\n");
+    }
+
+    return consistent && result.failed.empty() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
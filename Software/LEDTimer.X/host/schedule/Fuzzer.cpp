@@ -0,0 +1,680 @@
+/*
+ * Differential fuzzer of OutputController_getNextTransition().
+ *
+ * Random interval sets (time, sunrise and sunset relative switches, with
+ * a bias to the corner cases: midnight, equal and shared switch times) are
+ * loaded into the settings, and the next transition after random times of
+ * the day is compared with a minute-by-minute scan of the intervals. The
+ * interval sets are split into chunks with their own seeds on the
+ * work-stealing thread pool, so a failure can be reproduced from the seed.
+ * Failing inputs are minimized before they are printed.
+ *
+ * The benchmark measures the cost of a call with the compiled schedule
+ * (cached) and with the schedule compiled again (after a change of the
+ * settings or the sunrise / sunset time) by the number of active intervals.
+ */
+
+#include "../ThreadPool.hpp"
+
+#include <xc.h>
+
+extern "C" {
+#include <OutputController.h>
+#include <Settings.h>
+#include <SunsetSunrise.h>
+
+// The output stage is not simulated
+bool System_isRunningFromBackupBattery(void);
+void Fader_setTarget(uint8_t level, uint16_t durationSeconds);
+}
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Sunrise and sunset times of the case being checked
+static thread_local Clock_Time sunrise = 0;
+static thread_local Clock_Time sunset = 0;
+
+Clock_Time SunriseSunset_getSunrise(void)
+{
+    return sunrise;
+}
+
+Clock_Time SunriseSunset_getSunset(void)
+{
+    return sunset;
+}
+
+void SunriseSunset_update(void)
+{
+}
+
+bool System_isRunningFromBackupBattery(void)
+{
+    return false;
+}
+
+void Fader_setTarget(uint8_t, uint16_t)
+{
+}
+
+namespace {
+
+constexpr Clock_Time MinutesPerDay = 1440;
+constexpr size_t IntervalCount = Config_Settings_IntervalScheduleCount;
+
+using Interval = IntervalScheduler;
+using Switch = IntervalSwitch;
+
+struct Case {
+    std::array<Interval, IntervalCount> intervals{};
+    Clock_Time sunrise = 0;
+    Clock_Time sunset = 0;
+    Clock_Time time = 0;
+};
+
+struct Result {
+    bool found = false;
+    int8_t index = 0;
+    bool on = false;
+    Clock_Time time = 0;
+
+    bool operator==(const Result& other) const = default;
+};
+
+struct Failure {
+    uint64_t seed = 0;
+    Case input;
+    Result expected;
+    Result actual;
+};
+
+struct Options {
+    uint64_t sets = 1'000'000;
+    uint64_t seed = 1;
+    unsigned threads = std::max(std::thread::hardware_concurrency(), 1u);
+    bool benchmark = true;
+};
+
+// Interval sets of a chunk of the thread pool, the queries per set
+constexpr uint64_t ChunkSets = 10'000;
+constexpr unsigned QueriesPerSet = 16;
+constexpr size_t MaxReportedFailures = 5;
+
+void printUsage(const char* program)
+{
+    std::printf(
+        "Usage: %s [options]\n"
+        "  --sets N                 Random interval sets (default: 1000000)\n"
+        "  --seed N                 Seed of the first chunk (default: 1)\n"
+        "  --threads N              Worker threads (default: all cores)\n"
+        "  --no-benchmark           Skip the benchmark\n",
+        program
+    );
+}
+
+/*
+ * Reference
+ */
+
+Clock_Time switchTime(const Switch& sw, const Case& input)
+{
+    switch (sw.type) {
+        case Settings_IntervalSwitchType_Sunrise:
+            return static_cast<Clock_Time>((input.sunrise + sw.sunOffset + MinutesPerDay) % MinutesPerDay);
+        case Settings_IntervaSwitchType_Sunset:
+            return static_cast<Clock_Time>((input.sunset + sw.sunOffset + MinutesPerDay) % MinutesPerDay);
+        default:
+            return static_cast<Clock_Time>(sw.timeHour * 60 + sw.timeMinute);
+    }
+}
+
+/*
+ * State of the intervals for every minute of the day. The next transition
+ * is found by scanning the minutes after the specified time for the first
+ * change of the state, it belongs to the first interval switching in that
+ * direction at that minute.
+ */
+class Reference
+{
+public:
+    explicit Reference(const Case& input) : m_input{ input }
+    {
+        const auto begin = m_states.begin();
+
+        for (size_t i = 0; i < IntervalCount; ++i) {
+            m_on[i] = switchTime(input.intervals[i].onSwitch, input);
+            m_off[i] = switchTime(input.intervals[i].offSwitch, input);
+
+            if (!input.intervals[i].active) {
+                continue;
+            }
+
+            // Intervals with the same on and off times are empty
+            if (m_on[i] < m_off[i]) {
+                std::fill(begin + m_on[i], begin + m_off[i], true);
+            } else if (m_on[i] > m_off[i]) {
+                std::fill(begin + m_on[i], m_states.end(), true);
+                std::fill(begin, begin + m_off[i], true);
+            }
+        }
+    }
+
+    [[nodiscard]] Result next(const Clock_Time time) const
+    {
+        const auto begin = m_states.begin();
+        const auto start = begin + time + 1;
+        const bool state = !m_states[static_cast<size_t>(time)];
+
+        // Wraps around to the same time on the next day
+        auto change = std::find(start, m_states.end(), state);
+        if (change == m_states.end()) {
+            change = std::find(begin, start, state);
+            if (change == start) {
+                return {};
+            }
+        }
+
+        const auto minute = static_cast<Clock_Time>(change - begin);
+
+        return { true, switchingInterval(minute, state), state, minute };
+    }
+
+private:
+    [[nodiscard]] int8_t switchingInterval(const Clock_Time minute, const bool on) const
+    {
+        for (size_t i = 0; i < IntervalCount; ++i) {
+            if (
+                m_input.intervals[i].active
+                && m_on[i] != m_off[i]
+                && (on ? m_on[i] : m_off[i]) == minute
+            ) {
+                return static_cast<int8_t>(i);
+            }
+        }
+
+        // A state change without a switch would be a bug of the reference
+        return -1;
+    }
+
+    const Case& m_input;
+    std::array<Clock_Time, IntervalCount> m_on{};
+    std::array<Clock_Time, IntervalCount> m_off{};
+    std::array<bool, MinutesPerDay> m_states{};
+};
+
+Result bruteForce(const Case& input)
+{
+    return Reference{ input }.next(input.time);
+}
+
+/*
+ * Production code
+ */
+
+// Loads the intervals into the settings, the schedule is compiled again
+// by the next query
+void load(const Case& input)
+{
+    for (size_t i = 0; i < IntervalCount; ++i) {
+        Settings_packInterval(&Settings_data.scheduler.intervals[i], &input.intervals[i]);
+    }
+
+    sunrise = input.sunrise;
+    sunset = input.sunset;
+    OutputController_invalidateSchedule();
+}
+
+Result query(const Clock_Time time)
+{
+    Result result;
+    result.found = OutputController_getNextTransition(
+        time,
+        &result.index,
+        &result.on,
+        &result.time
+    );
+
+    if (!result.found) {
+        result = {};
+    }
+
+    return result;
+}
+
+Result nextTransition(const Case& input)
+{
+    load(input);
+    return query(input.time);
+}
+
+/*
+ * Generator
+ */
+
+class Generator
+{
+public:
+    explicit Generator(const uint64_t seed) : m_random{ seed } {}
+
+    [[nodiscard]] Case generate()
+    {
+        Case input;
+
+        input.sunrise = minute();
+        input.sunset = chance(4) ? input.sunrise : minute();
+
+        // Mostly a few active intervals, the day is covered by many of them
+        const size_t active = chance(2) ? uniform(0, 5) : uniform(0, IntervalCount);
+
+        for (auto& interval : input.intervals) {
+            interval.active = uniform(1, IntervalCount) <= active;
+            randomSwitch(interval.onSwitch);
+            randomSwitch(interval.offSwitch, &interval.onSwitch);
+        }
+
+        // Shared switch times between the intervals
+        if (chance(3)) {
+            auto& target = input.intervals[uniform(0, IntervalCount - 1)];
+            const auto& source = input.intervals[uniform(0, IntervalCount - 1)];
+            (chance(2) ? target.onSwitch : target.offSwitch) =
+                chance(2) ? source.onSwitch : source.offSwitch;
+        }
+
+        return input;
+    }
+
+    // Query time, often at a switch time or next to it
+    [[nodiscard]] Clock_Time time(const Case& input)
+    {
+        if (chance(2)) {
+            return minute();
+        }
+
+        const auto& interval = input.intervals[uniform(0, IntervalCount - 1)];
+        const Clock_Time base = switchTime(chance(2) ? interval.onSwitch : interval.offSwitch, input);
+
+        return static_cast<Clock_Time>((base + uniform(0, 2) - 1 + MinutesPerDay) % MinutesPerDay);
+    }
+
+private:
+    [[nodiscard]] size_t uniform(const size_t low, const size_t high)
+    {
+        return std::uniform_int_distribution<size_t>{ low, high }(m_random);
+    }
+
+    // True with a probability of 1 / n
+    [[nodiscard]] bool chance(const size_t n)
+    {
+        return uniform(1, n) == 1;
+    }
+
+    // Minute of the day, midnight and the end of the day are favored
+    [[nodiscard]] Clock_Time minute()
+    {
+        switch (uniform(0, 7)) {
+            case 0: return 0;
+            case 1: return MinutesPerDay - 1;
+            default: return static_cast<Clock_Time>(uniform(0, MinutesPerDay - 1));
+        }
+    }
+
+    void randomSwitch(Switch& sw, const Switch* pair = nullptr)
+    {
+        // Empty intervals
+        if (pair && chance(10)) {
+            sw = *pair;
+            return;
+        }
+
+        sw = {};
+        sw.type = static_cast<uint8_t>(uniform(
+            Settings_IntervalSwitchType_Time,
+            Settings_IntervaSwitchType_Sunset
+        ));
+
+        const Clock_Time time = minute();
+        sw.timeHour = static_cast<uint8_t>(time / 60);
+        sw.timeMinute = static_cast<uint8_t>(time % 60);
+
+        // Offsets from the UI range and the full range of the field
+        sw.sunOffset = static_cast<int8_t>(
+            chance(2)
+                ? static_cast<int>(uniform(0, 120)) - 60
+                : static_cast<int>(uniform(0, 255)) - 128
+        );
+    }
+
+    std::mt19937_64 m_random;
+};
+
+/*
+ * Minimizer
+ */
+
+bool fails(const Case& input)
+{
+    return bruteForce(input) != nextTransition(input);
+}
+
+/*
+ * Simplifies the failing input step by step while it still fails:
+ * disables intervals, turns the switches into fixed times and moves the
+ * times toward midnight.
+ */
+Case minimize(Case input)
+{
+    bool progress = true;
+
+    const auto attempt = [&](const Case& candidate) {
+        if (fails(candidate)) {
+            input = candidate;
+            progress = true;
+        }
+    };
+
+    while (progress) {
+        progress = false;
+
+        for (size_t i = 0; i < IntervalCount; ++i) {
+            if (input.intervals[i].active) {
+                Case candidate = input;
+                candidate.intervals[i].active = 0;
+                attempt(candidate);
+            }
+
+            for (const bool on : { true, false }) {
+                const auto current = [&](Case& c) -> Switch& {
+                    return on ? c.intervals[i].onSwitch : c.intervals[i].offSwitch;
+                };
+
+                if (current(input).type != Settings_IntervalSwitchType_Time) {
+                    Case candidate = input;
+                    const Clock_Time time = switchTime(current(candidate), candidate);
+                    current(candidate) = {};
+                    current(candidate).timeHour = static_cast<uint8_t>(time / 60);
+                    current(candidate).timeMinute = static_cast<uint8_t>(time % 60);
+                    attempt(candidate);
+                } else if (current(input).timeHour > 0 || current(input).timeMinute > 0) {
+                    Case candidate = input;
+                    const Clock_Time time = switchTime(current(candidate), candidate);
+                    const auto smaller = static_cast<Clock_Time>(time / 2);
+                    current(candidate).timeHour = static_cast<uint8_t>(smaller / 60);
+                    current(candidate).timeMinute = static_cast<uint8_t>(smaller % 60);
+                    attempt(candidate);
+                }
+            }
+        }
+
+        if (input.time > 0) {
+            Case candidate = input;
+            candidate.time = static_cast<Clock_Time>(input.time / 2);
+            attempt(candidate);
+        }
+    }
+
+    return input;
+}
+
+/*
+ * Reporting
+ */
+
+std::string formatSwitch(const Switch& sw)
+{
+    char buffer[24];
+
+    switch (sw.type) {
+        case Settings_IntervalSwitchType_Sunrise:
+            std::snprintf(buffer, sizeof(buffer), "sunrise%+d", sw.sunOffset);
+            break;
+        case Settings_IntervaSwitchType_Sunset:
+            std::snprintf(buffer, sizeof(buffer), "sunset%+d", sw.sunOffset);
+            break;
+        default:
+            std::snprintf(buffer, sizeof(buffer), "%02u:%02u", sw.timeHour, sw.timeMinute);
+            break;
+    }
+
+    return buffer;
+}
+
+std::string formatTime(const Clock_Time time)
+{
+    assert(time < 1440);
+
+    // Bounded to 3 digits each, so the result always fits the buffer
+    const uint8_t hours = static_cast<uint8_t>(time / 60);
+    const uint8_t minutes = static_cast<uint8_t>(time % 60);
+
+    char buffer[8];
+    std::snprintf(buffer, sizeof(buffer), "%02u:%02u", hours, minutes);
+    return buffer;
+}
+
+std::string formatResult(const Result& result)
+{
+    if (!result.found) {
+        return "none";
+    }
+
+    return formatTime(result.time) + (result.on ? " on" : " off")
+        + " (interval " + std::to_string(result.index) + ")";
+}
+
+void printFailure(const Failure& failure)
+{
+    const Case& input = failure.input;
+
+    std::printf("Chunk seed %llu, minimized input:\n",
+        static_cast<unsigned long long>(failure.seed)
+    );
+    std::printf("  sunrise %s, sunset %s, time %s\n",
+        formatTime(input.sunrise).c_str(),
+        formatTime(input.sunset).c_str(),
+        formatTime(input.time).c_str()
+    );
+    for (size_t i = 0; i < IntervalCount; ++i) {
+        if (input.intervals[i].active) {
+            std::printf("  interval %zu: %s .. %s\n",
+                i,
+                formatSwitch(input.intervals[i].onSwitch).c_str(),
+                formatSwitch(input.intervals[i].offSwitch).c_str()
+            );
+        }
+    }
+    std::printf("  expected: %s\n", formatResult(failure.expected).c_str());
+    std::printf("  actual:   %s\n", formatResult(failure.actual).c_str());
+}
+
+/*
+ * Benchmark
+ */
+
+template<typename Function>
+double nanosecondsPerCall(const size_t calls, Function&& function)
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    for (size_t i = 0; i < calls; ++i) {
+        function(i);
+    }
+
+    const std::chrono::duration<double, std::nano> elapsed =
+        std::chrono::steady_clock::now() - start;
+
+    return elapsed.count() / calls;
+}
+
+void benchmark(const uint64_t seed)
+{
+    constexpr size_t Calls = 2'000'000;
+    constexpr size_t Rebuilds = 200'000;
+
+    Generator generator{ seed };
+
+    std::printf("\nActive intervals   Cached (ns/call)   Compiled again (ns/call)\n");
+
+    for (const size_t active : { 0, 1, 2, 5, 16, 32 }) {
+        if (active > IntervalCount) {
+            break;
+        }
+
+        Case input = generator.generate();
+
+        for (size_t i = 0; i < IntervalCount; ++i) {
+            input.intervals[i].active = i < active;
+        }
+
+        // Loads the settings and compiles the schedule
+        (void)nextTransition(input);
+
+        int8_t index = 0;
+        bool on = false;
+        Clock_Time time = 0;
+        volatile bool sink = false;
+
+        const double cached = nanosecondsPerCall(Calls, [&](const size_t i) {
+            sink = OutputController_getNextTransition(
+                static_cast<Clock_Time>(i % MinutesPerDay), &index, &on, &time
+            );
+        });
+
+        const double compiled = nanosecondsPerCall(Rebuilds, [&](const size_t i) {
+            OutputController_invalidateSchedule();
+            sink = OutputController_getNextTransition(
+                static_cast<Clock_Time>(i % MinutesPerDay), &index, &on, &time
+            );
+        });
+
+        std::printf("%16zu   %16.1f   %24.1f\n", active, cached, compiled);
+    }
+}
+
+}
+
+int main(int argc, char* argv[])
+{
+    Options options;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+        bool valid = true;
+
+        if (arg == "--sets" && value) {
+            options.sets = std::strtoull(value, nullptr, 10);
+            ++i;
+        } else if (arg == "--seed" && value) {
+            options.seed = std::strtoull(value, nullptr, 10);
+            ++i;
+        } else if (arg == "--threads" && value) {
+            const int threads = std::atoi(value);
+            valid = threads > 0;
+            options.threads = static_cast<unsigned>(threads);
+            ++i;
+        } else if (arg == "--no-benchmark") {
+            options.benchmark = false;
+        } else {
+            valid = false;
+        }
+
+        if (!valid) {
+            printUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    const uint64_t chunks = (options.sets + ChunkSets - 1) / ChunkSets;
+
+    std::atomic<uint64_t> failureCount{ 0 };
+    std::vector<Failure> failures;
+    std::mutex failuresMutex;
+
+    host::ThreadPool pool{ options.threads };
+
+    const auto start = std::chrono::steady_clock::now();
+
+    pool.run(chunks, [&](const size_t chunk) {
+        // The settings of the worker thread
+        Settings_loadDefaults();
+        Settings_data.scheduler.type = Settings_SchedulerType_Interval;
+
+        const uint64_t seed = options.seed + chunk;
+        const uint64_t sets = std::min(ChunkSets, options.sets - chunk * ChunkSets);
+        Generator generator{ seed };
+
+        for (uint64_t set = 0; set < sets; ++set) {
+            Case input = generator.generate();
+            const Reference reference{ input };
+
+            load(input);
+
+            for (unsigned i = 0; i < QueriesPerSet; ++i) {
+                input.time = generator.time(input);
+
+                const Result expected = reference.next(input.time);
+                const Result actual = query(input.time);
+
+                if (expected == actual) {
+                    continue;
+                }
+
+                // Only the first few failures are minimized and reported
+                if (failureCount.fetch_add(1) < MaxReportedFailures) {
+                    const Case minimized = minimize(input);
+                    Failure failure{ seed, minimized, bruteForce(minimized), nextTransition(minimized) };
+
+                    {
+                        std::lock_guard lock{ failuresMutex };
+                        failures.push_back(failure);
+                    }
+
+                    load(input);
+                }
+            }
+        }
+    });
+
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    const double queries = static_cast<double>(options.sets) * QueriesPerSet;
+
+    std::printf("Interval sets:     %llu (%u queries each)\n",
+        static_cast<unsigned long long>(options.sets),
+        QueriesPerSet
+    );
+    std::printf("Threads:           %u (%llu steals)\n",
+        pool.threads(),
+        static_cast<unsigned long long>(pool.steals())
+    );
+    std::printf("Host time:         %.3f s (%.2f M cases/s)\n",
+        elapsed.count(),
+        elapsed.count() > 0 ? queries / elapsed.count() / 1e6 : 0.0
+    );
+    std::printf("Failures:          %llu\n",
+        static_cast<unsigned long long>(failureCount.load())
+    );
+
+    for (const auto& failure : failures) {
+        printFailure(failure);
+    }
+
+    if (options.benchmark) {
+        Settings_loadDefaults();
+        Settings_data.scheduler.type = Settings_SchedulerType_Interval;
+        benchmark(options.seed);
+    }
+
+    return failureCount == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
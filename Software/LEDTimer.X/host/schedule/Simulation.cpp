@@ -0,0 +1,598 @@
+#include "Simulation.hpp"
+
+#include <xc.h>
+
+extern "C" {
+#include <Clock.h>
+#include <OutputController.h>
+#include <Settings.h>
+#include <SunsetSunrise.h>
+#include <Types.h>
+
+extern Utils_InstanceStorage Clock_InterruptContext Clock_interruptContext;
+
+// The output stage is not simulated
+bool System_isRunningFromBackupBattery(void);
+void Fader_setTarget(uint8_t level, uint16_t durationSeconds);
+}
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+static thread_local bool runningFromBattery = false;
+
+bool System_isRunningFromBackupBattery(void)
+{
+    return runningFromBattery;
+}
+
+void Fader_setTarget(uint8_t, uint16_t)
+{
+}
+
+// The interrupt handler macro declares the context at block scope, so the
+// RTC is not in the namespace
+static void rtcOverflow()
+{
+    Clock_handleRTCTimerInterrupt();
+}
+
+namespace host::schedule {
+
+namespace {
+
+constexpr int32_t SecondsPerDay = 86400;
+constexpr int16_t MinutesPerDay = 1440;
+
+using Switch = IntervalSwitch;
+
+struct Transition {
+    Date_Epoch time;        // Local time
+    bool on;
+};
+
+// Reference state of the schedule for one day
+struct ReferenceDay {
+    std::array<Clock_Time, Config_Settings_IntervalScheduleCount> on{};
+    std::array<Clock_Time, Config_Settings_IntervalScheduleCount> off{};
+    std::array<bool, Config_Settings_IntervalScheduleCount> active{};
+
+    [[nodiscard]] bool isOn(const Clock_Time minute) const {
+        for (size_t i = 0; i < on.size(); ++i) {
+            if (!active[i]) {
+                continue;
+            }
+
+            const bool inside = on[i] <= off[i]
+                ? minute >= on[i] && minute < off[i]
+                : minute >= on[i] || minute < off[i];
+
+            if (inside) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+};
+
+bool parseSwitch(const std::string& text, Switch& sw)
+{
+    unsigned hour = 0;
+    unsigned minute = 0;
+    char end = 0;
+
+    if (std::sscanf(text.c_str(), "%u:%u%c", &hour, &minute, &end) == 2) {
+        if (hour > 23 || minute > 59) {
+            return false;
+        }
+
+        sw.type = Settings_IntervalSwitchType_Time;
+        sw.timeHour = static_cast<uint8_t>(hour);
+        sw.timeMinute = static_cast<uint8_t>(minute);
+
+        return true;
+    }
+
+    std::string offset;
+
+    if (text.rfind("sunrise", 0) == 0) {
+        sw.type = Settings_IntervalSwitchType_Sunrise;
+        offset = text.substr(7);
+    } else if (text.rfind("sunset", 0) == 0) {
+        sw.type = Settings_IntervaSwitchType_Sunset;
+        offset = text.substr(6);
+    } else {
+        return false;
+    }
+
+    int minutes = 0;
+
+    if (!offset.empty() && std::sscanf(offset.c_str(), "%d%c", &minutes, &end) != 1) {
+        return false;
+    }
+
+    if (minutes < INT8_MIN || minutes > INT8_MAX) {
+        return false;
+    }
+
+    sw.sunOffset = static_cast<int8_t>(minutes);
+
+    return true;
+}
+
+bool parseInterval(const std::string& text, const size_t index)
+{
+    const auto comma = text.find(',');
+
+    if (index >= Config_Settings_IntervalScheduleCount || comma == std::string::npos) {
+        return false;
+    }
+
+    IntervalScheduler interval{};
+    interval.active = 1;
+
+    if (
+        !parseSwitch(text.substr(0, comma), interval.onSwitch)
+        || !parseSwitch(text.substr(comma + 1), interval.offSwitch)
+    ) {
+        return false;
+    }
+
+    Settings_packInterval(&Settings_data.scheduler.intervals[index], &interval);
+
+    return true;
+}
+
+// Degrees to the BCD format of the settings: 3 integer and 5 fraction digits
+uint32_t degreesToBcd(const double degrees)
+{
+    auto value = static_cast<uint32_t>(std::lround(std::fabs(degrees) * 100000));
+    uint32_t bcd = 0;
+
+    for (unsigned shift = 0; shift < 32; shift += 4) {
+        bcd |= (value % 10) << shift;
+        value /= 10;
+    }
+
+    return bcd;
+}
+
+// Loads the configuration into the settings of the calling thread
+bool applyConfig(const DeviceConfig& config)
+{
+    Settings_loadDefaults();
+    Settings_data.scheduler.type = Settings_SchedulerType_Interval;
+
+    if (config.location) {
+        const auto [latitude, longitude] = *config.location;
+
+        if (std::fabs(latitude) > 90 || std::fabs(longitude) > 180) {
+            return false;
+        }
+
+        Settings_data.location.latitudeBcd = degreesToBcd(latitude);
+        Settings_data.location.latitudeSign = latitude < 0;
+        Settings_data.location.longitudeBcd = degreesToBcd(longitude);
+        Settings_data.location.longitudeSign = longitude < 0;
+    }
+
+    if (std::fabs(config.timeZoneHours) > 14) {
+        return false;
+    }
+
+    Settings_data.time.timeZoneOffsetHalfHours =
+        static_cast<int8_t>(std::lround(config.timeZoneHours * 2));
+
+    for (size_t i = 0; i < config.intervals.size(); ++i) {
+        if (!parseInterval(config.intervals[i], i)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+Clock_Time sunEventTime(const Clock_Time eventTime, const int8_t offset)
+{
+    return static_cast<Clock_Time>(
+        (eventTime + offset + MinutesPerDay) % MinutesPerDay
+    );
+}
+
+ReferenceDay referenceDay(const std::chrono::year_month_day& date)
+{
+    using namespace std::chrono;
+
+    SunriseSunsetData data;
+
+    SunriseSunset_setPosition(
+        &data,
+        Types_bcdToFixedPoint(
+            Settings_data.location.longitudeBcd,
+            Settings_data.location.longitudeSign
+        ),
+        Types_bcdToFixedPoint(
+            Settings_data.location.latitudeBcd,
+            Settings_data.location.latitudeSign
+        )
+    );
+
+    SunriseSunset_setTimeZone(&data, Settings_data.time.timeZoneOffsetHalfHours, false);
+
+    const auto dayOfYear = static_cast<uint16_t>(
+        (sys_days{ date } - sys_days{ date.year() / January / 1 }).count() + 1
+    );
+
+    const Clock_Time sunrise = SunriseSunset_calculate(&data, false, dayOfYear);
+    const Clock_Time sunset = SunriseSunset_calculate(&data, true, dayOfYear);
+
+    ReferenceDay day;
+
+    for (size_t i = 0; i < Config_Settings_IntervalScheduleCount; ++i) {
+        IntervalScheduler interval;
+        Settings_unpackInterval(&Settings_data.scheduler.intervals[i], &interval);
+
+        const auto switchTime = [&](const Switch& sw) -> Clock_Time {
+            switch (sw.type) {
+                case Settings_IntervalSwitchType_Sunrise:
+                    return sunEventTime(sunrise, sw.sunOffset);
+                case Settings_IntervaSwitchType_Sunset:
+                    return sunEventTime(sunset, sw.sunOffset);
+                default:
+                    return static_cast<Clock_Time>(sw.timeHour * 60 + sw.timeMinute);
+            }
+        };
+
+        day.on[i] = switchTime(interval.onSwitch);
+        day.off[i] = switchTime(interval.offSwitch);
+        day.active[i] = interval.active;
+    }
+
+    return day;
+}
+
+bool isDst(const std::chrono::year_month_day& date)
+{
+    using namespace std::chrono;
+
+    const weekday dayOfWeek{ sys_days{ date } };
+    const auto lastDay = year_month_day_last{ date.year() / month_day_last{ date.month() } }.day();
+
+    return Date_isDst(
+        Settings_data.dst,
+        static_cast<uint8_t>(static_cast<unsigned>(date.month()) - 1),
+        static_cast<uint8_t>(static_cast<unsigned>(lastDay)),
+        static_cast<uint8_t>(static_cast<unsigned>(date.day())),
+        static_cast<uint8_t>(dayOfWeek.c_encoding()),
+        12
+    );
+}
+
+// Same as secondsUntilNextTask() of main.c
+uint16_t secondsUntilNextTask()
+{
+    uint16_t seconds = Clock_getSecondsUntil(0);
+
+    const Clock_Time change = OutputController_getNextScheduleChange(
+        Clock_getMinutesSinceMidnight()
+    );
+
+    if (change >= 0) {
+        seconds = std::min(seconds, Clock_getSecondsUntil(change));
+    }
+
+    return seconds;
+}
+
+Date_Epoch localEpoch()
+{
+    return Clock_interruptContext.utcEpoch
+        + static_cast<Date_Epoch>(Settings_data.time.timeZoneOffsetHalfHours * 30 * 60);
+}
+
+Date_Epoch epochOf(const std::chrono::year_month_day& date)
+{
+    return static_cast<Date_Epoch>(
+        std::chrono::sys_days{ date }.time_since_epoch() / std::chrono::seconds{ 1 }
+    );
+}
+
+std::string formatTime(const Date_Epoch epoch)
+{
+    using namespace std::chrono;
+
+    const sys_seconds time{ seconds{ epoch } };
+    const year_month_day date{ floor<days>(time) };
+    const hh_mm_ss clock{ time - floor<days>(time) };
+
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%04d-%02u-%02u %02ld:%02ld:%02ld",
+        static_cast<int>(date.year()),
+        static_cast<unsigned>(date.month()),
+        static_cast<unsigned>(date.day()),
+        static_cast<long>(clock.hours().count()),
+        static_cast<long>(clock.minutes().count()),
+        static_cast<long>(clock.seconds().count())
+    );
+
+    return buffer;
+}
+
+/*
+ * Matches the recorded transitions with the reference. A reference
+ * transition is on time if the output follows it in the same RTC tick,
+ * late if it follows before the next reference transition and missed
+ * otherwise. Recorded transitions without a reference are spurious.
+ */
+class Checker
+{
+public:
+    explicit Checker(Statistics& stats) : m_stats{ stats } {}
+
+    void expect(const Transition& transition, const bool output)
+    {
+        ++m_stats.expected;
+
+        if (m_hasPending) {
+            ++m_stats.missed;
+            m_hasPending = false;
+        }
+
+        // The output has the state already, a short pulse was missed
+        if (transition.on == output) {
+            ++m_stats.missed;
+            return;
+        }
+
+        m_pending = transition;
+        m_hasPending = true;
+    }
+
+    void record(const Transition& transition)
+    {
+        ++m_stats.transitions;
+
+        if (!m_hasPending || m_pending.on != transition.on) {
+            ++m_stats.spurious;
+            return;
+        }
+
+        const uint32_t latency = transition.time - m_pending.time;
+
+        if (latency == 0) {
+            ++m_stats.onTime;
+        } else {
+            ++m_stats.late;
+        }
+
+        ++m_stats.latencies[latency];
+
+        m_hasPending = false;
+    }
+
+    void finish()
+    {
+        if (m_hasPending) {
+            ++m_stats.missed;
+            m_hasPending = false;
+        }
+    }
+
+private:
+    Statistics& m_stats;
+    Transition m_pending{};
+    bool m_hasPending = false;
+};
+
+}
+
+Statistics& Statistics::operator+=(const Statistics& other)
+{
+    days += other.days;
+    leapDays += other.leapDays;
+    dstDays += other.dstDays;
+    wakeUps += other.wakeUps;
+    expected += other.expected;
+    transitions += other.transitions;
+    onTime += other.onTime;
+    late += other.late;
+    missed += other.missed;
+    spurious += other.spurious;
+    calendarErrors += other.calendarErrors;
+    minPerDay = std::min(minPerDay, other.minPerDay);
+    maxPerDay = std::max(maxPerDay, other.maxPerDay);
+
+    for (const auto& [latency, count] : other.latencies) {
+        latencies[latency] += count;
+    }
+
+    return *this;
+}
+
+bool isValid(const DeviceConfig& config)
+{
+    return applyConfig(config);
+}
+
+Statistics simulate(
+    const DeviceConfig& config,
+    const std::chrono::year_month_day first,
+    const std::chrono::year_month_day last,
+    FILE* const log
+) {
+    using namespace std::chrono;
+
+    Mock_reset(nullptr);
+
+    if (!applyConfig(config)) {
+        return {};
+    }
+
+    runningFromBattery = config.battery;
+
+    // Setting the time and the date resets the state of the clock, the
+    // schedule is compiled again like after a change of the settings
+    Clock_setDate(
+        static_cast<YearsFrom1970>(static_cast<int>(first.year()) - 1970),
+        static_cast<uint8_t>(static_cast<unsigned>(first.month())),
+        static_cast<uint8_t>(static_cast<unsigned>(first.day()))
+    );
+    Clock_setTime(0, 0);
+    Clock_task();
+    OutputController_invalidateSchedule();
+
+    Statistics stats;
+    Checker checker{ stats };
+
+    const Date_Epoch endEpoch = epochOf(last);
+
+    // State of the first minute, without a transition
+    ReferenceDay reference = referenceDay(first);
+    bool expectedState = reference.isOn(0);
+    Date_Epoch dayStart = epochOf(first);
+    Date_Epoch nextDay = dayStart + SecondsPerDay;
+    Date_Epoch nextMinute = dayStart;
+    year_month_day date = first;
+    uint64_t dayTransitions = 0;
+
+    stats.days = static_cast<uint64_t>((sys_days{ last } - sys_days{ first }).count());
+    stats.dstDays += isDst(date);
+    stats.leapDays += date.month() == February && date.day() == day{ 29 };
+
+    OutputController_task();
+    bool output = OutputController_outputEnableTargetState();
+
+    if (output != expectedState) {
+        ++stats.spurious;
+    }
+
+    for (Date_Epoch now = localEpoch(); now < endEpoch; now = localEpoch()) {
+        // Reference transitions up to the current RTC tick
+        while (nextMinute <= now) {
+            if (nextMinute >= nextDay) {
+                stats.minPerDay = std::min(stats.minPerDay, dayTransitions);
+                stats.maxPerDay = std::max(stats.maxPerDay, dayTransitions);
+                dayTransitions = 0;
+
+                dayStart = nextDay;
+                nextDay += SecondsPerDay;
+                date = year_month_day{ sys_days{ date } + days{ 1 } };
+                reference = referenceDay(date);
+
+                stats.dstDays += isDst(date);
+                stats.leapDays += date.month() == February && date.day() == day{ 29 };
+            }
+
+            const bool state = reference.isOn(
+                static_cast<Clock_Time>((nextMinute - dayStart) / 60)
+            );
+
+            if (state != expectedState) {
+                expectedState = state;
+                checker.expect({ nextMinute, state }, output);
+            }
+
+            nextMinute += 60;
+        }
+
+        // The main loop after a wake-up
+        Clock_task();
+        OutputController_task();
+        ++stats.wakeUps;
+
+        if (
+            Clock_getMinutesSinceMidnight() * 60u + Clock_getSeconds() != now - dayStart
+            || Clock_getDay() != static_cast<unsigned>(date.day())
+            || Clock_getMonth() != static_cast<unsigned>(date.month())
+        ) {
+            ++stats.calendarErrors;
+        }
+
+        const bool state = OutputController_outputEnableTargetState();
+
+        if (state != output) {
+            output = state;
+            ++dayTransitions;
+            checker.record({ now, state });
+
+            if (log) {
+                std::fprintf(log, "%s,%s\n", formatTime(now).c_str(), state ? "on" : "off");
+            }
+        }
+
+        if (config.battery) {
+            Clock_setSleepPeriod(secondsUntilNextTask());
+        }
+
+        rtcOverflow();
+    }
+
+    checker.finish();
+
+    stats.minPerDay = std::min(stats.minPerDay, dayTransitions);
+    stats.maxPerDay = std::max(stats.maxPerDay, dayTransitions);
+
+    return stats;
+}
+
+void printStatistics(const Statistics& stats)
+{
+    const double days = stats.days > 0 ? static_cast<double>(stats.days) : 1;
+
+    std::printf("Transitions:       %llu (%.2f per day, %llu..%llu)\n",
+        static_cast<unsigned long long>(stats.transitions),
+        stats.transitions / days,
+        static_cast<unsigned long long>(stats.transitions > 0 ? stats.minPerDay : 0),
+        static_cast<unsigned long long>(stats.maxPerDay)
+    );
+    std::printf("Expected:          %llu\n",
+        static_cast<unsigned long long>(stats.expected)
+    );
+    std::printf("On time:           %llu\n",
+        static_cast<unsigned long long>(stats.onTime)
+    );
+    std::printf("Late:              %llu (max. %u s)\n",
+        static_cast<unsigned long long>(stats.late),
+        stats.maxLatency()
+    );
+    for (const auto& [latency, count] : stats.latencies) {
+        if (latency > 0) {
+            std::printf("  %6u s:         %llu\n", latency, static_cast<unsigned long long>(count));
+        }
+    }
+    std::printf("Missed:            %llu\n",
+        static_cast<unsigned long long>(stats.missed)
+    );
+    std::printf("Spurious:          %llu\n",
+        static_cast<unsigned long long>(stats.spurious)
+    );
+    std::printf("Calendar errors:   %llu\n",
+        static_cast<unsigned long long>(stats.calendarErrors)
+    );
+}
+
+std::optional<std::chrono::year_month_day> parseDate(const char* const text)
+{
+    int year = 0;
+    unsigned month = 0;
+    unsigned day = 0;
+
+    if (std::sscanf(text, "%d-%u-%u", &year, &month, &day) != 3) {
+        return std::nullopt;
+    }
+
+    const std::chrono::year_month_day date{
+        std::chrono::year{ year }, std::chrono::month{ month }, std::chrono::day{ day }
+    };
+
+    // The epoch of the RTC is 32-bit, the year of the calendar is 8-bit
+    if (!date.ok() || year < 1970 || year >= 2100) {
+        return std::nullopt;
+    }
+
+    return date;
+}
+
+}
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace host::schedule {
+
+/*
+ * Runs the Clock, SunriseSunset and OutputController modules of the firmware
+ * with a virtual RTC, as fast as the host can, to check the interval schedule
+ * over years of simulated time (leap years, the daily sunrise and sunset
+ * changes).
+ *
+ * The Timer1 overflows are generated by the simulation. On mains power the
+ * RTC ticks every 2 seconds, on battery the RTC period is lengthened between
+ * the wake-ups like in the main loop of the firmware.
+ *
+ * Every change of the scheduled output state is recorded and compared to
+ * a reference calculated independently from the configured intervals: the
+ * calendar of the reference comes from std::chrono, the intervals are
+ * evaluated minute by minute.
+ *
+ * The state of the firmware modules is thread-local in the host build, so
+ * each thread can run a separate device.
+ */
+
+struct Location {
+    double latitude = 0;    // Degrees, positive for North
+    double longitude = 0;   // Degrees, positive for East
+};
+
+struct DeviceConfig {
+    // Default location of the settings if not set
+    std::optional<Location> location;
+    double timeZoneHours = 0;
+    bool battery = false;
+    // "ON,OFF" pairs, the switches are HH:MM, sunrise[+-MIN] or sunset[+-MIN]
+    std::vector<std::string> intervals;
+};
+
+struct Statistics {
+    uint64_t days = 0;
+    uint64_t leapDays = 0;
+    uint64_t dstDays = 0;
+    uint64_t wakeUps = 0;
+    uint64_t expected = 0;
+    uint64_t transitions = 0;
+    uint64_t onTime = 0;
+    uint64_t late = 0;
+    uint64_t missed = 0;
+    uint64_t spurious = 0;
+    uint64_t calendarErrors = 0;
+    uint64_t minPerDay = UINT64_MAX;
+    uint64_t maxPerDay = 0;
+    // Number of the switches by latency in seconds
+    std::map<uint32_t, uint64_t> latencies;
+
+    [[nodiscard]] bool passed() const {
+        return late == 0 && missed == 0 && spurious == 0 && calendarErrors == 0;
+    }
+
+    [[nodiscard]] uint32_t maxLatency() const {
+        return latencies.empty() ? 0 : latencies.rbegin()->first;
+    }
+
+    Statistics& operator+=(const Statistics& other);
+    bool operator==(const Statistics& other) const = default;
+};
+
+/**
+ * @return True if the configuration can be simulated
+ */
+[[nodiscard]] bool isValid(const DeviceConfig& config);
+
+/**
+ * Simulates a device from the start of the first day to the start of the
+ * last one (local time) on the calling thread.
+ * @param log Transitions are written to this file as CSV if set
+ */
+[[nodiscard]] Statistics simulate(
+    const DeviceConfig& config,
+    std::chrono::year_month_day first,
+    std::chrono::year_month_day last,
+    FILE* log = nullptr
+);
+
+/**
+ * Prints the switching statistics of one or more simulations.
+ */
+void printStatistics(const Statistics& statistics);
+
+[[nodiscard]] std::optional<std::chrono::year_month_day> parseDate(const char* text);
+
+}
@@ -0,0 +1,140 @@
+/*
+ * Runs the scheduler modules of the firmware for one device over years of
+ * simulated time, see Simulation.hpp.
+ *
+ * The exit code is non-zero if a switch was late, missed or spurious.
+ */
+
+#include "Simulation.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+namespace {
+
+using namespace host::schedule;
+
+void printUsage(const char* program)
+{
+    std::printf(
+        "Usage: %s [options]\n"
+        "  --start YYYY-MM-DD       First simulated day (default: 2024-01-01)\n"
+        "  --years N                Simulated years (default: 4)\n"
+        "  --battery                Lengthen the RTC period between the wake-ups\n"
+        "  --timezone HOURS         Offset from UTC, e.g. 1 or 5.5 (default: 0)\n"
+        "  --location LAT,LON       Position in degrees (default: Budapest)\n"
+        "  --interval ON,OFF        Active interval, the switches are HH:MM,\n"
+        "                           sunrise[+-MIN] or sunset[+-MIN]\n"
+        "  --log FILE               Write the transitions to a CSV file\n",
+        program
+    );
+}
+
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace std::chrono;
+
+    year_month_day start{ year{ 2024 }, January, day{ 1 } };
+    int years = 4;
+    std::string logPath;
+    DeviceConfig config;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+        bool valid = true;
+
+        if (arg == "--start" && value) {
+            const auto date = parseDate(value);
+            valid = date.has_value();
+            start = date.value_or(start);
+            ++i;
+        } else if (arg == "--years" && value) {
+            years = std::atoi(value);
+            valid = years > 0;
+            ++i;
+        } else if (arg == "--battery") {
+            config.battery = true;
+        } else if (arg == "--timezone" && value) {
+            config.timeZoneHours = std::atof(value);
+            ++i;
+        } else if (arg == "--location" && value) {
+            Location location;
+            valid = std::sscanf(value, "%lf,%lf", &location.latitude, &location.longitude) == 2;
+            config.location = location;
+            ++i;
+        } else if (arg == "--interval" && value) {
+            config.intervals.emplace_back(value);
+            ++i;
+        } else if (arg == "--log" && value) {
+            logPath = value;
+            ++i;
+        } else {
+            valid = false;
+        }
+
+        if (!valid) {
+            printUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    // Evening and morning lights with an overlap in the winter
+    if (config.intervals.empty()) {
+        config.intervals = { "sunset-30,22:30", "06:00,07:30", "sunrise-60,sunrise+15" };
+    }
+
+    const year_month_day end{ start.year() + std::chrono::years{ years }, start.month(), start.day() };
+
+    if (!isValid(config) || !end.ok() || static_cast<int>(end.year()) > 2100) {
+        printUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    FILE* log = nullptr;
+    if (!logPath.empty()) {
+        log = std::fopen(logPath.c_str(), "w");
+        if (!log) {
+            std::perror(logPath.c_str());
+            return EXIT_FAILURE;
+        }
+        std::fprintf(log, "time,state\n");
+    }
+
+    const auto wallStart = steady_clock::now();
+    const Statistics stats = simulate(config, start, end, log);
+    const duration<double> wall = steady_clock::now() - wallStart;
+
+    if (log) {
+        std::fclose(log);
+    }
+
+    std::printf("Simulated:         %04d-%02u-%02u .. %04d-%02u-%02u, %llu days (%llu leap days, %llu days in DST)\n",
+        static_cast<int>(start.year()),
+        static_cast<unsigned>(start.month()),
+        static_cast<unsigned>(start.day()),
+        static_cast<int>(end.year()),
+        static_cast<unsigned>(end.month()),
+        static_cast<unsigned>(end.day()),
+        static_cast<unsigned long long>(stats.days),
+        static_cast<unsigned long long>(stats.leapDays),
+        static_cast<unsigned long long>(stats.dstDays)
+    );
+    std::printf("RTC:               %s, %llu wake-ups (%.1f per day)\n",
+        config.battery ? "battery, lengthened periods" : "mains, 2 s period",
+        static_cast<unsigned long long>(stats.wakeUps),
+        static_cast<double>(stats.wakeUps) / stats.days
+    );
+    std::printf("Host time:         %.3f s (%.0f simulated days/s)\n",
+        wall.count(),
+        wall.count() > 0 ? stats.days / wall.count() : 0.0
+    );
+
+    printStatistics(stats);
+
+    return stats.passed() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,430 @@
+/*
+ * Host replacement of the XC8 device header for the native firmware build.
+ *
+ * Declares the special function registers of the PIC16F18326 used by the
+ * firmware and by the host MCC drivers (mcc.c). Every register access goes
+ * through Host_access(), which advances the simulated device (Device.cpp) by
+ * one instruction cycle, updates the peripherals from the register writes
+ * and runs the interrupt service routine when an enabled interrupt is
+ * pending, like the hardware would between two instructions.
+ *
+ * SLEEP(), NOP() and the __delay_*() macros are simulated the same way, so
+ * the busy-wait loops of the firmware make progress in simulated time.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Register layouts
+ */
+
+#define HOST_REGISTER(name, fields) \
+    typedef union { uint8_t value; struct fields bits; } Host_##name##_t; \
+    extern volatile Host_##name##_t Host_##name
+
+#define HOST_PLAIN_REGISTER(name) \
+    typedef struct { uint8_t value; } Host_##name##_t; \
+    extern volatile Host_##name##_t Host_##name
+
+HOST_REGISTER(INTCON, {
+    uint8_t INTEDG : 1;
+    uint8_t : 5;
+    uint8_t PEIE : 1;
+    uint8_t GIE : 1;
+});
+
+HOST_REGISTER(PIR0, {
+    uint8_t INTF : 1;
+    uint8_t : 3;
+    uint8_t IOCIF : 1;
+    uint8_t TMR0IF : 1;
+    uint8_t : 2;
+});
+
+HOST_REGISTER(PIE0, {
+    uint8_t INTE : 1;
+    uint8_t : 3;
+    uint8_t IOCIE : 1;
+    uint8_t TMR0IE : 1;
+    uint8_t : 2;
+});
+
+HOST_REGISTER(PIR1, {
+    uint8_t TMR1IF : 1;
+    uint8_t TMR2IF : 1;
+    uint8_t BCL1IF : 1;
+    uint8_t SSP1IF : 1;
+    uint8_t TXIF : 1;
+    uint8_t RCIF : 1;
+    uint8_t ADIF : 1;
+    uint8_t TMR1GIF : 1;
+});
+
+HOST_REGISTER(PIE1, {
+    uint8_t TMR1IE : 1;
+    uint8_t TMR2IE : 1;
+    uint8_t BCL1IE : 1;
+    uint8_t SSP1IE : 1;
+    uint8_t TXIE : 1;
+    uint8_t RCIE : 1;
+    uint8_t ADIE : 1;
+    uint8_t TMR1GIE : 1;
+});
+
+HOST_REGISTER(PIR2, {
+    uint8_t TMR4IF : 1;
+    uint8_t TMR6IF : 1;
+    uint8_t : 2;
+    uint8_t NVMIF : 1;
+    uint8_t : 3;
+});
+
+HOST_REGISTER(PIE2, {
+    uint8_t TMR4IE : 1;
+    uint8_t TMR6IE : 1;
+    uint8_t : 2;
+    uint8_t NVMIE : 1;
+    uint8_t : 3;
+});
+
+HOST_REGISTER(PORTA, {
+    uint8_t RA0 : 1;
+    uint8_t RA1 : 1;
+    uint8_t RA2 : 1;
+    uint8_t RA3 : 1;
+    uint8_t RA4 : 1;
+    uint8_t RA5 : 1;
+    uint8_t : 2;
+});
+
+HOST_REGISTER(PORTC, {
+    uint8_t RC0 : 1;
+    uint8_t RC1 : 1;
+    uint8_t RC2 : 1;
+    uint8_t RC3 : 1;
+    uint8_t RC4 : 1;
+    uint8_t RC5 : 1;
+    uint8_t : 2;
+});
+
+HOST_REGISTER(IOCAF, {
+    uint8_t IOCAF0 : 1;
+    uint8_t IOCAF1 : 1;
+    uint8_t IOCAF2 : 1;
+    uint8_t IOCAF3 : 1;
+    uint8_t IOCAF4 : 1;
+    uint8_t IOCAF5 : 1;
+    uint8_t : 2;
+});
+
+HOST_REGISTER(IOCCF, {
+    uint8_t IOCCF0 : 1;
+    uint8_t IOCCF1 : 1;
+    uint8_t IOCCF2 : 1;
+    uint8_t IOCCF3 : 1;
+    uint8_t IOCCF4 : 1;
+    uint8_t IOCCF5 : 1;
+    uint8_t : 2;
+});
+
+HOST_REGISTER(T1CON, {
+    uint8_t TMR1ON : 1;
+    uint8_t : 1;
+    uint8_t T1SYNC : 1;
+    uint8_t T1SOSC : 1;
+    uint8_t T1CKPS : 2;
+    uint8_t TMR1CS : 2;
+});
+
+// Same layout for T2CON and T4CON
+HOST_REGISTER(T2CON, {
+    uint8_t T2CKPS : 2;
+    uint8_t TMR2ON : 1;
+    uint8_t T2OUTPS : 4;
+    uint8_t : 1;
+});
+
+HOST_REGISTER(T4CON, {
+    uint8_t T4CKPS : 2;
+    uint8_t TMR4ON : 1;
+    uint8_t T4OUTPS : 4;
+    uint8_t : 1;
+});
+
+HOST_REGISTER(SSP1CON1, {
+    uint8_t SSPM : 4;
+    uint8_t CKP : 1;
+    uint8_t SSPEN : 1;
+    uint8_t SSPOV : 1;
+    uint8_t WCOL : 1;
+});
+
+HOST_REGISTER(SSP1CON2, {
+    uint8_t SEN : 1;
+    uint8_t RSEN : 1;
+    uint8_t PEN : 1;
+    uint8_t RCEN : 1;
+    uint8_t ACKEN : 1;
+    uint8_t ACKDT : 1;
+    uint8_t ACKSTAT : 1;
+    uint8_t GCEN : 1;
+});
+
+HOST_REGISTER(NVMCON1, {
+    uint8_t RD : 1;
+    uint8_t WR : 1;
+    uint8_t WREN : 1;
+    uint8_t WRERR : 1;
+    uint8_t FREE : 1;
+    uint8_t LWLO : 1;
+    uint8_t NVMREGS : 1;
+    uint8_t : 1;
+});
+
+HOST_REGISTER(FVRCON, {
+    uint8_t ADFVR : 2;
+    uint8_t CDAFVR : 2;
+    uint8_t TSRNG : 1;
+    uint8_t TSEN : 1;
+    uint8_t FVRRDY : 1;
+    uint8_t FVREN : 1;
+});
+
+HOST_REGISTER(ADCON0, {
+    uint8_t ADON : 1;
+    uint8_t ADGO : 1;
+    uint8_t CHS : 6;
+});
+
+HOST_REGISTER(OSCCON3, {
+    uint8_t : 3;
+    uint8_t NOSCR : 1;
+    uint8_t ORDY : 1;
+    uint8_t : 1;
+    uint8_t SOSCPWR : 1;
+    uint8_t CSWHOLD : 1;
+});
+
+HOST_REGISTER(OSCSTAT1, {
+    uint8_t PLLR : 1;
+    uint8_t : 1;
+    uint8_t ADOR : 1;
+    uint8_t SOR : 1;
+    uint8_t LFOR : 1;
+    uint8_t MFOR : 1;
+    uint8_t HFOR : 1;
+    uint8_t EXTOR : 1;
+});
+
+HOST_REGISTER(PMD4, {
+    uint8_t : 1;
+    uint8_t MSSP1MD : 1;
+    uint8_t MSSP2MD : 1;
+    uint8_t : 2;
+    uint8_t UART1MD : 1;
+    uint8_t : 2;
+});
+
+HOST_REGISTER(TX1STA, {
+    uint8_t TX9D : 1;
+    uint8_t TRMT : 1;
+    uint8_t BRGH : 1;
+    uint8_t SENDB : 1;
+    uint8_t SYNC : 1;
+    uint8_t TXEN : 1;
+    uint8_t TX9 : 1;
+    uint8_t CSRC : 1;
+});
+
+HOST_REGISTER(PCON0, {
+    uint8_t nBOR : 1;
+    uint8_t nPOR : 1;
+    uint8_t nRI : 1;
+    uint8_t nRMCLR : 1;
+    uint8_t nRWDT : 1;
+    uint8_t : 1;
+    uint8_t STKUNF : 1;
+    uint8_t STKOVF : 1;
+});
+
+HOST_REGISTER(BORCON, {
+    uint8_t BORRDY : 1;
+    uint8_t : 6;
+    uint8_t SBOREN : 1;
+});
+
+HOST_REGISTER(VREGCON, {
+    uint8_t : 1;
+    uint8_t VREGPM : 1;
+    uint8_t : 6;
+});
+
+// Registers without used bit fields
+HOST_PLAIN_REGISTER(IOCAN);
+HOST_PLAIN_REGISTER(IOCAP);
+HOST_PLAIN_REGISTER(IOCCN);
+HOST_PLAIN_REGISTER(IOCCP);
+HOST_PLAIN_REGISTER(PR2);
+HOST_PLAIN_REGISTER(PR4);
+HOST_PLAIN_REGISTER(SSP1ADD);
+HOST_PLAIN_REGISTER(NVMADRL);
+HOST_PLAIN_REGISTER(NVMADRH);
+HOST_PLAIN_REGISTER(NVMDATL);
+HOST_PLAIN_REGISTER(PWM5CON);
+HOST_PLAIN_REGISTER(PWM5DCH);
+HOST_PLAIN_REGISTER(PWM5DCL);
+HOST_PLAIN_REGISTER(ADRESH);
+HOST_PLAIN_REGISTER(ADRESL);
+
+#undef HOST_REGISTER
+#undef HOST_PLAIN_REGISTER
+
+/*
+ * Simulation hooks
+ */
+
+/**
+ * Advances the simulated device by one instruction cycle, processes the
+ * register writes since the last access and runs the ISR if an enabled
+ * interrupt is pending.
+ */
+void Host_access(void);
+
+/**
+ * Advances the simulated device.
+ * @param cycles Number of instruction cycles (Fosc / 4)
+ */
+void Host_delay(uint64_t cycles);
+
+/**
+ * Stops the CPU and the Fosc based peripherals until a wake-up event.
+ */
+void Host_sleep(void);
+
+/**
+ * Writes to SSP1BUF start a byte transmission, even if the value is the
+ * same as the previous one.
+ * @return Address of the transmit buffer
+ */
+volatile uint8_t* Host_SSP1BUF_write(void);
+
+/**
+ * Writes to NVMCON2 are recorded for checking the unlock sequence.
+ * @return Address of the register
+ */
+volatile uint8_t* Host_NVMCON2_write(void);
+
+/**
+ * @return Counter of Timer1 (TMR1H:TMR1L)
+ */
+uint16_t Host_TMR1_read(void);
+
+/**
+ * Writes the counter of Timer1 and clears its prescaler.
+ * @param value New value of TMR1H:TMR1L
+ */
+void Host_TMR1_write(uint16_t value);
+
+/*
+ * Register access macros, same names as the XC8 device header. The bits
+ * are only accessible through the <register>bits structures, the legacy
+ * bit names (e.g. TMR1IF) would clash with the structure members.
+ */
+
+#ifndef HOST_DEVICE_IMPLEMENTATION
+
+#define HOST_SFR(name) (*(Host_access(), &Host_##name))
+
+#define INTCON HOST_SFR(INTCON).value
+#define INTCONbits HOST_SFR(INTCON).bits
+#define PIR0 HOST_SFR(PIR0).value
+#define PIR0bits HOST_SFR(PIR0).bits
+#define PIE0 HOST_SFR(PIE0).value
+#define PIE0bits HOST_SFR(PIE0).bits
+#define PIR1 HOST_SFR(PIR1).value
+#define PIR1bits HOST_SFR(PIR1).bits
+#define PIE1 HOST_SFR(PIE1).value
+#define PIE1bits HOST_SFR(PIE1).bits
+#define PIR2 HOST_SFR(PIR2).value
+#define PIR2bits HOST_SFR(PIR2).bits
+#define PIE2 HOST_SFR(PIE2).value
+#define PIE2bits HOST_SFR(PIE2).bits
+#define PORTA HOST_SFR(PORTA).value
+#define PORTAbits HOST_SFR(PORTA).bits
+#define PORTC HOST_SFR(PORTC).value
+#define PORTCbits HOST_SFR(PORTC).bits
+#define IOCAF HOST_SFR(IOCAF).value
+#define IOCAFbits HOST_SFR(IOCAF).bits
+#define IOCCF HOST_SFR(IOCCF).value
+#define IOCCFbits HOST_SFR(IOCCF).bits
+#define IOCAN HOST_SFR(IOCAN).value
+#define IOCAP HOST_SFR(IOCAP).value
+#define IOCCN HOST_SFR(IOCCN).value
+#define IOCCP HOST_SFR(IOCCP).value
+#define T1CON HOST_SFR(T1CON).value
+#define T1CONbits HOST_SFR(T1CON).bits
+#define T2CON HOST_SFR(T2CON).value
+#define T2CONbits HOST_SFR(T2CON).bits
+#define PR2 HOST_SFR(PR2).value
+#define T4CON HOST_SFR(T4CON).value
+#define T4CONbits HOST_SFR(T4CON).bits
+#define PR4 HOST_SFR(PR4).value
+#define SSP1CON1 HOST_SFR(SSP1CON1).value
+#define SSP1CON1bits HOST_SFR(SSP1CON1).bits
+#define SSP1CON2 HOST_SFR(SSP1CON2).value
+#define SSP1CON2bits HOST_SFR(SSP1CON2).bits
+#define SSP1ADD HOST_SFR(SSP1ADD).value
+#define SSP1BUF (*Host_SSP1BUF_write())
+#define NVMCON1 HOST_SFR(NVMCON1).value
+#define NVMCON1bits HOST_SFR(NVMCON1).bits
+#define NVMCON2 (*Host_NVMCON2_write())
+#define NVMADRL HOST_SFR(NVMADRL).value
+#define NVMADRH HOST_SFR(NVMADRH).value
+#define NVMDATL HOST_SFR(NVMDATL).value
+#define PWM5CON HOST_SFR(PWM5CON).value
+#define PWM5DCH HOST_SFR(PWM5DCH).value
+#define PWM5DCL HOST_SFR(PWM5DCL).value
+#define FVRCON HOST_SFR(FVRCON).value
+#define FVRCONbits HOST_SFR(FVRCON).bits
+#define ADCON0 HOST_SFR(ADCON0).value
+#define ADCON0bits HOST_SFR(ADCON0).bits
+#define ADRESH HOST_SFR(ADRESH).value
+#define ADRESL HOST_SFR(ADRESL).value
+#define OSCCON3 HOST_SFR(OSCCON3).value
+#define OSCCON3bits HOST_SFR(OSCCON3).bits
+#define OSCSTAT1 HOST_SFR(OSCSTAT1).value
+#define OSCSTAT1bits HOST_SFR(OSCSTAT1).bits
+#define PMD4 HOST_SFR(PMD4).value
+#define PMD4bits HOST_SFR(PMD4).bits
+#define TX1STA HOST_SFR(TX1STA).value
+#define TX1STAbits HOST_SFR(TX1STA).bits
+#define PCON0 HOST_SFR(PCON0).value
+#define PCON0bits HOST_SFR(PCON0).bits
+#define BORCON HOST_SFR(BORCON).value
+#define BORCONbits HOST_SFR(BORCON).bits
+#define VREGCON HOST_SFR(VREGCON).value
+#define VREGCONbits HOST_SFR(VREGCON).bits
+
+#define NOP() Host_access()
+#define SLEEP() Host_sleep()
+#define CLRWDT() Host_access()
+
+// Needs _XTAL_FREQ from device_config.h at the place of use
+#define __delay_us(x) Host_delay((uint64_t)(x) * (_XTAL_FREQ / 4000000ul))
+#define __delay_ms(x) Host_delay((uint64_t)(x) * (_XTAL_FREQ / 4000ul))
+
+#define __interrupt()
+
+#endif // HOST_DEVICE_IMPLEMENTATION
+
+#ifdef __cplusplus
+}
+#endif
@@ -45,8 +45,10 @@
 
 #include "Clock.h"
 #include "Config.h"
+#include "Fader.h"
 #include "Graphics.h"
 #include "Keypad.h"
+#include "NVM.h"
 #include "OutputController.h"
 #include "Settings.h"
 #include "SSD1306.h"
@@ -69,54 +71,75 @@ static struct MainContext
 
 void __interrupt() isr(void)
 {
-    if (IOCIE && IOCIF) {
+    if (PIE0bits.IOCIE && PIR0bits.IOCIF) {
         // RA0 IOC - SW1
-        if (IOCAF0) {
-            IOCAF0 = 0;
+        if (IOCAFbits.IOCAF0) {
+            IOCAFbits.IOCAF0 = 0;
             System_handleExternalWakeUp();
         }
 
         // RA1 IOC - SW2
-        if (IOCAF1) {
-            IOCAF1 = 0;
+        if (IOCAFbits.IOCAF1) {
+            IOCAFbits.IOCAF1 = 0;
             System_handleExternalWakeUp();
         }
 
         // RC5 IOC - SW3
-        if (IOCCF5) {
-            IOCCF5 = 0;
+        if (IOCCFbits.IOCCF5) {
+            IOCCFbits.IOCCF5 = 0;
             System_handleExternalWakeUp();
         }
 
         // RA2 IOC - LDO_SENSE
-        if (IOCAF2) {
-            IOCAF2 = 0;
+        if (IOCAFbits.IOCAF2) {
+            IOCAFbits.IOCAF2 = 0;
             System_handleLDOSenseInterrupt();
         }
     }
 
-    if (PEIE) {
-        if (ADIE && ADIF) {
-            ADIF = 0;
+    if (INTCONbits.PEIE) {
+        // Runs in every PWM period while dithering
+        if (PIE1bits.TMR2IE && PIR1bits.TMR2IF) {
+            PIR1bits.TMR2IF = 0;
+            Fader_handlePWMPeriodInterrupt();
+        }
+
+        if (PIE1bits.ADIE && PIR1bits.ADIF) {
+            PIR1bits.ADIF = 0;
             System_handleADCInterrupt(((uint16_t)ADRESH) << 8 | ADRESL);
             context.adcConversionFinished = true;
         }
 
-        if (TMR4IE & TMR4IF) {
-            TMR4IF = 0;
+        if (PIE2bits.TMR4IE & PIR2bits.TMR4IF) {
+            PIR2bits.TMR4IF = 0;
             Clock_handleFastTimerInterrupt();
+            Fader_handleTimerInterrupt();
         }
 
-        if (TMR1IE & TMR1IF) {
-            TMR1IF = 0;
+        if (PIE1bits.TMR1IE & PIR1bits.TMR1IF) {
+            PIR1bits.TMR1IF = 0;
             Clock_handleRTCTimerInterrupt();
         }
+
+        if (PIE1bits.SSP1IE && PIR1bits.SSP1IF) {
+            PIR1bits.SSP1IF = 0;
+            SSD1306_handleInterrupt();
+        }
+
+        if (PIE2bits.NVMIE && PIR2bits.NVMIF) {
+            PIR2bits.NVMIF = 0;
+            NVM_handleInterrupt();
+        }
     }
 }
 
 inline static void setupI2C()
 {
     SSP1CON1bits.SSPEN = 1;
+
+    // The display driver sends the queued transfers from the ISR
+    PIR1bits.SSP1IF = 0;
+    PIE1bits.SSP1IE = 1;
 }
 
 inline static void showStartupScreen()
@@ -168,12 +191,38 @@ inline static void showStartupScreen()
         PCON0bits.nRI = 1;
     }
 
-    if (BORRDY && !PCON0bits.nBOR) {
+    if (BORCONbits.BORRDY && !PCON0bits.nBOR) {
         Text_draw("B", 0, 30, 0, false);
         PCON0bits.nBOR = 1;
     }
 }
 
+/*
+    Time until the next instant when the state of the device can change
+    without an external event, the RTC wakes up the device until then only
+    as many times as needed.
+ */
+static uint16_t secondsUntilNextTask()
+{
+    // The calendar, the sunrise / sunset times and the compiled schedule
+    // change at midnight
+    uint16_t seconds = Clock_getSecondsUntil(0);
+
+    Clock_Time change = OutputController_getNextScheduleChange(
+        Clock_getMinutesSinceMidnight()
+    );
+
+    if (change >= 0) {
+        uint16_t secondsUntilChange = Clock_getSecondsUntil(change);
+
+        if (secondsUntilChange < seconds) {
+            seconds = secondsUntilChange;
+        }
+    }
+
+    return seconds;
+}
+
 /*
                          Main application
  */
@@ -198,7 +247,7 @@ void main(void)
     //INTERRUPT_PeripheralInterruptDisable();
 
     // Enable low-power sleep mode
-    VREGPM = 1;
+    VREGCONbits.VREGPM = 1;
 
     setupI2C();
 
@@ -225,13 +274,13 @@ void main(void)
 
     SunriseSunset_setPosition(
         &data,
-        Types_bcdToDouble(
-            Settings_data.location.latitudeBcd,
-            Settings_data.location.latitudeSign
-        ),
-        Types_bcdToDouble(
+        Types_bcdToFixedPoint(
             Settings_data.location.longitudeBcd,
             Settings_data.location.longitudeSign
+        ),
+        Types_bcdToFixedPoint(
+            Settings_data.location.latitudeBcd,
+            Settings_data.location.latitudeSign
         )
 //        19.046867,
 //        47.467442
@@ -314,19 +363,30 @@ void main(void)
             UI_setExternalEvent(UI_ExternalEvent_OutputStateChanged);
         }
 
-        if (systemTaskResult.action == System_TaskResult_EnterSleepMode) {
+        // Sleep is delayed until the settings are written to the EEPROM
+        // and the output ramp finishes (the timers stop in Sleep)
+        if (
+            systemTaskResult.action == System_TaskResult_EnterSleepMode
+            && !NVM_isBusy()
+            && !Fader_isFading()
+        ) {
 #if DEBUG_ENABLE
             if (runHeavyTasks) {
                 ++_DebugState.heavyTaskUpdateValue;
             }
 #endif
 
+            Clock_setSleepPeriod(secondsUntilNextTask());
+
             System_SleepResult sleepResult = System_sleep();
 
             runHeavyTasks =
                 sleepResult == System_SleepResult_WakeUpFromExternalSource;
 
             if (runHeavyTasks) {
+                // The displayed clock needs the 2-second RTC period
+                Clock_resetPeriod();
+
                 UI_setExternalEvent(UI_ExternalEvent_SystemWakeUp);
 #if DEBUG_ENABLE
                 ++_DebugState.heavyTaskUpdateValue;
@@ -0,0 +1,156 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <Utils.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <ctime>
+#include <random>
+
+namespace {
+    // 2106-01-01 00:00:00, the last full year of the 32-bit epoch
+    constexpr Date_Epoch EndEpoch = 4291747200u;
+
+    [[nodiscard]] std::tm reference(const Date_Epoch epoch) {
+        const std::time_t t = epoch;
+        std::tm tm{};
+        gmtime_r(&t, &tm);
+        return tm;
+    }
+
+    void checkDate(const Date_Calendar& calendar, const std::tm& tm) {
+        REQUIRE(static_cast<int>(calendar.day) == tm.tm_mday);
+        REQUIRE(static_cast<int>(calendar.month) == tm.tm_mon + 1);
+        REQUIRE(static_cast<int>(calendar.year) == tm.tm_year - 70);
+        REQUIRE(static_cast<int>(calendar.weekday) == tm.tm_wday);
+        REQUIRE(static_cast<int>(calendar.dayOfYear) == tm.tm_yday);
+        REQUIRE(calendar.leapYear == Date_isLeapYear(calendar.year));
+    }
+
+    void check(const Date_Calendar& calendar, const Date_Epoch epoch) {
+        INFO("Epoch: " << epoch);
+
+        const auto tm = reference(epoch);
+
+        REQUIRE(static_cast<int>(calendar.second) == tm.tm_sec);
+        REQUIRE(static_cast<int>(calendar.minute) == tm.tm_min);
+        REQUIRE(static_cast<int>(calendar.hour) == tm.tm_hour);
+        checkDate(calendar, tm);
+    }
+}
+
+TEST_CASE("Calendar follows the RTC ticks from 1970 to 2105", "[calendar]") {
+    Date_Calendar calendar;
+    Date_calendarFromEpoch(&calendar, 0);
+
+    // The date is compared with gmtime() when it changes, the time of the
+    // day at every step
+    uint32_t secondOfDay = 0;
+
+    for (Date_Epoch epoch = 0; epoch < EndEpoch; epoch += 2) {
+        if (secondOfDay >= 86400) {
+            secondOfDay -= 86400;
+            check(calendar, epoch);
+        }
+
+        if (
+            calendar.hour != secondOfDay / 3600
+            || calendar.minute != secondOfDay / 60 % 60
+            || calendar.second != secondOfDay % 60
+        ) {
+            check(calendar, epoch);
+        }
+
+        Date_advanceCalendar(&calendar, 2);
+        secondOfDay += 2;
+    }
+
+    check(calendar, EndEpoch);
+}
+
+TEST_CASE("Calendar advances with irregular steps", "[calendar]") {
+    std::mt19937 generator{ 1234 };
+    std::uniform_int_distribution<uint32_t> epochs{ 0, EndEpoch - 1000000 };
+    std::uniform_int_distribution<unsigned> steps{ 0, 255 };
+
+    for (int i = 0; i < 1000; ++i) {
+        Date_Epoch epoch = epochs(generator);
+
+        Date_Calendar calendar;
+        Date_calendarFromEpoch(&calendar, epoch);
+
+        for (int j = 0; j < 1000; ++j) {
+            const auto step = static_cast<uint8_t>(steps(generator));
+            Date_advanceCalendar(&calendar, step);
+            epoch += step;
+        }
+
+        check(calendar, epoch);
+    }
+}
+
+TEST_CASE("Calendar converts from and to the epoch", "[calendar]") {
+    std::mt19937 generator{ 42 };
+    std::uniform_int_distribution<uint32_t> epochs{ 0, EndEpoch - 1 };
+
+    for (int i = 0; i < 1000000; ++i) {
+        const Date_Epoch epoch = epochs(generator);
+
+        Date_Calendar calendar;
+        Date_calendarFromEpoch(&calendar, epoch);
+
+        check(calendar, epoch);
+        REQUIRE(Date_calendarToEpoch(&calendar) == epoch);
+    }
+}
+
+TEST_CASE("Calendar normalizes out of range days", "[calendar]") {
+    Date_Calendar calendar{};
+    calendar.year = 2023 - 1970;
+    calendar.month = 2;
+    calendar.day = 31;
+    calendar.hour = 12;
+
+    // Same as mktime(): February 31 is March 3
+    Date_calendarFromEpoch(&calendar, Date_calendarToEpoch(&calendar));
+
+    CHECK(static_cast<int>(calendar.month) == 3);
+    CHECK(static_cast<int>(calendar.day) == 3);
+    CHECK(static_cast<int>(calendar.hour) == 12);
+}
+
+TEST_CASE("Calendar update is cheaper than gmtime()", "[calendar][benchmark]") {
+    using Clock = std::chrono::steady_clock;
+
+    constexpr int Steps = 10000000;
+
+    Date_Calendar calendar;
+    Date_calendarFromEpoch(&calendar, 1704067200u);
+
+    auto start = Clock::now();
+    for (int i = 0; i < Steps; ++i) {
+        Date_advanceCalendar(&calendar, 2);
+    }
+    const auto advance = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / Steps;
+
+    std::time_t t = 1704067200;
+    std::tm tm{};
+    int sink = 0;
+    start = Clock::now();
+    for (int i = 0; i < Steps; ++i) {
+        t += 2;
+        gmtime_r(&t, &tm);
+        sink += tm.tm_sec;
+    }
+    const auto gmtime = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / Steps;
+
+    std::printf(
+        "Per RTC tick (host): Date_advanceCalendar %.1f ns, gmtime_r %.1f ns (%d)\n",
+        advance,
+        gmtime,
+        sink & 1
+    );
+
+    check(calendar, 1704067200u + 2u * Steps);
+}
@@ -0,0 +1,132 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <xc.h>
+
+extern "C" {
+#include <Clock.h>
+#include <Settings.h>
+
+extern Clock_InterruptContext Clock_interruptContext;
+}
+
+// The interrupt handler macro declares the context at block scope, so the
+// helpers are not in an anonymous namespace
+static void resetClock(const uint8_t hour, const uint8_t minute) {
+    Mock_reset(nullptr);
+    Settings_loadDefaults();
+    Clock_setDate(56, 5, 14);
+    Clock_setTime(hour, minute);
+    Clock_task();
+}
+
+// Timer1 overflow at the end of the running period
+static unsigned overflow() {
+    const unsigned seconds = 2u << Clock_interruptContext.periodShift;
+    Clock_handleRTCTimerInterrupt();
+    Clock_task();
+    return seconds;
+}
+
+static unsigned secondsOfDay() {
+    return Clock_getMinutesSinceMidnight() * 60u + Clock_getSeconds();
+}
+
+TEST_CASE("Seconds until a time of the day")
+{
+    resetClock(13, 37);
+
+    CHECK(Clock_getSecondsUntil(13 * 60 + 38) == 60);
+    CHECK(Clock_getSecondsUntil(14 * 60) == 23 * 60);
+    CHECK(Clock_getSecondsUntil(13 * 60 + 37) == 0xFFFF);
+
+    overflow();
+    CHECK(Clock_getSeconds() == 2);
+    CHECK(Clock_getSecondsUntil(13 * 60 + 38) == 58);
+}
+
+TEST_CASE("The RTC period is lengthened without passing the deadline")
+{
+    resetClock(13, 37);
+
+    const unsigned deadline = 14 * 60 * 60;
+    unsigned wakeUps = 0;
+
+    while (secondsOfDay() < deadline) {
+        Clock_setSleepPeriod(Clock_getSecondsUntil(14 * 60));
+        overflow();
+        ++wakeUps;
+
+        // The deadline is kept with the resolution of the shortest period
+        REQUIRE(secondsOfDay() < deadline + 2);
+    }
+
+    // The 2-second period would need 690 wake-ups
+    CHECK(wakeUps < 100);
+    CHECK(Clock_interruptContext.periodShift == 0);
+    CHECK(static_cast<int>(T1CONbits.T1CKPS) == 0);
+}
+
+TEST_CASE("The prescaler changes at the overflow")
+{
+    resetClock(13, 37);
+
+    Clock_setSleepPeriod(60);
+    CHECK(Clock_interruptContext.periodShift == 0);
+    CHECK(static_cast<int>(T1CONbits.T1CKPS) == 0);
+
+    CHECK(overflow() == 2);
+    CHECK(Clock_interruptContext.periodShift == 3);
+    CHECK(static_cast<int>(T1CONbits.T1CKPS) == 3);
+
+    CHECK(overflow() == 16);
+    CHECK(secondsOfDay() == (13 * 60 + 37) * 60 + 18);
+}
+
+TEST_CASE("Resetting the period keeps the elapsed time")
+{
+    resetClock(13, 37);
+
+    Clock_setSleepPeriod(60);
+    overflow();
+    REQUIRE(Clock_interruptContext.periodShift == 3);
+
+    const Clock_Ticks ticks = Clock_getTicks();
+
+    // 40000 counts with 1:8 prescaler = 9.765625 seconds in the 16-second period
+    Mock_tmr1Value = 40000;
+    Clock_resetPeriod();
+    Clock_task();
+
+    CHECK(Clock_interruptContext.periodShift == 0);
+    CHECK(Clock_interruptContext.nextPeriodShift == 0);
+    CHECK(static_cast<int>(T1CONbits.T1CKPS) == 0);
+    CHECK(static_cast<int>(T1CONbits.TMR1ON) == 1);
+    CHECK(static_cast<int>(PIE1bits.TMR1IE) == 1);
+    CHECK(Clock_getTicks() == ticks + 4);
+    CHECK(secondsOfDay() == (13 * 60 + 37) * 60 + 2 + 8);
+
+    // The remaining 1.765625 seconds are in the timer
+    CHECK(Mock_tmr1Value == 40000u * 8 - 4 * 65536);
+
+    overflow();
+    CHECK(secondsOfDay() == (13 * 60 + 37) * 60 + 2 + 10);
+}
+
+TEST_CASE("Resetting the period finishes a pending overflow")
+{
+    resetClock(13, 37);
+
+    Clock_setSleepPeriod(60);
+    overflow();
+    REQUIRE(Clock_interruptContext.periodShift == 3);
+
+    PIR1bits.TMR1IF = 1;
+    Mock_tmr1Value = 1;
+    Clock_resetPeriod();
+    Clock_task();
+
+    CHECK_FALSE(static_cast<bool>(PIR1bits.TMR1IF));
+    CHECK(static_cast<int>(T1CONbits.T1CKPS) == 0);
+    CHECK(Mock_tmr1Value == 8);
+    CHECK(secondsOfDay() == (13 * 60 + 37) * 60 + 2 + 16);
+}
@@ -0,0 +1,317 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <xc.h>
+
+extern "C" {
+#include <Config.h>
+#include <Fader.h>
+
+extern const uint16_t GammaLUT[256];
+extern volatile Fader_DitherContext Fader_ditherContext;
+}
+
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+namespace {
+    constexpr double Gamma = 2.2;
+    constexpr uint16_t MaxDuty = 1023;
+
+    [[nodiscard]] double idealDuty(const double level) {
+        return MaxDuty * std::pow(level / 255.0, Gamma);
+    }
+
+    // Runs the ramp to the end, returns the duty cycle of every step
+    [[nodiscard]] std::vector<uint16_t> runRamp(const size_t maxSteps) {
+        std::vector<uint16_t> duties;
+        while (Fader_isFading()) {
+            REQUIRE(duties.size() < maxSteps);
+            Fader_handleTimerInterrupt();
+            duties.push_back(Mock_pwm5DutyValue);
+        }
+        return duties;
+    }
+}
+
+TEST_CASE("Gamma LUT follows the brightness curve")
+{
+    CHECK(GammaLUT[0] == 0);
+    CHECK(GammaLUT[255] == MaxDuty);
+
+    for (unsigned level = 1; level < 256; ++level) {
+        CAPTURE(level);
+
+        // Every non-zero level lights the LED
+        CHECK(GammaLUT[level] >= 1);
+        CHECK(GammaLUT[level] >= GammaLUT[level - 1]);
+        // The interpolation multiplies the step with 8 bits in 16 bits
+        CHECK(GammaLUT[level] - GammaLUT[level - 1] < 16);
+        CHECK(std::fabs(GammaLUT[level] - idealDuty(level)) <= 1.0);
+    }
+}
+
+TEST_CASE("Setting the level loads the duty cycle immediately")
+{
+    Fader_setLevel(0);
+    CHECK(Mock_pwm5DutyValue == 0);
+
+    Fader_setLevel(128);
+    CHECK(Mock_pwm5DutyValue == GammaLUT[128]);
+    CHECK_FALSE(Fader_isFading());
+
+    Fader_setTarget(10, 0);
+    CHECK(Mock_pwm5DutyValue == GammaLUT[10]);
+    CHECK_FALSE(Fader_isFading());
+}
+
+TEST_CASE("Fade-in follows the curve and takes the specified time")
+{
+    constexpr uint16_t Seconds = 2;
+    constexpr size_t Steps = Seconds * Config_Output_FadeStepsPerSecond;
+
+    Fader_setLevel(0);
+    Fader_setTarget(255, Seconds);
+    REQUIRE(Fader_isFading());
+
+    const auto duties = runRamp(Steps + 1);
+
+    CHECK(duties.size() == Steps);
+    CHECK(duties.back() == MaxDuty);
+
+    for (size_t i = 0; i < duties.size(); ++i) {
+        CAPTURE(i);
+
+        // Linear in brightness level, gamma-corrected in duty cycle
+        const double level = 255.0 * static_cast<double>(i + 1) / Steps;
+        CHECK(std::fabs(duties[i] - idealDuty(level)) <= 2.0);
+
+        if (i > 0) {
+            CHECK(duties[i] >= duties[i - 1]);
+        }
+    }
+}
+
+TEST_CASE("Fade-out ends with the output switched off")
+{
+    constexpr uint16_t Seconds = 3;
+    constexpr size_t Steps = Seconds * Config_Output_FadeStepsPerSecond;
+
+    Fader_setLevel(200);
+    Fader_setTarget(0, Seconds);
+
+    const auto duties = runRamp(Steps + 1);
+
+    CHECK(duties.size() == Steps);
+    CHECK(duties.back() == 0);
+
+    for (size_t i = 1; i < duties.size(); ++i) {
+        CHECK(duties[i] <= duties[i - 1]);
+    }
+}
+
+TEST_CASE("Sunrise-style 15-minute fade-in uses the 10-bit resolution")
+{
+    constexpr uint16_t Seconds = 15 * 60;
+    constexpr size_t Steps = static_cast<size_t>(Seconds) * Config_Output_FadeStepsPerSecond;
+
+    Fader_setLevel(0);
+    Fader_setTarget(255, Seconds);
+
+    const auto duties = runRamp(Steps + 1);
+
+    // The step is rounded up, the ramp may finish slightly earlier
+    CHECK(duties.size() <= Steps);
+    CHECK(duties.size() >= Steps * 99 / 100);
+    CHECK(duties.back() == MaxDuty);
+
+    size_t distinctValues = 1;
+    for (size_t i = 1; i < duties.size(); ++i) {
+        REQUIRE(duties[i] >= duties[i - 1]);
+        // The duty cycle changes by at most one LUT step at a time
+        REQUIRE(duties[i] - duties[i - 1] <= 1);
+        distinctValues += duties[i] != duties[i - 1] ? 1 : 0;
+    }
+
+    // Every duty cycle value is visited, not only the 256 LUT entries
+    CHECK(distinctValues == MaxDuty + 1);
+}
+
+TEST_CASE("Changing the target during a ramp continues from the current level")
+{
+    Fader_setLevel(0);
+    Fader_setTarget(255, 2);
+
+    for (int i = 0; i < 100; ++i) {
+        Fader_handleTimerInterrupt();
+    }
+
+    const auto dutyAtReversal = Mock_pwm5DutyValue;
+    REQUIRE(Fader_isFading());
+
+    Fader_setTarget(0, 1);
+    Fader_handleTimerInterrupt();
+
+    CHECK(Mock_pwm5DutyValue <= dutyAtReversal);
+    CHECK(dutyAtReversal - Mock_pwm5DutyValue <= 10);
+
+    const auto duties = runRamp(Config_Output_FadeStepsPerSecond + 1);
+
+    CHECK(duties.size() <= Config_Output_FadeStepsPerSecond);
+    CHECK(Mock_pwm5DutyValue == 0);
+}
+
+static bool ditheringEnabled()
+{
+    return PIE1bits.TMR2IE;
+}
+
+// The ISR macro declares the context at block scope
+static void pwmPeriodInterrupt()
+{
+    if (ditheringEnabled()) {
+        Fader_handlePWMPeriodInterrupt();
+    }
+}
+
+static uint16_t loadedDutyCycle()
+{
+    return static_cast<uint16_t>(PWM5DCH << 2 | PWM5DCL >> 6);
+}
+
+// Duty cycle with 4 fractional bits, as the fader calculates it
+static uint16_t expectedDutyCycle16(const unsigned level, const unsigned fraction)
+{
+    const unsigned delta = level < 255 ? GammaLUT[level + 1] - GammaLUT[level] : 0;
+    return static_cast<uint16_t>(GammaLUT[level] * 16 + (delta * fraction >> 4));
+}
+
+// Puts the fader between a level and the next one with a ramp, returns
+// the 8-bit fraction of the reached position
+static unsigned setPosition(const unsigned level, const unsigned fraction)
+{
+    Fader_setLevel(static_cast<uint8_t>(level));
+
+    if (fraction == 0) {
+        return 0;
+    }
+
+    // 1 s ramp to the next level, the step is rounded up like in the fader
+    constexpr unsigned Steps = Config_Output_FadeStepsPerSecond;
+    constexpr unsigned Step = (0x10000u + Steps - 1) / Steps;
+
+    Fader_setTarget(static_cast<uint8_t>(level + 1), 1);
+
+    const unsigned count = fraction * Steps / 256;
+    for (unsigned i = 0; i < count; ++i) {
+        Fader_handleTimerInterrupt();
+    }
+
+    return (count * Step >> 8) & 0xFF;
+}
+
+TEST_CASE("Dithering reaches the fractional duty cycle on average")
+{
+    constexpr unsigned Periods = 16;
+
+    for (unsigned level = 0; level < 255; ++level) {
+        for (const unsigned fraction : { 0u, 64u, 128u, 200u }) {
+            CAPTURE(level, fraction);
+
+            const auto reached = setPosition(level, fraction);
+            const uint16_t expected16 = expectedDutyCycle16(level, reached);
+
+            if (expected16 / 16 >= Config_Output_DitheringMaxDuty || expected16 % 16 == 0) {
+                CHECK_FALSE(ditheringEnabled());
+                continue;
+            }
+
+            REQUIRE(ditheringEnabled());
+
+            unsigned sum = 0;
+            for (unsigned i = 0; i < Periods; ++i) {
+                pwmPeriodInterrupt();
+                sum += loadedDutyCycle();
+
+                // Only the two adjacent duty cycles are used
+                CHECK(loadedDutyCycle() >= expected16 / 16);
+                CHECK(loadedDutyCycle() <= expected16 / 16 + 1);
+            }
+
+            CHECK(sum == expected16);
+        }
+    }
+
+    Fader_setLevel(0);
+}
+
+TEST_CASE("Dithering is off without a fraction and above the limit")
+{
+    Fader_setLevel(0);
+    CHECK_FALSE(ditheringEnabled());
+
+    Fader_setLevel(255);
+    CHECK_FALSE(ditheringEnabled());
+
+    // Every integer level is an exact LUT entry
+    for (unsigned level = 0; level < 256; ++level) {
+        Fader_setLevel(static_cast<uint8_t>(level));
+        CHECK_FALSE(ditheringEnabled());
+        CHECK(loadedDutyCycle() == GammaLUT[level]);
+    }
+}
+
+TEST_CASE("Dithering ISR fits in the PWM period budget")
+{
+    // The ISR runs in every PWM period. The tightest target is the 8 kHz
+    // PWM of LEDTimerLite.X (8 MHz, TMR2 1:4, PR2 = 0x3F), which gives the
+    // same 256 instruction cycles per period as this firmware
+    // (16 MHz, TMR2 1:1, PR2 = 0xFF).
+    constexpr unsigned LiteCyclesPerPeriod = (0x3F + 1) * 4;
+    constexpr unsigned CyclesPerPeriod = (0xFF + 1) * 1;
+
+    // Enhanced mid-range core: interrupt latency (5) and RETFIE (2) with
+    // automatic context saving, the IOC, PEIE and TMR2 flag checks of the
+    // ISR before the dithering code (10)
+    constexpr unsigned IsrEntryExitCycles = 5 + 2 + 10;
+
+    // Counted instructions of the dithering path (banked access, 8-bit
+    // operands): flag clear (1), load + add (4), compare and branch (4),
+    // two register copies (2 * 4), accumulator store (2)
+    constexpr unsigned DitheringCycles = 1 + 4 + 4 + 2 * 4 + 2;
+
+    constexpr unsigned IsrCycles = IsrEntryExitCycles + DitheringCycles;
+
+    // Less than 1/4 of the CPU time is spent dithering
+    static_assert(IsrCycles * 4 < LiteCyclesPerPeriod);
+    static_assert(IsrCycles * 4 < CyclesPerPeriod);
+
+    // Count the register writes on the host: exactly one duty cycle load
+    // per period and no other side effect besides the accumulator
+    setPosition(60, 64);
+    REQUIRE(ditheringEnabled());
+
+    const uint8_t step = Fader_ditherContext.step;
+    const uint8_t lowDCH = Fader_ditherContext.lowDCH;
+    const uint8_t lowDCL = Fader_ditherContext.lowDCL;
+    const uint8_t highDCH = Fader_ditherContext.highDCH;
+    const uint8_t highDCL = Fader_ditherContext.highDCL;
+
+    for (unsigned period = 0; period < 1000; ++period) {
+        PWM5DCH = 0xAA;
+        PWM5DCL = 0x01;
+
+        pwmPeriodInterrupt();
+
+        // Both registers are written with one of the precomputed pairs
+        const bool low = PWM5DCH == lowDCH && PWM5DCL == lowDCL;
+        const bool high = PWM5DCH == highDCH && PWM5DCL == highDCL;
+        REQUIRE((low || high));
+
+        REQUIRE(Fader_ditherContext.step == step);
+        REQUIRE(Fader_ditherContext.lowDCH == lowDCH);
+        REQUIRE(Fader_ditherContext.highDCH == highDCH);
+    }
+
+    Fader_setLevel(0);
+}
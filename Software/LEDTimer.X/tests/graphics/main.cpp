@@ -0,0 +1,154 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <Graphics.h>
+
+#include "../mock/Transfers.hpp"
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using namespace mock;
+
+namespace {
+    constexpr uint8_t BarX = 3;
+
+    // Columns of the schedule bar as drawn by the original per-column renderer
+    [[nodiscard]] std::vector<uint8_t> referenceScheduleBar(const ScheduleSegmentData segmentData, const bool flip) {
+        const uint8_t longTick = flip ? 0b00001111 : 0b11110000;
+        const uint8_t shortTick = flip ? 0b00001110 : 0b01110000;
+        const uint8_t activeIndicator = flip ? 0b11101000 : 0b00010111;
+        const uint8_t inactiveIndicator = flip ? 0b00001000 : 0b00010000;
+
+        std::vector<uint8_t> columns;
+
+        for (int i = 0; i < 121; ++i) {
+            const int hour = i / 5;
+
+            if (i % 5 == 0) {
+                columns.push_back(hour % 6 == 0 ? longTick : shortTick);
+            } else {
+                const int segment = hour * 2 + (i % 5 >= 3 ? 1 : 0);
+                const bool active = (segmentData[segment >> 3] >> (segment & 7)) & 1;
+                columns.push_back(active ? activeIndicator : inactiveIndicator);
+            }
+        }
+
+        return columns;
+    }
+
+    void randomSegmentData(ScheduleSegmentData data, const unsigned seed) {
+        std::mt19937 generator{ seed };
+        for (int i = 0; i < 6; ++i) {
+            data[i] = static_cast<uint8_t>(generator());
+        }
+    }
+}
+
+TEST_CASE("Schedule bar is drawn with one data transfer", "[graphics]") {
+    for (unsigned seed = 0; seed < 16; ++seed) {
+        ScheduleSegmentData data;
+        randomSegmentData(data, seed);
+
+        for (const bool flip : { false, true }) {
+            resetDisplay();
+
+            Graphics_drawScheduleBar(4, data, flip ? GRAPHICS_DRAW_SCHEDULE_BAR_FLIP : 0);
+            SSD1306_flush();
+
+            const auto transfers = recordedTransfers();
+
+            // Bar position and data, then 5 labels
+            REQUIRE(transfers.size() == 2 + 5 * 2);
+            REQUIRE(transfers[0] == position(flip ? 5 : 4, BarX));
+            REQUIRE(transfers[1] == Transfer{ DataControl, referenceScheduleBar(data, flip) });
+        }
+    }
+}
+
+TEST_CASE("Schedule bar is inverted", "[graphics]") {
+    ScheduleSegmentData data;
+    randomSegmentData(data, 1234);
+
+    resetDisplay();
+
+    Graphics_drawScheduleBar(0, data, GRAPHICS_DRAW_SCHEDULE_BAR_INVERT);
+    SSD1306_flush();
+
+    auto expected = referenceScheduleBar(data, false);
+    for (auto& column : expected) {
+        column = static_cast<uint8_t>(~column);
+    }
+
+    REQUIRE(recordedTransfers()[1] == Transfer{ DataControl, expected });
+}
+
+TEST_CASE("Schedule bar segment redraw matches the full bar", "[graphics]") {
+    ScheduleSegmentData data;
+    randomSegmentData(data, 42);
+
+    for (const bool flip : { false, true }) {
+        const auto bar = referenceScheduleBar(data, flip);
+
+        for (uint8_t segment = 0; segment < 48; ++segment) {
+            resetDisplay();
+
+            Graphics_drawScheduleBarSegment(2, data, segment, flip ? GRAPHICS_DRAW_SCHEDULE_BAR_FLIP : 0);
+            SSD1306_flush();
+
+            // Tick + 2 columns for every segment before in the same hour
+            const uint8_t column = BarX + (segment / 2) * 5 + 1 + (segment % 2) * 2;
+            const std::vector<uint8_t> expected(bar.begin() + (column - BarX), bar.begin() + (column - BarX) + 2);
+
+            const auto transfers = recordedTransfers();
+
+            REQUIRE(transfers.size() == 2);
+            REQUIRE(transfers[0] == position(flip ? 3 : 2, column));
+            REQUIRE(transfers[1] == Transfer{ DataControl, expected });
+        }
+    }
+}
+
+TEST_CASE("Labels are drawn like their text", "[graphics][labels]") {
+    for (int label = 0; label < Label_Count; ++label) {
+        INFO(Labels_texts[label]);
+
+        for (const bool invert : { false, true }) {
+            resetDisplay();
+
+            Text_draw(Labels_texts[label], 3, 20, 1, invert);
+            SSD1306_flush();
+            const auto expected = recordedTransfers();
+            Mock_SSP1_clearEvents();
+
+            const uint8_t end = Graphics_drawLabel2(
+                static_cast<Label>(label),
+                3,
+                20,
+                SSD1306_SEND_BITSHIFT(1) | (invert ? GRAPHICS_DRAW_INVERT : 0)
+            );
+            SSD1306_flush();
+
+            REQUIRE(recordedTransfers() == expected);
+            REQUIRE(static_cast<int>(end) == 20 + Labels_entries[label].columns + 1);
+        }
+    }
+}
+
+TEST_CASE("Labels are clipped at the right edge", "[graphics][labels]") {
+    resetDisplay();
+
+    Text_draw(Labels_texts[Label_Settings], 0, 100, 0, false);
+    SSD1306_flush();
+    const auto expected = recordedTransfers();
+    Mock_SSP1_clearEvents();
+
+    Graphics_drawLabel(Label_Settings, 0, 100);
+    SSD1306_flush();
+
+    const auto transfers = recordedTransfers();
+
+    REQUIRE(transfers.size() == 2);
+    REQUIRE(transfers[1].payload.size() == 28);
+    REQUIRE(transfers == expected);
+}
@@ -0,0 +1,332 @@
+#include "SSD1306Emulator.hpp"
+
+#include "xc.h"
+
+#include <cstdio>
+
+namespace mock {
+
+namespace {
+    // Total length (command + arguments) of a command starting with the byte
+    [[nodiscard]] size_t commandLength(const uint8_t command) {
+        switch (command) {
+            case 0x20: // Memory addressing mode
+            case 0x81: // Contrast
+            case 0x8D: // Charge pump
+            case 0xA8: // Multiplex ratio
+            case 0xD3: // Display offset
+            case 0xD5: // Clock divide ratio
+            case 0xD9: // Pre-charge period
+            case 0xDA: // COM pins
+            case 0xDB: // VCOMH deselect level
+                return 2;
+
+            case 0x21: // Column address
+            case 0x22: // Page address
+            case 0xA3: // Vertical scroll area
+                return 3;
+
+            case 0x29: // Vertical and right horizontal scroll
+            case 0x2A: // Vertical and left horizontal scroll
+                return 6;
+
+            case 0x26: // Right horizontal scroll
+            case 0x27: // Left horizontal scroll
+                return 7;
+
+            default:
+                return 1;
+        }
+    }
+
+    [[nodiscard]] std::string hex(const uint8_t value) {
+        char s[8];
+        std::snprintf(s, sizeof(s), "0x%02X", value);
+        return s;
+    }
+}
+
+void SSD1306Emulator::reset()
+{
+    *this = SSD1306Emulator{};
+}
+
+void SSD1306Emulator::resetStatistics()
+{
+    m_statistics = {};
+}
+
+void SSD1306Emulator::process(const uint16_t* const events, const size_t count)
+{
+    for (size_t i = 0; i < count; ++i) {
+        const auto event = events[i];
+
+        switch (event) {
+            case Mock_I2C_Start:
+                ++m_statistics.starts;
+
+                if (m_busState == BusState::Commands && !m_command.empty()) {
+                    error("Incomplete command " + hex(m_command.front()) + " at the end of the transfer");
+                    m_command.clear();
+                }
+
+                m_busState = BusState::Address;
+                break;
+
+            case Mock_I2C_Stop:
+                ++m_statistics.stops;
+
+                if (m_busState == BusState::Commands && !m_command.empty()) {
+                    error("Incomplete command " + hex(m_command.front()) + " at the end of the transfer");
+                    m_command.clear();
+                }
+
+                m_busState = BusState::Idle;
+                break;
+
+            case Mock_I2C_Collision:
+                error("MSSP write collision");
+                break;
+
+            default:
+                ++m_statistics.bytes;
+                processByte(static_cast<uint8_t>(event));
+                break;
+        }
+    }
+}
+
+void SSD1306Emulator::processRecordedEvents()
+{
+    process(Mock_SSP1_events(), Mock_SSP1_eventCount());
+    Mock_SSP1_clearEvents();
+}
+
+void SSD1306Emulator::processByte(const uint8_t byte)
+{
+    switch (m_busState) {
+        case BusState::Idle:
+            error("Byte " + hex(byte) + " sent without START");
+            break;
+
+        case BusState::Address:
+            if (byte != (Address << 1)) {
+                error("Unexpected address byte " + hex(byte));
+            }
+            m_busState = BusState::Control;
+            break;
+
+        case BusState::Control:
+            // Only Co = 0 is supported by the driver: the rest of the
+            // transfer is either command or data stream
+            if (byte == 0x00) {
+                m_busState = BusState::Commands;
+            } else if (byte == 0x40) {
+                m_busState = BusState::Data;
+            } else {
+                error("Unsupported control byte " + hex(byte));
+                m_busState = BusState::Idle;
+            }
+            break;
+
+        case BusState::Commands:
+            ++m_statistics.commandBytes;
+            processCommandByte(byte);
+            break;
+
+        case BusState::Data:
+            ++m_statistics.dataBytes;
+            writeData(byte);
+            break;
+    }
+}
+
+void SSD1306Emulator::processCommandByte(const uint8_t byte)
+{
+    if (m_command.empty()) {
+        m_expectedCommandLength = commandLength(byte);
+    }
+
+    m_command.push_back(byte);
+
+    if (m_command.size() == m_expectedCommandLength) {
+        executeCommand();
+        m_command.clear();
+    }
+}
+
+void SSD1306Emulator::executeCommand()
+{
+    const uint8_t command = m_command[0];
+
+    if (command <= 0x0F) {
+        m_pageModeColumnStart = (m_pageModeColumnStart & 0xF0) | (command & 0x0F);
+        m_column = m_pageModeColumnStart;
+        return;
+    }
+
+    if (command <= 0x1F) {
+        m_pageModeColumnStart = static_cast<uint8_t>(((command & 0x07) << 4) | (m_pageModeColumnStart & 0x0F));
+        m_column = m_pageModeColumnStart;
+        return;
+    }
+
+    if (command >= 0x40 && command <= 0x7F) {
+        // Display start line
+        return;
+    }
+
+    if (command >= 0xB0 && command <= 0xB7) {
+        m_page = command & 0x07;
+        return;
+    }
+
+    switch (command) {
+        case 0x20:
+            if (m_command[1] > 2) {
+                error("Invalid addressing mode " + hex(m_command[1]));
+                break;
+            }
+            m_addressingMode = static_cast<AddressingMode>(m_command[1]);
+            break;
+
+        case 0x21:
+            m_columnStart = m_command[1] & 0x7F;
+            m_columnEnd = m_command[2] & 0x7F;
+            m_column = m_columnStart;
+            break;
+
+        case 0x22:
+            m_pageStart = m_command[1] & 0x07;
+            m_pageEnd = m_command[2] & 0x07;
+            m_page = m_pageStart;
+            break;
+
+        case 0x26:
+        case 0x27:
+        case 0x29:
+        case 0x2A:
+            if (m_scroll.active) {
+                error("Scroll setup changed while scrolling");
+            }
+            m_scroll.command = command;
+            m_scroll.startPage = m_command[2] & 0x07;
+            m_scroll.interval = m_command[3] & 0x07;
+            m_scroll.endPage = m_command[4] & 0x07;
+            m_scroll.verticalOffset = (command == 0x29 || command == 0x2A) ? (m_command[5] & 0x3F) : 0;
+            break;
+
+        case 0x2E:
+            m_scroll.active = false;
+            break;
+
+        case 0x2F:
+            if (m_scroll.command == 0) {
+                error("Scroll activated without setup");
+            }
+            m_scroll.active = true;
+            break;
+
+        case 0x81:
+            m_contrast = m_command[1];
+            break;
+
+        case 0xA6:
+        case 0xA7:
+            m_inverted = command == 0xA7;
+            break;
+
+        case 0xAE:
+        case 0xAF:
+            m_displayOn = command == 0xAF;
+            break;
+
+        case 0x8D:
+        case 0xA0:
+        case 0xA1:
+        case 0xA3:
+        case 0xA4:
+        case 0xA5:
+        case 0xA8:
+        case 0xC0:
+        case 0xC8:
+        case 0xD3:
+        case 0xD5:
+        case 0xD9:
+        case 0xDA:
+        case 0xDB:
+        case 0xE3:
+            // Hardware configuration, not modeled
+            break;
+
+        default:
+            error("Unknown command " + hex(command));
+            break;
+    }
+}
+
+void SSD1306Emulator::writeData(const uint8_t byte)
+{
+    if (m_scroll.active) {
+        error("GDDRAM written while scrolling is active");
+    }
+
+    m_gddram[m_page][m_column] = byte;
+
+    switch (m_addressingMode) {
+        case AddressingMode::Page:
+            if (++m_column > Width - 1) {
+                m_column = m_pageModeColumnStart;
+            }
+            break;
+
+        case AddressingMode::Horizontal:
+            if (m_column++ >= m_columnEnd) {
+                m_column = m_columnStart;
+                if (m_page++ >= m_pageEnd) {
+                    m_page = m_pageStart;
+                }
+            }
+            break;
+
+        case AddressingMode::Vertical:
+            if (m_page++ >= m_pageEnd) {
+                m_page = m_pageStart;
+                if (m_column++ >= m_columnEnd) {
+                    m_column = m_columnStart;
+                }
+            }
+            break;
+    }
+}
+
+void SSD1306Emulator::error(const std::string& message)
+{
+    m_errors.push_back(message);
+}
+
+bool SSD1306Emulator::pixel(const uint8_t x, const uint8_t y) const
+{
+    return (m_gddram[y >> 3][x] >> (y & 7)) & 1;
+}
+
+uint8_t SSD1306Emulator::gddram(const uint8_t page, const uint8_t column) const
+{
+    return m_gddram[page][column];
+}
+
+std::string SSD1306Emulator::render() const
+{
+    std::string s;
+
+    for (uint8_t y = 0; y < Pages * 8; ++y) {
+        for (uint8_t x = 0; x < Width; ++x) {
+            s += pixel(x, y) ? '#' : '.';
+        }
+        s += '\n';
+    }
+
+    return s;
+}
+
+}
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace mock {
+
+/*
+ * Model of an SSD1306 128x64 display controller driven over I2C.
+ *
+ * Decodes the bus events recorded by the simulated MSSP (see xc.h) into
+ * commands and GDDRAM writes, following the memory addressing modes, the
+ * page / column pointers and the scroll setup. Protocol violations (unknown
+ * commands, missing arguments, GDDRAM writes while scrolling) are collected
+ * as errors.
+ */
+class SSD1306Emulator
+{
+public:
+    static constexpr uint8_t Width = 128;
+    static constexpr uint8_t Pages = 8;
+    static constexpr uint8_t Address = 0x3C;
+
+    enum class AddressingMode : uint8_t {
+        Horizontal = 0,
+        Vertical = 1,
+        Page = 2
+    };
+
+    struct Scroll {
+        bool active = false;
+        uint8_t command = 0;
+        uint8_t startPage = 0;
+        uint8_t endPage = 0;
+        uint8_t interval = 0;
+        uint8_t verticalOffset = 0;
+    };
+
+    // Bus traffic since the last call of resetStatistics()
+    struct Statistics {
+        size_t bytes = 0;   // Including the address and control bytes
+        size_t starts = 0;
+        size_t stops = 0;
+        size_t dataBytes = 0;
+        size_t commandBytes = 0;
+
+        // Estimated bus time (9 clocks per byte, 1 per START and STOP)
+        [[nodiscard]] double busTimeUs(const unsigned frequencyHz) const {
+            return static_cast<double>(bytes * 9 + starts + stops) * 1e6 / frequencyHz;
+        }
+    };
+
+    void reset();
+    void resetStatistics();
+
+    // Processes the bus events recorded by the simulated MSSP
+    void process(const uint16_t* events, size_t count);
+
+    // Processes and clears the events recorded by the simulated MSSP
+    void processRecordedEvents();
+
+    [[nodiscard]] bool pixel(uint8_t x, uint8_t y) const;
+    [[nodiscard]] uint8_t gddram(uint8_t page, uint8_t column) const;
+
+    [[nodiscard]] AddressingMode addressingMode() const { return m_addressingMode; }
+    [[nodiscard]] uint8_t pagePointer() const { return m_page; }
+    [[nodiscard]] uint8_t columnPointer() const { return m_column; }
+    [[nodiscard]] const Scroll& scroll() const { return m_scroll; }
+    [[nodiscard]] bool displayOn() const { return m_displayOn; }
+    [[nodiscard]] bool inverted() const { return m_inverted; }
+    [[nodiscard]] uint8_t contrast() const { return m_contrast; }
+
+    [[nodiscard]] const Statistics& statistics() const { return m_statistics; }
+    [[nodiscard]] const std::vector<std::string>& errors() const { return m_errors; }
+
+    // Text rendering of the GDDRAM content ('#' = lit pixel)
+    [[nodiscard]] std::string render() const;
+
+private:
+    enum class BusState {
+        Idle,
+        Address,
+        Control,
+        Commands,
+        Data
+    };
+
+    void processByte(uint8_t byte);
+    void processCommandByte(uint8_t byte);
+    void executeCommand();
+    void writeData(uint8_t byte);
+    void error(const std::string& message);
+
+    std::array<std::array<uint8_t, Width>, Pages> m_gddram{};
+
+    BusState m_busState = BusState::Idle;
+    std::vector<uint8_t> m_command;
+    size_t m_expectedCommandLength = 0;
+
+    AddressingMode m_addressingMode = AddressingMode::Page;
+    uint8_t m_columnStart = 0;
+    uint8_t m_columnEnd = Width - 1;
+    uint8_t m_pageStart = 0;
+    uint8_t m_pageEnd = Pages - 1;
+    uint8_t m_pageModeColumnStart = 0;
+    uint8_t m_column = 0;
+    uint8_t m_page = 0;
+
+    Scroll m_scroll;
+    bool m_displayOn = false;
+    bool m_inverted = false;
+    uint8_t m_contrast = 0x7F;
+
+    Statistics m_statistics;
+    std::vector<std::string> m_errors;
+};
+
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <SSD1306.h>
+#include <xc.h>
+
+#include <cstdint>
+#include <initializer_list>
+#include <vector>
+
+/*
+ * Helpers for checking the display traffic recorded by the simulated MSSP
+ */
+namespace mock {
+    constexpr uint16_t DisplayAddress = 0x3C << 1;
+    constexpr uint8_t CommandControl = 0x00;
+    constexpr uint8_t DataControl = 0x40;
+
+    struct Transfer {
+        uint8_t control;
+        std::vector<uint8_t> payload;
+
+        bool operator==(const Transfer& other) const {
+            return control == other.control && payload == other.payload;
+        }
+    };
+
+    // Splits the recorded bus events into I2C transfers
+    [[nodiscard]] inline std::vector<Transfer> recordedTransfers() {
+        const auto* events = Mock_SSP1_events();
+        const auto count = Mock_SSP1_eventCount();
+
+        std::vector<Transfer> transfers;
+
+        for (size_t i = 0; i < count; ++i) {
+            REQUIRE(events[i] != Mock_I2C_Collision);
+
+            if (events[i] == Mock_I2C_Start) {
+                REQUIRE(i + 2 < count);
+                REQUIRE(events[i + 1] == DisplayAddress);
+                transfers.push_back({ static_cast<uint8_t>(events[i + 2]), {} });
+                i += 2;
+            } else if (events[i] != Mock_I2C_Stop) {
+                REQUIRE_FALSE(transfers.empty());
+                transfers.back().payload.push_back(static_cast<uint8_t>(events[i]));
+            }
+        }
+
+        return transfers;
+    }
+
+    // Page addressing mode position command (without the addressing mode)
+    [[nodiscard]] inline Transfer position(const uint8_t page, const uint8_t column) {
+        return {
+            CommandControl,
+            {
+                static_cast<uint8_t>(SSD1306_CMD_PAGESTARTADDR | page),
+                static_cast<uint8_t>(SSD1306_CMD_SETLOWCOLUMN | (column & 0xF)),
+                static_cast<uint8_t>(SSD1306_CMD_SETHIGHCOLUMN | (column >> 4))
+            }
+        };
+    }
+
+    // Empties the transmit queue with the display in page addressing mode
+    inline void resetDisplay() {
+        Mock_reset(SSD1306_handleInterrupt);
+        SSD1306_enablePageAddressing();
+        SSD1306_flush();
+        Mock_SSP1_clearEvents();
+    }
+
+    [[nodiscard]] inline std::vector<uint8_t> concat(std::initializer_list<std::vector<uint8_t>> parts) {
+        std::vector<uint8_t> result;
+        for (const auto& part : parts) {
+            result.insert(result.end(), part.begin(), part.end());
+        }
+        return result;
+    }
+}
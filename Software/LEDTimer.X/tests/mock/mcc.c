@@ -0,0 +1,56 @@
+/*
+ * Fake implementation of the MCC generated drivers used by the firmware
+ * modules under test
+ */
+
+#include "xc.h"
+
+#include "mcc_generated_files/memory.h"
+#include "mcc_generated_files/pwm5.h"
+#include "mcc_generated_files/tmr1.h"
+
+Utils_InstanceStorage uint16_t Mock_pwm5DutyValue;
+Utils_InstanceStorage uint16_t Mock_tmr1Value;
+
+void DATAEE_WriteByte(uint8_t bAdd, uint8_t bData)
+{
+    Mock_eeprom[bAdd] = bData;
+    Mock_tmr1Value += Mock_EepromWriteTime;
+}
+
+uint8_t DATAEE_ReadByte(uint8_t bAdd)
+{
+    // Reading during a write would change the address of the write
+    if (Mock_NVM_writing()) {
+        Mock_NVM_readDuringWrite();
+    }
+
+    return Mock_eeprom[bAdd];
+}
+
+void PWM5_LoadDutyValue(uint16_t dutyValue)
+{
+    Mock_pwm5DutyValue = dutyValue;
+    PWM5DCH = (dutyValue & 0x03FC) >> 2;
+    PWM5DCL = (uint8_t)((dutyValue & 0x0003) << 6);
+}
+
+void TMR1_StartTimer(void)
+{
+    T1CONbits.TMR1ON = 1;
+}
+
+void TMR1_StopTimer(void)
+{
+    T1CONbits.TMR1ON = 0;
+}
+
+uint16_t TMR1_ReadTimer(void)
+{
+    return Mock_tmr1Value;
+}
+
+void TMR1_WriteTimer(uint16_t timerVal)
+{
+    Mock_tmr1Value = timerVal;
+}
@@ -0,0 +1,267 @@
+#include "xc.h"
+
+#include <string.h>
+
+#define MOCK_SSP1_MAX_EVENTS 8192u
+
+Utils_InstanceStorage volatile Mock_SSP1CON2bits SSP1CON2bits;
+Utils_InstanceStorage volatile Mock_PIR1bits PIR1bits;
+Utils_InstanceStorage volatile Mock_PIE1bits PIE1bits;
+Utils_InstanceStorage volatile Mock_T1CONbits T1CONbits;
+Utils_InstanceStorage volatile Mock_NVMCON1bits NVMCON1bits;
+Utils_InstanceStorage volatile Mock_PIR2bits PIR2bits;
+Utils_InstanceStorage volatile Mock_PIE2bits PIE2bits;
+Utils_InstanceStorage volatile Mock_INTCONbits INTCONbits;
+Utils_InstanceStorage volatile uint8_t NVMADRL;
+Utils_InstanceStorage volatile uint8_t NVMADRH;
+Utils_InstanceStorage volatile uint8_t NVMDATL;
+Utils_InstanceStorage volatile uint8_t PWM5DCH;
+Utils_InstanceStorage volatile uint8_t PWM5DCL;
+
+Utils_InstanceStorage uint8_t Mock_eeprom[256];
+
+static Utils_InstanceStorage struct
+{
+    void (*isr)(void);
+    volatile uint8_t buffer;
+    bool bufferWritten;
+    size_t eventCount;
+    uint16_t events[MOCK_SSP1_MAX_EVENTS];
+} mock;
+
+#define MOCK_NVM_MAX_WRITES 4096u
+
+static Utils_InstanceStorage struct
+{
+    void (*isr)(void);
+    uint16_t writeTicks;
+    uint16_t remainingTicks;
+    bool writing;
+    uint8_t address;
+    uint8_t data;
+    // Last two values written to NVMCON2
+    volatile uint8_t con2;
+    uint8_t previousCon2;
+    bool unlockedWithInterrupts;
+    size_t errors;
+    size_t writeCount;
+    uint8_t writtenAddresses[MOCK_NVM_MAX_WRITES];
+} nvm;
+
+static void recordEvent(const uint16_t event)
+{
+    if (mock.eventCount < MOCK_SSP1_MAX_EVENTS) {
+        mock.events[mock.eventCount++] = event;
+    }
+}
+
+volatile uint8_t* Mock_SSP1_bufferWrite(void)
+{
+    if (mock.bufferWritten || SSP1CON2bits.SEN || SSP1CON2bits.PEN) {
+        recordEvent(Mock_I2C_Collision);
+    }
+
+    mock.bufferWritten = true;
+
+    return &mock.buffer;
+}
+
+void Mock_tick(void)
+{
+    // Complete the MSSP operation started since the last tick
+    if (SSP1CON2bits.SEN + SSP1CON2bits.PEN + mock.bufferWritten > 1) {
+        recordEvent(Mock_I2C_Collision);
+    }
+
+    if (SSP1CON2bits.SEN) {
+        SSP1CON2bits.SEN = 0;
+        recordEvent(Mock_I2C_Start);
+        PIR1bits.SSP1IF = 1;
+    } else if (SSP1CON2bits.PEN) {
+        SSP1CON2bits.PEN = 0;
+        recordEvent(Mock_I2C_Stop);
+        PIR1bits.SSP1IF = 1;
+    } else if (mock.bufferWritten) {
+        mock.bufferWritten = false;
+        recordEvent(mock.buffer);
+        PIR1bits.SSP1IF = 1;
+    }
+
+    if (PIR1bits.SSP1IF && PIE1bits.SSP1IE && mock.isr) {
+        PIR1bits.SSP1IF = 0;
+        mock.isr();
+    }
+}
+
+void Mock_reset(void (*isr)(void))
+{
+    memset((void*)&SSP1CON2bits, 0, sizeof(SSP1CON2bits));
+    memset((void*)&PIR1bits, 0, sizeof(PIR1bits));
+    memset((void*)&PIE1bits, 0, sizeof(PIE1bits));
+    memset((void*)&T1CONbits, 0, sizeof(T1CONbits));
+
+    PIE1bits.SSP1IE = 1;
+
+    mock.isr = isr;
+    mock.buffer = 0;
+    mock.bufferWritten = false;
+    mock.eventCount = 0;
+}
+
+void Mock_SSP1_clearEvents(void)
+{
+    mock.eventCount = 0;
+}
+
+size_t Mock_SSP1_eventCount(void)
+{
+    return mock.eventCount;
+}
+
+const uint16_t* Mock_SSP1_events(void)
+{
+    return mock.events;
+}
+
+volatile uint8_t* Mock_NVMCON2_write(void)
+{
+    if (INTCONbits.GIE) {
+        nvm.unlockedWithInterrupts = true;
+    }
+
+    nvm.previousCon2 = nvm.con2;
+
+    return &nvm.con2;
+}
+
+void Mock_NVM_reset(void (*isr)(void), const uint16_t writeTicks)
+{
+    memset((void*)&NVMCON1bits, 0, sizeof(NVMCON1bits));
+    memset((void*)&PIR2bits, 0, sizeof(PIR2bits));
+    memset((void*)&PIE2bits, 0, sizeof(PIE2bits));
+    memset((void*)&INTCONbits, 0, sizeof(INTCONbits));
+    NVMADRL = 0;
+    NVMADRH = 0;
+    NVMDATL = 0;
+
+    INTCONbits.GIE = 1;
+    INTCONbits.PEIE = 1;
+
+    nvm.isr = isr;
+    nvm.writeTicks = writeTicks > 0 ? writeTicks : 1;
+    nvm.remainingTicks = 0;
+    nvm.writing = false;
+    nvm.con2 = 0;
+    nvm.previousCon2 = 0;
+    nvm.unlockedWithInterrupts = false;
+    nvm.errors = 0;
+    nvm.writeCount = 0;
+}
+
+static void startWrite(void)
+{
+    bool unlocked = nvm.previousCon2 == 0x55 && nvm.con2 == 0xAA;
+
+    if (
+        !unlocked
+        || nvm.unlockedWithInterrupts
+        || !NVMCON1bits.WREN
+        || !NVMCON1bits.NVMREGS
+        || NVMADRH != 0x70
+    ) {
+        ++nvm.errors;
+        NVMCON1bits.WR = 0;
+    } else {
+        nvm.writing = true;
+        nvm.address = NVMADRL;
+        nvm.data = NVMDATL;
+        nvm.remainingTicks = nvm.writeTicks;
+    }
+
+    nvm.con2 = 0;
+    nvm.previousCon2 = 0;
+    nvm.unlockedWithInterrupts = false;
+}
+
+void Mock_NVM_tick(void)
+{
+    if (!nvm.writing) {
+        if (!NVMCON1bits.WR) {
+            return;
+        }
+
+        startWrite();
+
+        if (!nvm.writing) {
+            return;
+        }
+    }
+
+    // The registers of the running write must not be changed
+    if (NVMADRL != nvm.address || NVMDATL != nvm.data || NVMADRH != 0x70) {
+        ++nvm.errors;
+    }
+
+    if (--nvm.remainingTicks > 0) {
+        return;
+    }
+
+    Mock_eeprom[nvm.address] = nvm.data;
+
+    if (nvm.writeCount < MOCK_NVM_MAX_WRITES) {
+        nvm.writtenAddresses[nvm.writeCount++] = nvm.address;
+    }
+
+    nvm.writing = false;
+    NVMCON1bits.WR = 0;
+    PIR2bits.NVMIF = 1;
+
+    if (PIE2bits.NVMIE && nvm.isr) {
+        // Like the hardware, the handler runs with the interrupts disabled
+        INTCONbits.GIE = 0;
+        nvm.isr();
+        INTCONbits.GIE = 1;
+    }
+
+    // A write started by the handler begins with the next tick
+}
+
+void Mock_NVM_powerLoss(void)
+{
+    if (nvm.writing) {
+        Mock_eeprom[nvm.address] = 0xFF;
+    }
+
+    nvm.writing = false;
+    NVMCON1bits.WR = 0;
+    NVMCON1bits.WREN = 0;
+    PIR2bits.NVMIF = 0;
+    PIE2bits.NVMIE = 0;
+    nvm.con2 = 0;
+    nvm.previousCon2 = 0;
+}
+
+bool Mock_NVM_writing(void)
+{
+    return nvm.writing || NVMCON1bits.WR;
+}
+
+void Mock_NVM_readDuringWrite(void)
+{
+    ++nvm.errors;
+}
+
+size_t Mock_NVM_errors(void)
+{
+    return nvm.errors;
+}
+
+const uint8_t* Mock_NVM_writtenAddresses(void)
+{
+    return nvm.writtenAddresses;
+}
+
+size_t Mock_NVM_writeCount(void)
+{
+    return nvm.writeCount;
+}
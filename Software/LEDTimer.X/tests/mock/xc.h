@@ -0,0 +1,230 @@
+/*
+ * Host replacement of the XC8 device header.
+ *
+ * Only the registers used by the firmware modules under test are declared.
+ * The MSSP1 peripheral is simulated: every NOP() advances it by one I2C
+ * event (start, byte or stop), sets SSP1IF and runs the registered
+ * interrupt handler like the hardware would.
+ *
+ * The NVM controller is simulated for data EEPROM writes: a write started
+ * with the unlock sequence completes after a configurable number of
+ * Mock_NVM_tick() calls, then NVMIF is set and the registered handler runs.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// The simulated peripherals are thread-local in the fleet simulator (see
+// Utils.h), each thread runs a separate device
+#ifndef Utils_InstanceStorage
+#define Utils_InstanceStorage
+#endif
+
+typedef struct
+{
+    unsigned SEN : 1;
+    unsigned RSEN : 1;
+    unsigned PEN : 1;
+    unsigned RCEN : 1;
+    unsigned ACKEN : 1;
+    unsigned ACKDT : 1;
+    unsigned ACKSTAT : 1;
+    unsigned GCEN : 1;
+} Mock_SSP1CON2bits;
+
+typedef struct
+{
+    unsigned TMR1IF : 1;
+    unsigned TMR2IF : 1;
+    unsigned BCL1IF : 1;
+    unsigned SSP1IF : 1;
+    unsigned TXIF : 1;
+    unsigned RCIF : 1;
+    unsigned ADIF : 1;
+    unsigned TMR1GIF : 1;
+} Mock_PIR1bits;
+
+typedef struct
+{
+    unsigned TMR1IE : 1;
+    unsigned TMR2IE : 1;
+    unsigned BCL1IE : 1;
+    unsigned SSP1IE : 1;
+    unsigned TXIE : 1;
+    unsigned RCIE : 1;
+    unsigned ADIE : 1;
+    unsigned TMR1GIE : 1;
+} Mock_PIE1bits;
+
+typedef struct
+{
+    unsigned TMR1ON : 1;
+    unsigned : 1;
+    unsigned T1SYNC : 1;
+    unsigned T1SOSC : 1;
+    unsigned T1CKPS : 2;
+    unsigned TMR1CS : 2;
+} Mock_T1CONbits;
+
+typedef struct
+{
+    unsigned RD : 1;
+    unsigned WR : 1;
+    unsigned WREN : 1;
+    unsigned WRERR : 1;
+    unsigned FREE : 1;
+    unsigned LWLO : 1;
+    unsigned NVMREGS : 1;
+    unsigned : 1;
+} Mock_NVMCON1bits;
+
+typedef struct
+{
+    unsigned TMR4IF : 1;
+    unsigned TMR6IF : 1;
+    unsigned : 2;
+    unsigned NVMIF : 1;
+    unsigned : 3;
+} Mock_PIR2bits;
+
+typedef struct
+{
+    unsigned TMR4IE : 1;
+    unsigned TMR6IE : 1;
+    unsigned : 2;
+    unsigned NVMIE : 1;
+    unsigned : 3;
+} Mock_PIE2bits;
+
+typedef struct
+{
+    unsigned INTEDG : 1;
+    unsigned : 5;
+    unsigned PEIE : 1;
+    unsigned GIE : 1;
+} Mock_INTCONbits;
+
+extern Utils_InstanceStorage volatile Mock_SSP1CON2bits SSP1CON2bits;
+extern Utils_InstanceStorage volatile Mock_PIR1bits PIR1bits;
+extern Utils_InstanceStorage volatile Mock_PIE1bits PIE1bits;
+extern Utils_InstanceStorage volatile Mock_T1CONbits T1CONbits;
+extern Utils_InstanceStorage volatile Mock_NVMCON1bits NVMCON1bits;
+extern Utils_InstanceStorage volatile Mock_PIR2bits PIR2bits;
+extern Utils_InstanceStorage volatile Mock_PIE2bits PIE2bits;
+extern Utils_InstanceStorage volatile Mock_INTCONbits INTCONbits;
+extern Utils_InstanceStorage volatile uint8_t NVMADRL;
+extern Utils_InstanceStorage volatile uint8_t NVMADRH;
+extern Utils_InstanceStorage volatile uint8_t NVMDATL;
+extern Utils_InstanceStorage volatile uint8_t PWM5DCH;
+extern Utils_InstanceStorage volatile uint8_t PWM5DCL;
+
+// Writes to SSP1BUF start a byte transmission
+#define SSP1BUF (*Mock_SSP1_bufferWrite())
+
+#define NOP() Mock_tick()
+
+// Writes to NVMCON2 are checked for the unlock sequence
+#define NVMCON2 (*Mock_NVMCON2_write())
+
+volatile uint8_t* Mock_SSP1_bufferWrite(void);
+void Mock_tick(void);
+volatile uint8_t* Mock_NVMCON2_write(void);
+
+/*
+ * Test control
+ */
+
+enum
+{
+    Mock_I2C_Start = 0x100,
+    Mock_I2C_Stop = 0x200,
+    // An operation was started while the previous one was in progress
+    Mock_I2C_Collision = 0x300
+};
+
+/**
+ * Resets the simulated peripherals and clears the recorded bus events.
+ * @param isr Function called when SSP1IF and SSP1IE are set
+ */
+void Mock_reset(void (*isr)(void));
+
+/**
+ * Clears the recorded bus events.
+ */
+void Mock_SSP1_clearEvents(void);
+
+/**
+ * @return Number of recorded bus events
+ */
+size_t Mock_SSP1_eventCount(void);
+
+/**
+ * @return Recorded bus events: data bytes (0..255) or Mock_I2C_* values
+ */
+const uint16_t* Mock_SSP1_events(void);
+
+/**
+ * Resets the simulated NVM controller.
+ * @param isr Function called when NVMIF and NVMIE are set (with GIE cleared)
+ * @param writeTicks Number of Mock_NVM_tick() calls a byte write takes
+ */
+void Mock_NVM_reset(void (*isr)(void), uint16_t writeTicks);
+
+/**
+ * Advances the running EEPROM write by one tick.
+ */
+void Mock_NVM_tick(void);
+
+/**
+ * Cuts the power: a running write leaves its byte erased (0xFF).
+ */
+void Mock_NVM_powerLoss(void);
+
+/**
+ * @return True while an EEPROM write is in progress
+ */
+bool Mock_NVM_writing(void);
+
+/**
+ * Counts a data EEPROM read while a write is in progress as an error.
+ */
+void Mock_NVM_readDuringWrite(void);
+
+/**
+ * @return Number of protocol violations (write without the unlock sequence
+ *  or with interrupts enabled, register access during a write)
+ */
+size_t Mock_NVM_errors(void);
+
+/**
+ * @return Addresses of the completed byte writes, in order
+ */
+const uint8_t* Mock_NVM_writtenAddresses(void);
+size_t Mock_NVM_writeCount(void);
+
+/*
+ * Fake MCC peripheral drivers (mcc.c)
+ */
+
+// Content of the data EEPROM
+extern Utils_InstanceStorage uint8_t Mock_eeprom[256];
+
+// Timer1 counts elapsed by DATAEE_WriteByte() (4 ms byte write time)
+#define Mock_EepromWriteTime 131u
+
+// Last value passed to PWM5_LoadDutyValue()
+extern Utils_InstanceStorage uint16_t Mock_pwm5DutyValue;
+
+// Counter of Timer1, changed by TMR1_WriteTimer(), the EEPROM writes and the tests
+extern Utils_InstanceStorage uint16_t Mock_tmr1Value;
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,161 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <OutputStateTable.h>
+
+#include <random>
+
+namespace {
+    // Boolean functions of the output controller before the table was
+    // introduced, these are the truth tables the table must follow
+
+    bool calculateOutputState(
+        const bool switchedOnBySchedule,
+        const bool runningFromBattery,
+        const bool outputOverride
+    ) {
+        return
+            (!switchedOnBySchedule && !runningFromBattery && outputOverride)
+            || (switchedOnBySchedule && !runningFromBattery && !outputOverride);
+    }
+
+    bool calculateOverrideState(
+        const bool switchedOnBySchedule,
+        const bool prevStateFromSchedule,
+        const bool outputOverride
+    ) {
+        return
+            (!switchedOnBySchedule && !prevStateFromSchedule && outputOverride)
+            || (switchedOnBySchedule && prevStateFromSchedule && outputOverride);
+    }
+
+    bool calculateOutputUpdateState(
+        const bool outputState,
+        const bool prevOutputState,
+        const bool forceUpdate
+    ) {
+        return
+            (!outputState && prevOutputState)
+            || (outputState && !prevOutputState)
+            || forceUpdate;
+    }
+
+    bool outputEnableTargetState(
+        const bool switchedOnBySchedule,
+        const bool outputOverride
+    ) {
+        return
+            (!switchedOnBySchedule && outputOverride)
+            || (switchedOnBySchedule && !outputOverride);
+    }
+
+    struct ReferenceController {
+        bool outputOverride = false;
+        bool prevOutputState = false;
+        bool switchedOnBySchedule = false;
+        bool prevStateFromSchedule = false;
+
+        bool task(const bool schedule, const bool battery, const bool force) {
+            switchedOnBySchedule = schedule;
+            outputOverride = calculateOverrideState(schedule, prevStateFromSchedule, outputOverride);
+            const bool output = calculateOutputState(schedule, battery, outputOverride);
+            const bool update = calculateOutputUpdateState(output, prevOutputState, force);
+            prevOutputState = output;
+            prevStateFromSchedule = schedule;
+            return update;
+        }
+
+        [[nodiscard]] bool targetState() const {
+            return outputEnableTargetState(switchedOnBySchedule, outputOverride);
+        }
+    };
+
+    // Same steps as OutputController_task()
+    struct TableController {
+        uint8_t state = 0;
+
+        bool task(const bool schedule, const bool battery, const bool force) {
+            uint8_t index = state;
+            if (schedule) {
+                index |= OutputState_InputSchedule;
+            }
+            if (battery) {
+                index |= OutputState_InputBattery;
+            }
+            if (force) {
+                index |= OutputState_InputForce;
+            }
+
+            const uint8_t entry = OutputState_tableEntry(index);
+            state = entry & OutputState_Mask;
+            return entry & OutputState_Update;
+        }
+
+        [[nodiscard]] bool outputEnabled() const {
+            return state & OutputState_Output;
+        }
+
+        [[nodiscard]] bool targetState() const {
+            const bool schedule = state & OutputState_Schedule;
+            const bool override = state & OutputState_Override;
+            return schedule != override;
+        }
+    };
+}
+
+TEST_CASE("Every table entry follows the truth tables")
+{
+    REQUIRE(sizeof(OutputState_table) * 2 == OutputState_TableEntryCount);
+
+    for (unsigned index = 0; index < OutputState_TableEntryCount; ++index) {
+        CAPTURE(index);
+
+        const bool override = index & OutputState_Override;
+        const bool prevOutput = index & OutputState_Output;
+        const bool prevSchedule = index & OutputState_Schedule;
+        const bool schedule = index & OutputState_InputSchedule;
+        const bool battery = index & OutputState_InputBattery;
+        const bool force = index & OutputState_InputForce;
+
+        const bool newOverride = calculateOverrideState(schedule, prevSchedule, override);
+        const bool output = calculateOutputState(schedule, battery, newOverride);
+        const bool update = calculateOutputUpdateState(output, prevOutput, force);
+
+        const uint8_t entry = OutputState_tableEntry(index);
+
+        CHECK(static_cast<bool>(entry & OutputState_Override) == newOverride);
+        CHECK(static_cast<bool>(entry & OutputState_Output) == output);
+        CHECK(static_cast<bool>(entry & OutputState_Schedule) == schedule);
+        CHECK(static_cast<bool>(entry & OutputState_Update) == update);
+    }
+}
+
+TEST_CASE("Table-driven controller follows the reference through random sequences")
+{
+    std::mt19937 rng(1234);
+    std::bernoulli_distribution coin(0.5);
+    std::bernoulli_distribution rare(0.1);
+
+    for (int round = 0; round < 100; ++round) {
+        ReferenceController reference;
+        TableController table;
+
+        for (int step = 0; step < 200; ++step) {
+            CAPTURE(round, step);
+
+            // OutputController_toggle()
+            if (rare(rng)) {
+                reference.outputOverride = !reference.outputOverride;
+                table.state ^= OutputState_Override;
+                REQUIRE(table.targetState() == reference.targetState());
+            }
+
+            const bool schedule = coin(rng);
+            const bool battery = rare(rng);
+            const bool force = rare(rng);
+
+            REQUIRE(table.task(schedule, battery, force) == reference.task(schedule, battery, force));
+            REQUIRE(table.outputEnabled() == reference.prevOutputState);
+            REQUIRE(table.targetState() == reference.targetState());
+        }
+    }
+}
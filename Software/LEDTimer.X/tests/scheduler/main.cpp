@@ -0,0 +1,298 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <ScheduleTable.h>
+
+#include <array>
+#include <random>
+#include <vector>
+
+namespace {
+    struct Schedule {
+        int on;
+        int off;
+    };
+
+    struct Transition {
+        bool found;
+        int index;
+        bool on;
+    };
+
+    [[nodiscard]] ScheduleTable build(const std::vector<ScheduleTable_Interval>& intervals) {
+        ScheduleTable table{};
+        ScheduleTable_build(&table, intervals.data(), static_cast<uint8_t>(intervals.size()));
+        return table;
+    }
+
+    // Cases of Research/LedTimerSchedulerPlayground use whole hours
+    [[nodiscard]] Transition nextTransition(const std::vector<Schedule>& schedules, const int hour) {
+        std::vector<ScheduleTable_Interval> intervals;
+        for (const auto& s : schedules) {
+            intervals.push_back({
+                static_cast<Clock_Time>(s.on * 60),
+                static_cast<Clock_Time>(s.off * 60),
+                true
+            });
+        }
+
+        const auto table = build(intervals);
+        const auto* next = ScheduleTable_nextTransition(&table, static_cast<Clock_Time>(hour * 60));
+
+        if (!next) {
+            return { false, -1, false };
+        }
+
+        return { true, next->index, static_cast<bool>(next->on) };
+    }
+
+    [[nodiscard]] bool referenceIsOn(const std::vector<ScheduleTable_Interval>& intervals, const int time) {
+        for (const auto& i : intervals) {
+            if (!i.active) {
+                continue;
+            }
+            if (i.on <= i.off ? (time >= i.on && time < i.off) : (time >= i.on || time < i.off)) {
+                return true;
+            }
+        }
+        return false;
+    }
+}
+
+TEST_CASE("No schedules, no transition")
+{
+    CHECK_FALSE(nextTransition({}, 0).found);
+}
+
+TEST_CASE("One schedule")
+{
+    SECTION("ON transition before the ON time") {
+        const auto t = nextTransition({ { 8, 18 } }, 7);
+        CHECK(t.found);
+        CHECK(t.index == 0);
+        CHECK(t.on);
+    }
+
+    SECTION("ON transition before the ON time with a reversed schedule") {
+        const auto t = nextTransition({ { 18, 8 } }, 17);
+        CHECK(t.found);
+        CHECK(t.index == 0);
+        CHECK(t.on);
+    }
+
+    SECTION("ON transition after the OFF time before midnight") {
+        const auto t = nextTransition({ { 8, 18 } }, 19);
+        CHECK(t.found);
+        CHECK(t.index == 0);
+        CHECK(t.on);
+    }
+
+    SECTION("OFF transition before the OFF time") {
+        const auto t = nextTransition({ { 8, 18 } }, 17);
+        CHECK(t.found);
+        CHECK(t.index == 0);
+        CHECK_FALSE(t.on);
+    }
+
+    SECTION("OFF transition before the OFF time with a reversed schedule") {
+        const auto t = nextTransition({ { 18, 8 } }, 7);
+        CHECK(t.found);
+        CHECK(t.index == 0);
+        CHECK_FALSE(t.on);
+    }
+}
+
+TEST_CASE("Two schedules")
+{
+    const std::vector<Schedule> schedules{ { 8, 12 }, { 14, 19 } };
+
+    const auto [hour, index, on] = GENERATE(table<int, int, bool>({
+        { 7, 0, true },
+        { 11, 0, false },
+        { 13, 1, true },
+        { 18, 1, false },
+        { 20, 0, true }
+    }));
+
+    CAPTURE(hour);
+    const auto t = nextTransition(schedules, hour);
+    CHECK(t.found);
+    CHECK(t.index == index);
+    CHECK(t.on == on);
+}
+
+TEST_CASE("Two schedules, the second one is reversed")
+{
+    const std::vector<Schedule> schedules{ { 8, 12 }, { 14, 6 } };
+
+    const auto [hour, index, on] = GENERATE(table<int, int, bool>({
+        { 7, 0, true },
+        { 11, 0, false },
+        { 13, 1, true },
+        { 23, 1, false },
+        { 5, 1, false }
+    }));
+
+    CAPTURE(hour);
+    const auto t = nextTransition(schedules, hour);
+    CHECK(t.found);
+    CHECK(t.index == index);
+    CHECK(t.on == on);
+}
+
+TEST_CASE("Two overlapping schedules")
+{
+    const std::vector<Schedule> schedules{ { 8, 18 }, { 10, 20 } };
+
+    const auto [hour, index, on] = GENERATE(table<int, int, bool>({
+        { 7, 0, true },
+        { 21, 0, true },
+        { 17, 1, false }
+    }));
+
+    CAPTURE(hour);
+    const auto t = nextTransition(schedules, hour);
+    CHECK(t.found);
+    CHECK(t.index == index);
+    CHECK(t.on == on);
+}
+
+TEST_CASE("Two overlapping schedules covering the whole day")
+{
+    CHECK_FALSE(nextTransition({ { 8, 18 }, { 17, 9 } }, 17).found);
+
+    ScheduleTable table = build({ { 8 * 60, 18 * 60, true }, { 17 * 60, 9 * 60, true } });
+    CHECK(ScheduleTable_isOn(&table, 0));
+    CHECK(ScheduleTable_isOn(&table, 1439));
+}
+
+TEST_CASE("Three overlapping schedules, two merged intervals")
+{
+    SECTION("Second interval is regular") {
+        const std::vector<Schedule> schedules{ { 8, 10 }, { 9, 11 }, { 13, 19 } };
+
+        const auto [hour, index, on] = GENERATE(table<int, int, bool>({
+            { 10, 1, false },
+            { 12, 2, true },
+            { 14, 2, false },
+            { 20, 0, true }
+        }));
+
+        CAPTURE(hour);
+        const auto t = nextTransition(schedules, hour);
+        CHECK(t.found);
+        CHECK(t.index == index);
+        CHECK(t.on == on);
+    }
+
+    SECTION("Second interval is reversed") {
+        const auto [hour, index, on] = GENERATE(table<int, int, bool>({
+            { 20, 2, false },
+            { 1, 2, false }
+        }));
+
+        CAPTURE(hour);
+        const auto t = nextTransition({ { 8, 10 }, { 9, 11 }, { 13, 7 } }, hour);
+        CHECK(t.found);
+        CHECK(t.index == index);
+        CHECK(t.on == on);
+    }
+
+    SECTION("After the second reversed interval") {
+        const auto t = nextTransition({ { 8, 10 }, { 9, 11 }, { 13, 6 } }, 7);
+        CHECK(t.found);
+        CHECK(t.index == 0);
+        CHECK(t.on);
+    }
+}
+
+TEST_CASE("Four overlapping schedules out of order, two merged intervals")
+{
+    const auto t = nextTransition({ { 14, 19 }, { 9, 11 }, { 13, 15 }, { 8, 10 } }, 10);
+    CHECK(t.found);
+    CHECK(t.index == 1);
+    CHECK_FALSE(t.on);
+}
+
+TEST_CASE("Inactive and empty intervals are ignored")
+{
+    ScheduleTable table = build({
+        { 8 * 60, 18 * 60, false },
+        { 9 * 60, 9 * 60, true },
+        { 20 * 60, 21 * 60, true }
+    });
+
+    REQUIRE(table.count == 2);
+    CHECK(table.transitions[0].index == 2);
+    CHECK(table.transitions[1].index == 2);
+    CHECK_FALSE(ScheduleTable_isOn(&table, 10 * 60));
+    CHECK(ScheduleTable_isOn(&table, 20 * 60));
+}
+
+TEST_CASE("Compiled table matches the interval rules at every minute")
+{
+    std::mt19937 rng{ 42 };
+    std::uniform_int_distribution<int> minute{ 0, 1439 };
+    std::uniform_int_distribution<int> coarse{ 0, 23 };
+    std::bernoulli_distribution coin{ 0.5 };
+
+    for (int round = 0; round < 500; ++round) {
+        std::vector<ScheduleTable_Interval> intervals;
+
+        for (int i = 0; i < Config_Settings_IntervalScheduleCount; ++i) {
+            // Whole hours make coinciding switches likely
+            const bool hours = coin(rng);
+            intervals.push_back({
+                static_cast<Clock_Time>(hours ? coarse(rng) * 60 : minute(rng)),
+                static_cast<Clock_Time>(hours ? coarse(rng) * 60 : minute(rng)),
+                coin(rng) || coin(rng)
+            });
+        }
+
+        const auto table = build(intervals);
+
+        REQUIRE(table.count % 2 == 0);
+
+        // Reference state of every minute and the next change after it
+        std::array<bool, 1440> state{};
+        for (int time = 0; time < 1440; ++time) {
+            state[time] = referenceIsOn(intervals, time);
+        }
+
+        std::array<int, 1440> nextChange{};
+        int change = -1;
+        for (int time = 2 * 1440 - 1; time >= 0; --time) {
+            const int t = time % 1440;
+            const int following = (t + 1) % 1440;
+            if (state[following] != state[t]) {
+                change = following;
+            }
+            if (time < 1440) {
+                nextChange[t] = change;
+            }
+        }
+
+        for (int time = 0; time < 1440; ++time) {
+            CAPTURE(round, time);
+
+            const bool on = state[time];
+            const int next = nextChange[time];
+            REQUIRE(ScheduleTable_isOn(&table, static_cast<Clock_Time>(time)) == on);
+
+            const auto* transition = ScheduleTable_nextTransition(&table, static_cast<Clock_Time>(time));
+
+            if (next < 0) {
+                REQUIRE(transition == nullptr);
+                continue;
+            }
+
+            REQUIRE(transition != nullptr);
+            REQUIRE(transition->time == next);
+            REQUIRE(static_cast<bool>(transition->on) == !on);
+
+            // The transition belongs to an interval switching at that time
+            const auto& interval = intervals[transition->index];
+            REQUIRE(interval.active);
+            REQUIRE((transition->on ? interval.on : interval.off) == next);
+        }
+    }
+}
@@ -0,0 +1,85 @@
+#include "Screens.h"
+
+#include "Clock.h"
+#include "MainScreen.h"
+#include "OutputController.h"
+#include "Settings.h"
+#include "Settings_MenuScreen.h"
+#include "SettingsScreen_DST.h"
+#include "SettingsScreen_Date.h"
+#include "SettingsScreen_DisplayBrightness.h"
+#include "SettingsScreen_LEDBrightness.h"
+#include "SettingsScreen_Scheduler.h"
+#include "SettingsScreen_SegmentScheduler.h"
+#include "SettingsScreen_Time.h"
+#include "SettingsScreen_TimeZone.h"
+
+static void initMainScreenInterval(void)
+{
+    Settings_data.scheduler.type = Settings_SchedulerType_Interval;
+}
+
+static void initMainScreenSegment(void)
+{
+    Settings_data.scheduler.type = Settings_SchedulerType_Segment;
+}
+
+static void initScheduler(void)
+{
+    SettingsScreen_Scheduler_init(&Settings_data.scheduler);
+}
+
+static void initSegmentScheduler(void)
+{
+    SettingsScreen_SegmentScheduler_init(&Settings_data.scheduler);
+}
+
+static void initLEDBrightness(void)
+{
+    SettingsScreen_LEDBrightness_init(&Settings_data.output);
+}
+
+static void initDisplayBrightness(void)
+{
+    SettingsScreen_DisplayBrightness_init(&Settings_data.display);
+}
+
+static void initTimeZone(void)
+{
+    SettingsScreen_TimeZone_init(&Settings_data.time);
+}
+
+static void initDST(void)
+{
+    SettingsScreen_DST_init(&Settings_data.dst);
+}
+
+const Screens_Screen Screens_screens[] = {
+    { "MainScreen (interval)", initMainScreenInterval, MainScreen_update },
+    { "MainScreen (segment)", initMainScreenSegment, MainScreen_update },
+    { "Settings_MenuScreen", Settings_MenuScreen_init, Settings_MenuScreen_update },
+    { "SettingsScreen_Scheduler", initScheduler, SettingsScreen_Scheduler_update },
+    { "SettingsScreen_SegmentScheduler", initSegmentScheduler, SettingsScreen_SegmentScheduler_update },
+    { "SettingsScreen_LEDBrightness", initLEDBrightness, SettingsScreen_LEDBrightness_update },
+    { "SettingsScreen_DisplayBrightness", initDisplayBrightness, SettingsScreen_DisplayBrightness_update },
+    { "SettingsScreen_Date", SettingsScreen_Date_init, SettingsScreen_Date_update },
+    { "SettingsScreen_Time", SettingsScreen_Time_init, SettingsScreen_Time_update },
+    { "SettingsScreen_TimeZone", initTimeZone, SettingsScreen_TimeZone_update },
+    { "SettingsScreen_DST", initDST, SettingsScreen_DST_update }
+};
+
+const size_t Screens_count = sizeof(Screens_screens) / sizeof(Screens_screens[0]);
+
+void Screens_resetState(void)
+{
+    Settings_loadDefaults();
+    OutputController_invalidateSchedule();
+
+    Clock_setDate(56, 5, 14);
+    Clock_setTime(13, 37);
+}
+
+void Screens_setTime(const uint8_t hour, const uint8_t minute)
+{
+    Clock_setTime(hour, minute);
+}
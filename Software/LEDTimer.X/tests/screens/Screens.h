@@ -0,0 +1,38 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Screens of the UI with their settings bound like UI.c does it.
+ * Written in C since the settings structs are nested in SettingsData
+ * which has a different scope in C++.
+ */
+typedef struct
+{
+    const char* name;
+    void (*init)(void);
+    void (*update)(bool redraw);
+} Screens_Screen;
+
+extern const Screens_Screen Screens_screens[];
+extern const size_t Screens_count;
+
+/**
+ * Loads the default settings and sets a fixed date and time.
+ */
+void Screens_resetState(void);
+
+/**
+ * Sets the time of the clock.
+ */
+void Screens_setTime(uint8_t hour, uint8_t minute);
+
+#ifdef __cplusplus
+}
+#endif
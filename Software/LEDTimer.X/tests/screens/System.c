@@ -0,0 +1,16 @@
+/*
+ * System functions used by the screens. The real module depends on the ADC,
+ * the FVR and the power sensing input which are not simulated.
+ */
+
+#include "System.h"
+
+bool System_isRunningFromBackupBattery()
+{
+    return false;
+}
+
+uint8_t System_getBatteryLevel()
+{
+    return 10;
+}
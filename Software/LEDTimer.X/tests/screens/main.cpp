@@ -0,0 +1,241 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <SSD1306.h>
+#include <xc.h>
+
+#include "Screens.h"
+
+#include "../mock/SSD1306Emulator.hpp"
+
+#include <cstdio>
+#include <functional>
+#include <string>
+
+/*
+ * I2C cost of the screen updates
+ *
+ * Every screen is drawn on the emulated display with a full redraw and
+ * with a periodic update (like UI_task() does). The bus traffic must stay
+ * within the budget of the screen. If a change reduces the cost, lower
+ * the budget so the improvement can't be lost unnoticed.
+ */
+
+namespace {
+    struct Cost {
+        size_t bytes;
+        size_t transfers;
+    };
+
+    struct Budget {
+        const char* name;
+        Cost redraw;
+        Cost update;
+    };
+
+    // Budgets: bytes on the wire and number of I2C transfers
+    const Budget Budgets[] = {
+        { "MainScreen (interval)",               { 866, 34 }, { 0, 0 } },
+        { "MainScreen (segment)",                { 1143, 46 }, { 0, 0 } },
+        { "Settings_MenuScreen",                 { 1074, 62 }, { 0, 0 } },
+        { "SettingsScreen_Scheduler",            { 2618, 84 }, { 87, 10 } },
+        { "SettingsScreen_SegmentScheduler",     { 756, 38 }, { 348, 10 } },
+        { "SettingsScreen_LEDBrightness",        { 344, 22 }, { 0, 0 } },
+        { "SettingsScreen_DisplayBrightness",    { 272, 22 }, { 0, 0 } },
+        { "SettingsScreen_Date",                 { 654, 40 }, { 0, 0 } },
+        { "SettingsScreen_Time",                 { 443, 38 }, { 0, 0 } },
+        { "SettingsScreen_TimeZone",             { 467, 22 }, { 304, 8 } },
+        { "SettingsScreen_DST",                  { 1004, 48 }, { 262, 20 } },
+    };
+
+    [[nodiscard]] const Budget* findBudget(const std::string& name) {
+        for (const auto& budget : Budgets) {
+            if (name == budget.name) {
+                return &budget;
+            }
+        }
+        return nullptr;
+    }
+
+    mock::SSD1306Emulator display;
+
+    void resetDevice() {
+        Mock_reset(SSD1306_handleInterrupt);
+        display.reset();
+
+        SSD1306_init();
+        SSD1306_flush();
+        display.processRecordedEvents();
+
+        Screens_resetState();
+    }
+
+    [[nodiscard]] mock::SSD1306Emulator::Statistics measure(const std::function<void()>& draw) {
+        display.resetStatistics();
+
+        draw();
+        SSD1306_flush();
+        display.processRecordedEvents();
+
+        return display.statistics();
+    }
+
+    void report(const char* name, const char* kind, const mock::SSD1306Emulator::Statistics& s) {
+        std::printf(
+            "%-34s %-7s %5zu bytes %4zu START %4zu STOP  %8.1f us @100k %7.1f us @400k %7.1f us @1M\n",
+            name,
+            kind,
+            s.bytes,
+            s.starts,
+            s.stops,
+            s.busTimeUs(100000),
+            s.busTimeUs(400000),
+            s.busTimeUs(1000000)
+        );
+    }
+
+    void checkBudget(const mock::SSD1306Emulator::Statistics& s, const Cost& budget) {
+        CHECK(s.bytes <= budget.bytes);
+        CHECK(s.starts <= budget.transfers);
+        CHECK(s.starts == s.stops);
+    }
+
+    [[nodiscard]] bool anyPixelLit() {
+        for (uint8_t page = 0; page < mock::SSD1306Emulator::Pages; ++page) {
+            for (uint8_t column = 0; column < mock::SSD1306Emulator::Width; ++column) {
+                if (display.gddram(page, column) != 0) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+}
+
+TEST_CASE("Screen updates stay within the I2C budget", "[screens][benchmark]") {
+    for (size_t i = 0; i < Screens_count; ++i) {
+        const auto& screen = Screens_screens[i];
+        INFO(screen.name);
+
+        const auto* budget = findBudget(screen.name);
+        REQUIRE(budget != nullptr);
+
+        resetDevice();
+        screen.init();
+
+        const auto redraw = measure([&] { screen.update(true); });
+        report(screen.name, "redraw", redraw);
+
+        REQUIRE(anyPixelLit());
+
+        const auto update = measure([&] { screen.update(false); });
+        report(screen.name, "update", update);
+
+        INFO(display.render());
+        REQUIRE(display.errors().empty());
+
+        checkBudget(redraw, budget->redraw);
+        checkBudget(update, budget->update);
+    }
+}
+
+TEST_CASE("Changed widgets of the main screen are redrawn", "[screens][widget]") {
+    for (size_t i = 0; i < Screens_count; ++i) {
+        const auto& screen = Screens_screens[i];
+
+        if (std::string{ screen.name }.rfind("MainScreen", 0) != 0) {
+            continue;
+        }
+
+        INFO(screen.name);
+
+        resetDevice();
+        screen.init();
+        screen.update(true);
+        SSD1306_flush();
+        display.processRecordedEvents();
+
+        // Move to a different schedule segment and minute
+        Screens_setTime(14, 2);
+
+        const auto update = measure([&] { screen.update(false); });
+        CHECK(update.bytes > 0);
+
+        const auto idle = measure([&] { screen.update(false); });
+        CHECK(idle.bytes == 0);
+
+        const auto updated = display.render();
+
+        // The result must be the same as a complete redraw
+        SSD1306_clear();
+        screen.update(true);
+        SSD1306_flush();
+        display.processRecordedEvents();
+
+        REQUIRE(display.errors().empty());
+        REQUIRE(display.render() == updated);
+    }
+}
+
+TEST_CASE("Emulator follows the addressing modes", "[screens][emulator]") {
+    resetDevice();
+
+    REQUIRE(display.addressingMode() == mock::SSD1306Emulator::AddressingMode::Horizontal);
+    REQUIRE_FALSE(anyPixelLit());
+
+    static const uint8_t Data[] = { 0x81, 0x42, 0x24 };
+
+    // Page addressing wraps to the start column within the page
+    SSD1306_setPosition(3, 126);
+    SSD1306_sendData(Data, sizeof(Data));
+
+    // Horizontal addressing continues on the next page
+    static const uint8_t Horizontal[] = {
+        SSD1306_CMD_MEMORYMODE, SSD1306_MEM_MODE_HORIZONTAL_ADDRESSING,
+        SSD1306_CMD_COLUMNADDR, 10, 11,
+        SSD1306_CMD_PAGEADDR, 6, 7
+    };
+    SSD1306_sendCommands(Horizontal, sizeof(Horizontal));
+    SSD1306_sendData(Data, sizeof(Data));
+
+    SSD1306_flush();
+    display.processRecordedEvents();
+
+    REQUIRE(display.errors().empty());
+
+    CHECK(display.gddram(3, 126) == 0x24);
+    CHECK(display.gddram(3, 127) == 0x42);
+    CHECK(display.gddram(3, 0) == 0);
+    CHECK(display.gddram(4, 126) == 0);
+
+    CHECK(display.gddram(6, 10) == 0x81);
+    CHECK(display.gddram(6, 11) == 0x42);
+    CHECK(display.gddram(7, 10) == 0x24);
+    CHECK(display.pixel(10, 7 * 8 + 2));
+}
+
+TEST_CASE("Emulator tracks the scroll setup", "[screens][emulator]") {
+    resetDevice();
+
+    SSD1306_scroll(SSD1306_SCROLL_LEFT, 2, 5);
+    SSD1306_flush();
+    display.processRecordedEvents();
+
+    REQUIRE(display.errors().empty());
+    REQUIRE(display.scroll().active);
+    CHECK(display.scroll().command == SSD1306_CMD_LEFT_HORIZONTAL_SCROLL);
+    CHECK(display.scroll().startPage == 2);
+    CHECK(display.scroll().endPage == 5);
+
+    // Writing the GDDRAM while scrolling corrupts the display content
+    SSD1306_fillArea(0, 0, 8, 1, SSD1306_COLOR_WHITE);
+    SSD1306_flush();
+    display.processRecordedEvents();
+
+    REQUIRE_FALSE(display.errors().empty());
+
+    SSD1306_scroll(SSD1306_SCROLL_STOP, 0, 0);
+    SSD1306_flush();
+    display.processRecordedEvents();
+
+    REQUIRE_FALSE(display.scroll().active);
+}
@@ -0,0 +1,507 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <xc.h>
+
+extern "C" {
+#include <Config.h>
+#include <NVM.h>
+#include <Settings.h>
+}
+
+#include <cstring>
+#include <vector>
+
+namespace {
+    // 4 ms byte write in 1 ms ticks
+    constexpr uint16_t WriteTicks = 4;
+
+    // Timer1 counts per tick (1/32768 s)
+    constexpr uint16_t TimerCountsPerTick = 33;
+
+    void isr() {
+        if (PIE2bits.NVMIE && PIR2bits.NVMIF) {
+            PIR2bits.NVMIF = 0;
+            NVM_handleInterrupt();
+        }
+    }
+
+    void eraseEEPROM() {
+        std::memset(Mock_eeprom, 0xFF, sizeof(Mock_eeprom));
+    }
+
+    void powerUp() {
+        Mock_NVM_reset(isr, WriteTicks);
+        Mock_tmr1Value = 0;
+        Settings_init();
+    }
+
+    void tick() {
+        Mock_tmr1Value += TimerCountsPerTick;
+        Mock_NVM_tick();
+    }
+
+    size_t waitUntilSaved() {
+        size_t ticks = 0;
+        while (Settings_isSaving()) {
+            REQUIRE(++ticks < 10000);
+            tick();
+        }
+        return ticks;
+    }
+
+    void save() {
+        Settings_save();
+        waitUntilSaved();
+    }
+
+    void resetStatistics() {
+        NVM_statistics = NVM_Statistics{};
+    }
+
+    [[nodiscard]] uint8_t slotAddress(const unsigned slot) {
+        return static_cast<uint8_t>(Config_Settings_DataBaseAddress + slot * sizeof(SettingsData));
+    }
+
+    [[nodiscard]] std::vector<uint8_t> storedSlot(const unsigned slot) {
+        const auto* begin = Mock_eeprom + slotAddress(slot);
+        return { begin, begin + sizeof(SettingsData) };
+    }
+
+    [[nodiscard]] std::vector<uint8_t> storedSlots() {
+        const auto* begin = Mock_eeprom + Config_Settings_DataBaseAddress;
+        return { begin, begin + 2 * sizeof(SettingsData) };
+    }
+
+    [[nodiscard]] std::vector<uint8_t> bytesOf(const SettingsData& data) {
+        const auto* begin = reinterpret_cast<const uint8_t*>(&data);
+        return { begin, begin + sizeof(SettingsData) };
+    }
+
+    [[nodiscard]] size_t differentBytes(const std::vector<uint8_t>& a, const std::vector<uint8_t>& b) {
+        size_t count = 0;
+        for (size_t i = 0; i < a.size(); ++i) {
+            count += a[i] != b[i] ? 1 : 0;
+        }
+        return count;
+    }
+
+    [[nodiscard]] bool loadedSettingsEqual(const SettingsData& expected) {
+        return std::memcmp(&Settings_data, &expected, sizeof(SettingsData)) == 0;
+    }
+
+    [[nodiscard]] IntervalScheduler intervalOf(const SettingsData& data, const size_t index) {
+        IntervalScheduler interval;
+        Settings_unpackInterval(&data.scheduler.intervals[index], &interval);
+        return interval;
+    }
+
+    template <typename Change>
+    void changeInterval(SettingsData& data, const size_t index, Change change) {
+        auto interval = intervalOf(data, index);
+        change(interval);
+        Settings_packInterval(&data.scheduler.intervals[index], &interval);
+    }
+
+    [[nodiscard]] bool switchesEqual(const IntervalSwitch& a, const IntervalSwitch& b) {
+        if (a.type != b.type) {
+            return false;
+        }
+
+        if (a.type == Settings_IntervalSwitchType_Time) {
+            return a.timeHour == b.timeHour && a.timeMinute == b.timeMinute;
+        }
+
+        return a.sunOffset == b.sunOffset;
+    }
+}
+
+TEST_CASE("Both slots fit in the data EEPROM")
+{
+    CHECK(Config_Settings_DataBaseAddress + 2 * sizeof(SettingsData) <= sizeof(Mock_eeprom));
+}
+
+TEST_CASE("Intervals are packed into 3 bytes")
+{
+    CHECK(sizeof(Settings_PackedInterval) == 3);
+
+    SECTION("All zeros is an inactive 00:00-00:00 interval") {
+        const Settings_PackedInterval packed{};
+        IntervalScheduler interval;
+        Settings_unpackInterval(&packed, &interval);
+
+        CHECK(interval.active == 0);
+        CHECK(interval.onSwitch.type == Settings_IntervalSwitchType_Time);
+        CHECK(interval.onSwitch.timeHour == 0);
+        CHECK(interval.onSwitch.timeMinute == 0);
+        CHECK(interval.offSwitch.type == Settings_IntervalSwitchType_Time);
+    }
+
+    SECTION("Every switch is decoded back") {
+        std::vector<IntervalSwitch> switches;
+
+        for (uint8_t hour = 0; hour < 24; ++hour) {
+            for (uint8_t minute = 0; minute < 60; ++minute) {
+                switches.push_back({ Settings_IntervalSwitchType_Time, 0, 0, hour, minute });
+            }
+        }
+
+        for (int offset = -128; offset <= 127; ++offset) {
+            switches.push_back({ Settings_IntervalSwitchType_Sunrise, 0, static_cast<int8_t>(offset), 0, 0 });
+            switches.push_back({ Settings_IntervaSwitchType_Sunset, 0, static_cast<int8_t>(offset), 0, 0 });
+        }
+
+        // The on switch is paired with a switch from the other end of the list
+        for (size_t i = 0; i < switches.size(); ++i) {
+            IntervalScheduler interval{};
+            interval.active = i % 2;
+            interval.onSwitch = switches[i];
+            interval.offSwitch = switches[switches.size() - 1 - i];
+
+            Settings_PackedInterval packed;
+            Settings_packInterval(&packed, &interval);
+
+            IntervalScheduler unpacked;
+            Settings_unpackInterval(&packed, &unpacked);
+
+            INFO(i);
+            REQUIRE(unpacked.active == interval.active);
+            REQUIRE(switchesEqual(unpacked.onSwitch, interval.onSwitch));
+            REQUIRE(switchesEqual(unpacked.offSwitch, interval.offSwitch));
+        }
+    }
+}
+
+TEST_CASE("Saves alternate between the slots")
+{
+    eraseEEPROM();
+    powerUp();
+    Settings_load();
+
+    save();
+    CHECK(storedSlot(1) == bytesOf(Settings_data));
+    CHECK(Settings_data.sequence == 1);
+
+    const auto first = Settings_data;
+
+    Settings_data.output.brightness = 10;
+    save();
+    CHECK(storedSlot(0) == bytesOf(Settings_data));
+    CHECK(storedSlot(1) == bytesOf(first));
+    CHECK(Settings_data.sequence == 2);
+
+    const auto second = Settings_data;
+
+    Settings_data.output.brightness = 20;
+    save();
+    CHECK(storedSlot(1) == bytesOf(Settings_data));
+    CHECK(storedSlot(0) == bytesOf(second));
+    CHECK(Settings_data.sequence == 3);
+
+    const auto third = Settings_data;
+
+    powerUp();
+    Settings_load();
+    CHECK(loadedSettingsEqual(third));
+
+    // The next save after a restart continues with the other slot
+    Settings_data.output.brightness = 30;
+    save();
+    CHECK(storedSlot(0) == bytesOf(Settings_data));
+    CHECK(storedSlot(1) == bytesOf(third));
+    CHECK(Mock_NVM_errors() == 0);
+}
+
+TEST_CASE("Only the changed bytes are written")
+{
+    eraseEEPROM();
+    powerUp();
+    Settings_load();
+
+    // Fill both slots
+    save();
+    save();
+
+    const auto before = storedSlots();
+    resetStatistics();
+
+    SECTION("Saving unchanged settings writes only the sequence and the checksum") {
+        save();
+
+        const auto changed = differentBytes(before, storedSlots());
+
+        CHECK(changed >= 1);
+        CHECK(changed <= 2);
+        CHECK(NVM_statistics.bytesWritten == changed);
+        CHECK(NVM_statistics.bytesSkipped == sizeof(SettingsData) - changed);
+    }
+
+    SECTION("Changing the brightness writes the value, the sequence and the checksum") {
+        Settings_data.output.brightness = 10;
+        Settings_save();
+
+        CHECK(Settings_isSaving());
+
+        const auto ticks = waitUntilSaved();
+        const auto changed = differentBytes(before, storedSlots());
+
+        CHECK(changed >= 2);
+        CHECK(changed <= 3);
+        CHECK(ticks == changed * WriteTicks);
+        CHECK(NVM_statistics.bytesWritten == changed);
+        CHECK(NVM_statistics.bytesSkipped == sizeof(SettingsData) - changed);
+        CHECK(NVM_statistics.writeTime == changed * WriteTicks * TimerCountsPerTick);
+    }
+
+    SECTION("Saved settings are loaded back") {
+        Settings_data.output.brightness = 10;
+        changeInterval(Settings_data, 2, [](auto& interval) {
+            interval.active = 1;
+            interval.onSwitch.timeHour = 7;
+        });
+        save();
+
+        const auto saved = Settings_data;
+        Settings_loadDefaults();
+        Settings_load();
+
+        CHECK(loadedSettingsEqual(saved));
+    }
+
+    CHECK(Mock_NVM_errors() == 0);
+}
+
+TEST_CASE("Settings are written in full to an erased EEPROM")
+{
+    eraseEEPROM();
+    powerUp();
+    Settings_load();
+
+    save();
+
+    std::vector<uint8_t> erased(sizeof(SettingsData), 0xFF);
+    const auto changed = differentBytes(erased, storedSlot(1));
+
+    CHECK(NVM_statistics.bytesWritten == changed);
+    CHECK(NVM_statistics.bytesWritten + NVM_statistics.bytesSkipped == sizeof(SettingsData));
+    CHECK(storedSlot(1) == bytesOf(Settings_data));
+    CHECK(storedSlot(0) == erased);
+    CHECK(Mock_NVM_errors() == 0);
+}
+
+TEST_CASE("Bytes are written in ascending order with the checksum last")
+{
+    eraseEEPROM();
+    powerUp();
+    Settings_load();
+
+    save();
+
+    const auto count = Mock_NVM_writeCount();
+    const auto* addresses = Mock_NVM_writtenAddresses();
+
+    REQUIRE(count > 0);
+
+    for (size_t i = 1; i < count; ++i) {
+        CHECK(addresses[i - 1] < addresses[i]);
+    }
+
+    CHECK(addresses[count - 1] == slotAddress(1) + sizeof(SettingsData) - 1);
+}
+
+TEST_CASE("The newest valid slot is loaded")
+{
+    eraseEEPROM();
+    powerUp();
+    Settings_load();
+
+    Settings_data.output.brightness = 10;
+    save();
+    const auto older = Settings_data;
+
+    Settings_data.output.brightness = 20;
+    save();
+    const auto newer = Settings_data;
+
+    SECTION("Both slots are valid") {
+        Settings_load();
+        CHECK(loadedSettingsEqual(newer));
+    }
+
+    SECTION("The newer slot is corrupted") {
+        Mock_eeprom[slotAddress(0) + 3] ^= 0x10;
+        Settings_load();
+        CHECK(loadedSettingsEqual(older));
+    }
+
+    SECTION("The older slot is corrupted") {
+        Mock_eeprom[slotAddress(1) + 3] ^= 0x10;
+        Settings_load();
+        CHECK(loadedSettingsEqual(newer));
+    }
+
+    SECTION("Both slots are corrupted") {
+        Mock_eeprom[slotAddress(0) + 3] ^= 0x10;
+        Mock_eeprom[slotAddress(1) + 3] ^= 0x10;
+        Settings_load();
+
+        SettingsData defaults;
+        SettingsData_initWithDefaults(&defaults);
+        CHECK(loadedSettingsEqual(defaults));
+    }
+}
+
+TEST_CASE("The sequence number wraps around")
+{
+    eraseEEPROM();
+    powerUp();
+    Settings_load();
+
+    for (unsigned i = 0; i < 300; ++i) {
+        Settings_data.output.brightness = static_cast<uint8_t>(i);
+        save();
+
+        const auto saved = Settings_data;
+
+        powerUp();
+        Settings_load();
+        REQUIRE(loadedSettingsEqual(saved));
+    }
+}
+
+TEST_CASE("Saving the defaults makes them the newest record")
+{
+    eraseEEPROM();
+    powerUp();
+    Settings_load();
+
+    Settings_data.output.brightness = 10;
+    save();
+    save();
+    save();
+
+    Settings_loadDefaults();
+    save();
+    const auto defaults = Settings_data;
+
+    Settings_load();
+    CHECK(loadedSettingsEqual(defaults));
+}
+
+TEST_CASE("Saving during a write stores the latest settings")
+{
+    eraseEEPROM();
+    powerUp();
+    Settings_load();
+
+    save();
+    const auto first = Settings_data;
+
+    Settings_data.output.brightness = 10;
+    Settings_data.display.brightness = 0;
+    Settings_save();
+
+    // Change the settings in the middle of the write
+    tick();
+    tick();
+    REQUIRE(Settings_isSaving());
+
+    Settings_data.output.brightness = 20;
+    changeInterval(Settings_data, 0, [](auto& interval) { interval.offSwitch.timeMinute = 30; });
+    Settings_save();
+    waitUntilSaved();
+
+    // The slot of the interrupted write is reused
+    CHECK(storedSlot(0) == bytesOf(Settings_data));
+    CHECK(storedSlot(1) == bytesOf(first));
+
+    Settings_loadDefaults();
+    Settings_load();
+
+    CHECK(Settings_data.output.brightness == 20);
+    CHECK(intervalOf(Settings_data, 0).offSwitch.timeMinute == 30);
+    CHECK(Mock_NVM_errors() == 0);
+}
+
+TEST_CASE("Changing the settings during a write doesn't affect the stored copy")
+{
+    eraseEEPROM();
+    powerUp();
+    Settings_load();
+
+    Settings_data.output.brightness = 10;
+    changeInterval(Settings_data, 1, [](auto& interval) { interval.onSwitch.timeHour = 6; });
+    Settings_save();
+
+    const auto saved = Settings_data;
+
+    tick();
+    Settings_data.output.brightness = 99;
+    changeInterval(Settings_data, 1, [](auto& interval) { interval.onSwitch.timeHour = 23; });
+    waitUntilSaved();
+
+    CHECK(storedSlot(1) == bytesOf(saved));
+}
+
+TEST_CASE("Power loss during a write keeps the old or the new version")
+{
+    eraseEEPROM();
+    powerUp();
+    Settings_load();
+
+    Settings_data.output.brightness = 50;
+    changeInterval(Settings_data, 0, [](auto& interval) { interval.active = 1; });
+    save();
+    save();
+
+    const auto oldVersion = Settings_data;
+    const auto oldEEPROM = storedSlots();
+
+    auto newVersion = oldVersion;
+    newVersion.output.brightness = 60;
+    newVersion.display.brightness = 0;
+    changeInterval(newVersion, 0, [](auto& interval) { interval.onSwitch.timeHour = 5; });
+    changeInterval(newVersion, 3, [](auto& interval) { interval.active = 1; });
+    newVersion.time.timeZoneOffsetHalfHours = -2;
+
+    // Write the new version once to find out how long it takes
+    Settings_data = newVersion;
+    Settings_save();
+    const auto totalTicks = waitUntilSaved();
+    newVersion = Settings_data;
+
+    size_t oldLoaded = 0;
+    size_t newLoaded = 0;
+
+    for (size_t cut = 0; cut <= totalTicks; ++cut) {
+        std::memcpy(Mock_eeprom + Config_Settings_DataBaseAddress, oldEEPROM.data(), oldEEPROM.size());
+        powerUp();
+        Settings_load();
+        REQUIRE(loadedSettingsEqual(oldVersion));
+
+        Settings_data = newVersion;
+        Settings_save();
+
+        for (size_t i = 0; i < cut; ++i) {
+            tick();
+        }
+
+        Mock_NVM_powerLoss();
+        powerUp();
+
+        Settings_loadDefaults();
+        Settings_load();
+
+        if (loadedSettingsEqual(oldVersion)) {
+            ++oldLoaded;
+        } else {
+            CHECK(loadedSettingsEqual(newVersion));
+            ++newLoaded;
+        }
+
+        CHECK(Mock_NVM_errors() == 0);
+    }
+
+    CHECK(oldLoaded > 0);
+    CHECK(newLoaded > 0);
+    CHECK(oldLoaded + newLoaded == totalTicks + 1);
+}
@@ -0,0 +1,224 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <SSD1306.h>
+#include <xc.h>
+
+#include <cstdint>
+#include <initializer_list>
+#include <vector>
+
+namespace {
+    constexpr uint16_t Address = 0x3C << 1;
+    constexpr uint8_t CommandControl = 0x00;
+    constexpr uint8_t DataControl = 0x40;
+
+    using Events = std::vector<uint16_t>;
+
+    void append(Events& events, const uint8_t control, const std::vector<uint8_t>& payload) {
+        events.push_back(Mock_I2C_Start);
+        events.push_back(Address);
+        events.push_back(control);
+        events.insert(events.end(), payload.begin(), payload.end());
+        events.push_back(Mock_I2C_Stop);
+    }
+
+    [[nodiscard]] Events transfer(const uint8_t control, const std::vector<uint8_t>& payload) {
+        Events events;
+        append(events, control, payload);
+        return events;
+    }
+
+    [[nodiscard]] Events recordedEvents() {
+        const auto* events = Mock_SSP1_events();
+        return Events(events, events + Mock_SSP1_eventCount());
+    }
+
+    // Brings the driver into a known state (horizontal addressing, empty queue)
+    void resetDisplay() {
+        Mock_reset(SSD1306_handleInterrupt);
+        SSD1306_clear();
+        SSD1306_flush();
+        Mock_SSP1_clearEvents();
+    }
+}
+
+TEST_CASE("Transfers are sent from the interrupt", "[ssd1306]") {
+    resetDisplay();
+
+    SSD1306_sendCommand(SSD1306_CMD_DISPLAYON);
+
+    REQUIRE(SSD1306_isBusy());
+    REQUIRE(Mock_SSP1_eventCount() == 0);
+
+    SSD1306_flush();
+
+    REQUIRE_FALSE(SSD1306_isBusy());
+    REQUIRE(recordedEvents() == transfer(CommandControl, { SSD1306_CMD_DISPLAYON }));
+}
+
+TEST_CASE("Command sequence is sent in one transfer", "[ssd1306]") {
+    resetDisplay();
+
+    SSD1306_setColumnAddress(10, 200);
+    SSD1306_flush();
+
+    REQUIRE(recordedEvents() == transfer(CommandControl, { SSD1306_CMD_COLUMNADDR, 10, 200 & 0x7F }));
+}
+
+TEST_CASE("Addressing mode is set only once", "[ssd1306]") {
+    resetDisplay();
+
+    SSD1306_setPosition(3, 0x25);
+    SSD1306_setPosition(7, 0x7F);
+    SSD1306_flush();
+
+    Events expected;
+    append(expected, CommandControl, {
+        SSD1306_CMD_MEMORYMODE, SSD1306_MEM_MODE_PAGE_ADDRESSING,
+        SSD1306_CMD_PAGESTARTADDR | 3, SSD1306_CMD_SETLOWCOLUMN | 0x5, SSD1306_CMD_SETHIGHCOLUMN | 0x2
+    });
+    append(expected, CommandControl, {
+        SSD1306_CMD_PAGESTARTADDR | 7, SSD1306_CMD_SETLOWCOLUMN | 0xF, SSD1306_CMD_SETHIGHCOLUMN | 0x7
+    });
+
+    REQUIRE(recordedEvents() == expected);
+}
+
+TEST_CASE("Data is transformed before sending", "[ssd1306]") {
+    resetDisplay();
+
+    static const uint8_t Data[] = { 0x01, 0x80, 0x0F };
+
+    SSD1306_sendData2(Data, sizeof(Data), SSD1306_SEND_FLIPY | SSD1306_SEND_INVERT);
+    SSD1306_sendData2(Data, sizeof(Data), SSD1306_SEND_FLIPX | SSD1306_SEND_BITSHIFT(1));
+    SSD1306_flush();
+
+    Events expected;
+    append(expected, DataControl, { 0xF0, 0x7F, 0xFE });
+    append(expected, DataControl, { 0x00, 0x02, 0xE0 });
+
+    REQUIRE(recordedEvents() == expected);
+}
+
+TEST_CASE("Queued transfers keep their order", "[ssd1306]") {
+    resetDisplay();
+
+    static const uint8_t Data[] = { 1, 2, 3, 4, 5 };
+
+    SSD1306_sendCommand(SSD1306_CMD_DISPLAYOFF);
+    SSD1306_sendData(Data, sizeof(Data));
+    SSD1306_setContrast(0x42);
+    SSD1306_sendData(Data, 0);
+    SSD1306_sendCommand(SSD1306_CMD_DISPLAYON);
+    SSD1306_flush();
+
+    Events expected;
+    append(expected, CommandControl, { SSD1306_CMD_DISPLAYOFF });
+    append(expected, DataControl, { 1, 2, 3, 4, 5 });
+    append(expected, CommandControl, { SSD1306_CMD_SETCONTRAST, 0x42 });
+    append(expected, DataControl, {});
+    append(expected, CommandControl, { SSD1306_CMD_DISPLAYON });
+
+    REQUIRE(recordedEvents() == expected);
+}
+
+TEST_CASE("Transfers longer than the queue are sent completely", "[ssd1306]") {
+    Mock_reset(SSD1306_handleInterrupt);
+
+    SSD1306_clear();
+    SSD1306_flush();
+
+    Events expected;
+    append(expected, CommandControl, {
+        SSD1306_CMD_MEMORYMODE, SSD1306_MEM_MODE_HORIZONTAL_ADDRESSING,
+        SSD1306_CMD_COLUMNADDR, 0, SSD1306_LCDWIDTH - 1,
+        SSD1306_CMD_PAGEADDR, 0, SSD1306_PAGE_COUNT - 1
+    });
+    for (auto page = 0u; page < SSD1306_PAGE_COUNT; ++page) {
+        append(expected, DataControl, std::vector<uint8_t>(SSD1306_LCDWIDTH, 0));
+    }
+
+    REQUIRE(recordedEvents() == expected);
+}
+
+TEST_CASE("Area fill is clipped to the screen", "[ssd1306]") {
+    resetDisplay();
+
+    SSD1306_fillAreaPattern(120, 6, 8, 3, 0x55);
+    SSD1306_fillArea(121, 0, 8, 1, SSD1306_COLOR_WHITE);
+    SSD1306_flush();
+
+    Events expected;
+    append(expected, CommandControl, {
+        SSD1306_CMD_MEMORYMODE, SSD1306_MEM_MODE_PAGE_ADDRESSING,
+        SSD1306_CMD_PAGESTARTADDR | 6, SSD1306_CMD_SETLOWCOLUMN | 0x8, SSD1306_CMD_SETHIGHCOLUMN | 0x7
+    });
+    append(expected, DataControl, std::vector<uint8_t>(8, 0x55));
+    append(expected, CommandControl, {
+        SSD1306_CMD_PAGESTARTADDR | 7, SSD1306_CMD_SETLOWCOLUMN | 0x8, SSD1306_CMD_SETHIGHCOLUMN | 0x7
+    });
+    append(expected, DataControl, std::vector<uint8_t>(8, 0x55));
+
+    REQUIRE(recordedEvents() == expected);
+}
+
+TEST_CASE("Data transfer can be streamed in parts", "[ssd1306]") {
+    resetDisplay();
+
+    static const uint8_t Data[] = { 0x01, 0x02, 0x03 };
+
+    SSD1306_beginData(8, SSD1306_SEND_FLIPY | SSD1306_SEND_INVERT);
+    SSD1306_streamData(Data, sizeof(Data));
+    SSD1306_streamFill(0x0F, 2);
+    SSD1306_streamData(Data, sizeof(Data));
+    SSD1306_flush();
+
+    REQUIRE(recordedEvents() == transfer(DataControl, { 0xFC, 0xFD, 0xFE, 0xF0, 0xF0, 0xFC, 0xFD, 0xFE }));
+}
+
+TEST_CASE("Transfer waits for the streamed data", "[ssd1306]") {
+    resetDisplay();
+
+    static const uint8_t Data[] = { 0x11, 0x22 };
+
+    SSD1306_beginData(4, 0);
+    SSD1306_streamData(Data, sizeof(Data));
+
+    // Let the interrupt send everything queued so far
+    for (int i = 0; i < 20; ++i) {
+        Mock_tick();
+    }
+
+    REQUIRE(SSD1306_isBusy());
+    REQUIRE(recordedEvents() == Events{ Mock_I2C_Start, Address, DataControl, 0x11, 0x22 });
+
+    SSD1306_streamData(Data, sizeof(Data));
+    SSD1306_flush();
+
+    REQUIRE(recordedEvents() == transfer(DataControl, { 0x11, 0x22, 0x11, 0x22 }));
+}
+
+TEST_CASE("Streamed data is limited to the transfer length", "[ssd1306]") {
+    resetDisplay();
+
+    static const uint8_t Data[] = { 1, 2, 3, 4 };
+
+    SSD1306_beginData(3, 0);
+    SSD1306_streamData(Data, sizeof(Data));
+    SSD1306_streamFill(0xFF, 10);
+    SSD1306_endData();
+
+    SSD1306_beginData(3, SSD1306_SEND_INVERT);
+    SSD1306_streamData(Data, 1);
+    SSD1306_endData();
+
+    SSD1306_sendCommand(SSD1306_CMD_DISPLAYON);
+    SSD1306_flush();
+
+    Events expected;
+    append(expected, DataControl, { 1, 2, 3 });
+    append(expected, DataControl, { 0xFE, 0xFF, 0xFF });
+    append(expected, CommandControl, { SSD1306_CMD_DISPLAYON });
+
+    REQUIRE(recordedEvents() == expected);
+}
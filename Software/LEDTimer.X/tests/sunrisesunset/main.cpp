@@ -0,0 +1,182 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <xc.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+extern "C" {
+#include <Clock.h>
+#include <Settings.h>
+#include <SunsetSunrise.h>
+#include <Types.h>
+}
+
+namespace
+{
+
+// The double-precision implementation the fixed-point one replaced
+int reference(const double latitude, const double longitude, const bool sunset, const int dayOfYear)
+{
+    const auto rad = [](const double deg) { return deg * M_PI / 180; };
+    const auto deg = [](const double rad) { return rad * 180 / M_PI; };
+    const auto quadrant = [](const double deg) { return 90 * std::floor(deg / 90); };
+    const auto clamp = [](const double deg) { return deg - 360 * std::floor(deg / 360); };
+
+    const double longitudeHour = longitude / 15;
+    const double t = dayOfYear + ((sunset ? 18 : 6) - longitudeHour) / 24;
+
+    const double mDeg = 0.9856 * t - 3.289;
+    const double mRad = rad(mDeg);
+
+    const double lDeg = clamp(mDeg + 1.916 * std::sin(mRad) + 0.02 * std::sin(2 * mRad) + 282.634);
+    const double lRad = rad(lDeg);
+
+    const double ra1Deg = clamp(deg(std::atan(0.91764 * std::tan(lRad))));
+    const double raDeg = ra1Deg + quadrant(lDeg) - quadrant(ra1Deg);
+
+    const double sunDeclinationRad = std::asin(0.39782 * std::sin(lRad));
+
+    double hourAngleDeg = deg(
+        std::acos(
+            (std::cos(rad(90.833)) - std::sin(sunDeclinationRad) * std::sin(rad(latitude)))
+            / (std::cos(sunDeclinationRad) * std::cos(rad(latitude)))
+        )
+    );
+
+    if (!sunset) {
+        hourAngleDeg = 360 - hourAngleDeg;
+    }
+
+    double time = hourAngleDeg / 15 + raDeg / 15 - 0.06571 * t - 6.622 - longitudeHour;
+    time -= 24 * std::floor(time / 24);
+
+    return static_cast<int>(std::lround(time * 60)) % (24 * 60);
+}
+
+int32_t fixedPoint(const double value)
+{
+    return static_cast<int32_t>(std::lround(value * 65536));
+}
+
+Clock_Time calculate(const double latitude, const double longitude, const bool sunset, const uint16_t dayOfYear)
+{
+    SunriseSunsetData data{};
+    SunriseSunset_setPosition(&data, fixedPoint(longitude), fixedPoint(latitude));
+    SunriseSunset_setTimeZone(&data, 0, false);
+    return SunriseSunset_calculate(&data, sunset, dayOfYear);
+}
+
+// Difference in minutes around midnight
+int difference(const int a, const int b)
+{
+    const int d = std::abs(a - b) % (24 * 60);
+    return std::min(d, 24 * 60 - d);
+}
+
+}
+
+TEST_CASE("BCD coordinates to fixed-point")
+{
+    CHECK(Types_bcdToFixedPoint(0x00000000u, false) == 0);
+    CHECK(Types_bcdToFixedPoint(0x09000000u, false) == 90l << 16);
+    CHECK(Types_bcdToFixedPoint(0x18000000u, true) == -(180l << 16));
+    CHECK(Types_bcdToFixedPoint(0x00050000u, false) == 1l << 15);
+    CHECK(Types_bcdToFixedPoint(0x04746744u, false) == fixedPoint(47.46744));
+    CHECK(Types_bcdToFixedPoint(0x01904687u, true) == fixedPoint(-19.04687));
+}
+
+TEST_CASE("Accuracy against the double-precision implementation")
+{
+    int samples = 0;
+    int exact = 0;
+    int maxError = 0;
+    long errorSum = 0;
+
+    // Up to the polar circles where the Sun rises and sets every day
+    for (int latitude = -65; latitude <= 65; latitude += 5) {
+        for (int longitude = -180; longitude <= 180; longitude += 15) {
+            for (int dayOfYear = 1; dayOfYear <= 366; ++dayOfYear) {
+                for (const bool sunset : { false, true }) {
+                    const int error = difference(
+                        calculate(latitude, longitude, sunset, dayOfYear),
+                        reference(latitude, longitude, sunset, dayOfYear)
+                    );
+
+                    ++samples;
+                    exact += error == 0 ? 1 : 0;
+                    maxError = std::max(maxError, error);
+                    errorSum += error;
+                }
+            }
+        }
+    }
+
+    std::printf(
+        "Sunrise/sunset accuracy: %d samples, %.2f%% exact, mean error %.4f min, max error %d min\n",
+        samples,
+        100.0 * exact / samples,
+        static_cast<double>(errorSum) / samples,
+        maxError
+    );
+
+    // Only rounding differences of the minutes
+    CHECK(maxError <= 1);
+    CHECK(exact * 10 >= samples * 9);
+}
+
+TEST_CASE("Time zone offset")
+{
+    SunriseSunsetData data{};
+    SunriseSunset_setPosition(&data, fixedPoint(19.04687), fixedPoint(47.46744));
+
+    SunriseSunset_setTimeZone(&data, 0, false);
+    const Clock_Time utc = SunriseSunset_calculate(&data, true, 172);
+
+    SunriseSunset_setTimeZone(&data, 3, false);
+    CHECK(SunriseSunset_calculate(&data, true, 172) == utc + 90);
+
+    SunriseSunset_setTimeZone(&data, 2, true);
+    CHECK(SunriseSunset_calculate(&data, true, 172) == utc + 120);
+
+    // Wraps around midnight
+    SunriseSunset_setTimeZone(&data, -24, false);
+    CHECK(SunriseSunset_calculate(&data, false, 172) == SunriseSunset_calculate(&data, false, 172) % (24 * 60));
+    CHECK(SunriseSunset_calculate(&data, false, 172) >= 0);
+}
+
+TEST_CASE("Polar day and night")
+{
+    // Midsummer and midwinter above the Arctic Circle
+    for (const uint16_t dayOfYear : { 172, 355 }) {
+        for (const bool sunset : { false, true }) {
+            const Clock_Time time = calculate(80, 0, sunset, dayOfYear);
+            CHECK(time >= 0);
+            CHECK(time < 24 * 60);
+        }
+    }
+
+    // The Sun doesn't set: sunrise at noon - 12 hours, sunset at noon + 12 hours
+    CHECK(difference(calculate(80, 0, false, 172), calculate(80, 0, true, 172)) == 0);
+}
+
+TEST_CASE("Update from the location settings")
+{
+    Mock_reset(nullptr);
+    Settings_loadDefaults();
+    Settings_data.time.timeZoneOffsetHalfHours = 2;
+
+    // June 21st
+    Clock_setDate(54, 6, 21);
+    Clock_setTime(12, 0);
+    Clock_task();
+
+    const double latitude = 47.46744;
+    const double longitude = 19.04687;
+    const int dayOfYear = Clock_getDayOfYear() + 1;
+
+    CHECK(difference(SunriseSunset_getSunrise(), reference(latitude, longitude, false, dayOfYear) + 60) <= 1);
+    CHECK(difference(SunriseSunset_getSunset(), reference(latitude, longitude, true, dayOfYear) + 60) <= 1);
+}
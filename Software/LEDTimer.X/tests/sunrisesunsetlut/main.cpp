@@ -0,0 +1,79 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <xc.h>
+
+extern "C" {
+#include <Clock.h>
+#include <Settings.h>
+#include <SunsetSunrise.h>
+
+// The original 6-minute table of the compressed location
+extern const uint8_t SunriseSunsetLUT[366][2];
+}
+
+namespace
+{
+
+constexpr uint8_t Budapest = 0;
+
+}
+
+TEST_CASE("Compressed table against the original one")
+{
+    Settings_loadDefaults();
+    Settings_data.time.timeZoneOffsetHalfHours = 0;
+
+    for (uint16_t dayOfYear = 0; dayOfYear < 366; ++dayOfYear) {
+        for (const bool sunset : { false, true }) {
+            const Clock_Time time = SunriseSunset_calculate(Budapest, sunset, dayOfYear);
+
+            CHECK(time >= 0);
+            CHECK(time < 24 * 60);
+
+            // The original table truncates to 6 minutes, the compressed one
+            // is within a minute of the calculated time
+            const int bucketStart = SunriseSunsetLUT[dayOfYear][sunset ? 1 : 0] * 6;
+            CHECK(time >= bucketStart - 2);
+            CHECK(time <= bucketStart + 6 + 2);
+        }
+    }
+    CHECK(sizeof(SunriseSunsetLUT_Location) < sizeof(SunriseSunsetLUT) / 16);
+}
+
+TEST_CASE("Time zone offset of the compressed table")
+{
+    Settings_loadDefaults();
+
+    Settings_data.time.timeZoneOffsetHalfHours = 0;
+    const Clock_Time utc = SunriseSunset_calculate(Budapest, true, 172);
+
+    Settings_data.time.timeZoneOffsetHalfHours = 2;
+    CHECK(SunriseSunset_calculate(Budapest, true, 172) == utc + 60);
+
+    // Wraps around midnight
+    Settings_data.time.timeZoneOffsetHalfHours = 28;
+    CHECK(SunriseSunset_calculate(Budapest, true, 172) == utc + 14 * 60 - 24 * 60);
+}
+
+TEST_CASE("Update from the selected location")
+{
+    Mock_reset(nullptr);
+    Settings_loadDefaults();
+    Settings_data.time.timeZoneOffsetHalfHours = 2;
+
+    // March 1st of a non-leap year skips February 29th of the table
+    Clock_setDate(53, 3, 1);
+    Clock_setTime(12, 0);
+    Clock_task();
+
+    const uint16_t index = Clock_getDayOfYear() + 1;
+
+    CHECK(SunriseSunset_getSunrise() == SunriseSunset_calculate(Budapest, false, index));
+    CHECK(SunriseSunset_getSunset() == SunriseSunset_calculate(Budapest, true, index));
+
+    // An invalid index from an older settings layout falls back to the first location
+    Settings_data.location.index = 0xFF;
+    SunriseSunset_update();
+
+    CHECK(SunriseSunset_getSunrise() == SunriseSunset_calculate(Budapest, false, index));
+}
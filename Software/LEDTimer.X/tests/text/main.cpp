@@ -0,0 +1,213 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <Text.h>
+
+#include "../mock/Transfers.hpp"
+
+#include <cstdint>
+#include <vector>
+
+using namespace mock;
+
+namespace {
+    const std::vector<uint8_t> GlyphA{ 0x7E, 0x11, 0x11, 0x11, 0x7E };
+    const std::vector<uint8_t> GlyphB{ 0x7F, 0x49, 0x49, 0x49, 0x36 };
+}
+
+TEST_CASE("Text is drawn with one data transfer", "[text]") {
+    resetDisplay();
+
+    REQUIRE(static_cast<int>(Text_draw("a b", 2, 10, 0, false)) == 10 + 3 * 6);
+    SSD1306_flush();
+
+    const std::vector<Transfer> expected{
+        position(2, 10),
+        { DataControl, concat({ GlyphA, { 0 }, std::vector<uint8_t>(5, 0), { 0 }, GlyphB, { 0 } }) }
+    };
+
+    REQUIRE(recordedTransfers() == expected);
+}
+
+TEST_CASE("Text transformations apply to the spacing", "[text]") {
+    resetDisplay();
+
+    Text_draw("AB", 0, 0, 1, true);
+    SSD1306_flush();
+
+    std::vector<uint8_t> data = concat({ GlyphA, { 0 }, GlyphB, { 0 } });
+    for (auto& byte : data) {
+        byte = static_cast<uint8_t>(~(byte << 1));
+    }
+
+    const std::vector<Transfer> expected{
+        position(0, 0),
+        { DataControl, data }
+    };
+
+    REQUIRE(recordedTransfers() == expected);
+}
+
+TEST_CASE("Text is clipped at the right edge", "[text]") {
+    resetDisplay();
+
+    // The third character would start off the screen
+    REQUIRE(static_cast<int>(Text_draw("ABA", 7, 120, 0, false)) == 120 + 2 * 6);
+    SSD1306_flush();
+
+    const std::vector<Transfer> expected{
+        position(7, 120),
+        { DataControl, concat({ GlyphA, { 0 }, { GlyphB[0], GlyphB[1] } }) }
+    };
+
+    REQUIRE(recordedTransfers() == expected);
+}
+
+TEST_CASE("7-segment text is drawn with one data transfer per page", "[text]") {
+    resetDisplay();
+
+    const uint8_t end = Text_draw7Seg("1:-", 2, 20, false);
+    SSD1306_flush();
+
+    const auto transfers = recordedTransfers();
+
+    // Digit + spacing, colon + spacing, dash + spacing
+    const uint8_t width = 12 + 2 + 4 + 2 + 7 + 2;
+    REQUIRE(static_cast<int>(end) == 20 + width);
+    REQUIRE(transfers.size() == 6);
+
+    for (uint8_t page = 0; page < 3; ++page) {
+        REQUIRE(transfers[page * 2] == position(2 + page, 20));
+        REQUIRE(transfers[page * 2 + 1].control == DataControl);
+        REQUIRE(transfers[page * 2 + 1].payload.size() == width);
+    }
+
+    // The dash is drawn in the middle page only
+    const std::vector<uint8_t> dash(7, 0b00011100);
+    const auto dashAt = [&](uint8_t page) {
+        const auto& payload = transfers[page * 2 + 1].payload;
+        return std::vector<uint8_t>(payload.begin() + 20, payload.begin() + 27);
+    };
+
+    REQUIRE(dashAt(0) == std::vector<uint8_t>(7, 0));
+    REQUIRE(dashAt(1) == dash);
+    REQUIRE(dashAt(2) == std::vector<uint8_t>(7, 0));
+}
+
+TEST_CASE("7-segment text stops before the right edge", "[text]") {
+    resetDisplay();
+
+    // Every character needs 12 + 1 columns to fit
+    REQUIRE(static_cast<int>(Text_draw7Seg("88888888", 0, 30, false)) == 30 + 7 * (12 + 2));
+    SSD1306_flush();
+
+    const auto transfers = recordedTransfers();
+
+    REQUIRE(transfers.size() == 6);
+    REQUIRE(transfers[1].payload.size() == 7 * (12 + 2));
+}
+
+TEST_CASE("Cached 7-segment text sends only the changed characters", "[text]") {
+    resetDisplay();
+
+    // Reference rendering of the whole text
+    Text_draw7Seg("12:35", 3, 15, false);
+    SSD1306_flush();
+    const auto reference = recordedTransfers();
+    Mock_SSP1_clearEvents();
+
+    Text_7SegCache cache;
+    Text_invalidate7SegCache(&cache);
+
+    Text_draw7SegCached("12:34", 3, 15, false, &cache);
+    SSD1306_flush();
+    Mock_SSP1_clearEvents();
+
+    // Digit + spacing, digit + spacing, colon + spacing, digit + spacing
+    const uint8_t offset = 3 * (12 + 2) + 4 + 2;
+
+    REQUIRE(static_cast<int>(Text_draw7SegCached("12:35", 3, 15, false, &cache)) == 15 + offset + 12);
+    SSD1306_flush();
+
+    const auto transfers = recordedTransfers();
+
+    REQUIRE(transfers.size() == 6);
+
+    for (uint8_t page = 0; page < 3; ++page) {
+        const auto& payload = reference[page * 2 + 1].payload;
+
+        REQUIRE(transfers[page * 2] == position(3 + page, 15 + offset));
+        REQUIRE(transfers[page * 2 + 1].payload == std::vector<uint8_t>(payload.begin() + offset, payload.end()));
+    }
+
+    // Nothing changed
+    Mock_SSP1_clearEvents();
+    Text_draw7SegCached("12:35", 3, 15, false, &cache);
+    SSD1306_flush();
+
+    REQUIRE(Mock_SSP1_eventCount() == 0);
+
+    // Everything is drawn after invalidating the cache
+    Text_invalidate7SegCache(&cache);
+    Text_draw7SegCached("12:35", 3, 15, false, &cache);
+    SSD1306_flush();
+
+    REQUIRE(recordedTransfers() == reference);
+}
+
+TEST_CASE("Cached 7-segment text is redrawn after a resized character", "[text]") {
+    resetDisplay();
+
+    Text_7SegCache cache;
+    Text_invalidate7SegCache(&cache);
+
+    Text_draw7SegCached("-12", 0, 10, false, &cache);
+    SSD1306_flush();
+    Mock_SSP1_clearEvents();
+
+    // The dash is narrower than the digit, the rest of the text moves
+    Text_draw7SegCached("312", 0, 10, false, &cache);
+    SSD1306_flush();
+
+    const auto transfers = recordedTransfers();
+
+    REQUIRE(transfers.size() == 6);
+    REQUIRE(transfers[0] == position(0, 10));
+    REQUIRE(transfers[1].payload.size() == 3 * 12 + 2 * 2);
+}
+
+TEST_CASE("Cached 7-segment text clears the columns of a wider text", "[text]") {
+    resetDisplay();
+
+    Text_7SegCache cache;
+    Text_invalidate7SegCache(&cache);
+
+    Text_draw7SegCached("312", 0, 10, false, &cache);
+    SSD1306_flush();
+    Mock_SSP1_clearEvents();
+
+    // The dash is narrower than the digit, the text gets shorter
+    REQUIRE(static_cast<int>(Text_draw7SegCached("-12", 0, 10, false, &cache)) == 10 + 7 + 2 + 12 + 2 + 12);
+    SSD1306_flush();
+
+    const auto transfers = recordedTransfers();
+
+    REQUIRE(transfers.size() == 12);
+
+    for (uint8_t page = 0; page < 3; ++page) {
+        REQUIRE(transfers[6 + page * 2] == position(page, 10 + 35));
+        REQUIRE(transfers[6 + page * 2 + 1].payload == std::vector<uint8_t>(5, 0));
+    }
+}
+
+TEST_CASE("7-segment text width matches the drawn run", "[text]") {
+    for (const char* text : { "12:34", "-12", "+5", "1-", "5+", " 7", "-" }) {
+        CAPTURE(text);
+
+        resetDisplay();
+
+        const uint8_t end = Text_draw7Seg(text, 0, 0, false);
+        SSD1306_flush();
+
+        REQUIRE(static_cast<int>(Text_calculateWidth7Seg(text)) == static_cast<int>(end));
+    }
+}
@@ -0,0 +1,257 @@
+import argparse
+import os
+import re
+import sys
+
+# Fixed UI texts pre-rendered with the ASCIIReduced font of Text.c.
+# Labels are drawn with Graphics_drawLabel() using Label_<Name>.
+# The order matters where the firmware indexes a group of labels
+# (e.g. Label_Sunday + day of week).
+LABELS = [
+    # Screen titles and menu items
+    ('Settings', 'SETTINGS'),
+    ('Scheduler', 'SCHEDULER'),
+    ('SegmentScheduler', 'SEGMENT SCHEDULER'),
+    ('SegmentSchedulerTitle', 'SEGMENT SCHD.'),
+    ('LEDBrightness', 'LED BRIGHTNESS'),
+    ('DisplayBrightness', 'DISP. BRIGHTNESS'),
+    ('Date', 'DATE'),
+    ('Time', 'TIME'),
+    ('TimeZone', 'TIME ZONE'),
+    ('DST', 'DST'),
+    ('Location', 'LOCATION'),
+
+    # Scheduler settings
+    ('Type', 'TYPE:'),
+    ('Schedule', 'SCHEDULE:'),
+    ('Active', 'ACTIVE:'),
+    ('On', 'ON:'),
+    ('Off', 'OFF:'),
+    ('Offset', 'OFFSET:'),
+    ('TimeField', 'TIME:'),
+    ('Minutes', 'MIN'),
+    ('Colon', ':'),
+    ('ChangeSettings', 'CHANGE SETTINGS'),
+    ('OnSegmentSchedulerScreen', 'ON SGMT. SCHD. SCREEN'),
+    ('OutputWillOnly', 'THE OUTPUT WILL ONLY'),
+    ('BeSwitchedManually', 'BE SWITCHED MANUALLY'),
+
+    # Settings_SchedulerType order
+    ('SchedulerTypeInterval', 'INTERVAL'),
+    ('SchedulerTypeSegment', 'SEGMENT'),
+    ('SchedulerTypeOff', 'OFF'),
+
+    # Settings_IntervalSwitchType order
+    ('SwitchTypeTime', 'TIME'),
+    ('SwitchTypeSunrise', 'SUNRISE'),
+    ('SwitchTypeSunset', 'SUNSET'),
+
+    # Main screen next transition
+    ('NextOn', 'ON:  '),
+    ('NextOff', 'OFF: '),
+    ('NoNextTransition', '---: --:--'),
+
+    # DST settings
+    ('Start', 'START'),
+    ('End', 'END'),
+    ('Of', 'OF'),
+    ('First', '1ST '),
+    ('Second', '2ND '),
+    ('Last', 'LAST'),
+    ('Sunday', 'SUN'),
+    ('Monday', 'MON'),
+    ('Tuesday', 'TUE'),
+    ('Wednesday', 'WED'),
+    ('Thursday', 'THU'),
+    ('Friday', 'FRI'),
+    ('Saturday', 'SAT'),
+    ('January', 'JAN'),
+    ('February', 'FEB'),
+    ('March', 'MAR'),
+    ('April', 'APR'),
+    ('May', 'MAY'),
+    ('June', 'JUN'),
+    ('July', 'JUL'),
+    ('August', 'AUG'),
+    ('September', 'SEP'),
+    ('October', 'OCT'),
+    ('November', 'NOV'),
+    ('December', 'DEC'),
+
+    # Location settings
+    ('Latitude', 'LAT.:'),
+    ('Longitude', 'LON.:'),
+
+    # Schedule bar hours
+    ('Hour0', '0'),
+    ('Hour6', '6'),
+    ('Hour12', '12'),
+    ('Hour18', '18'),
+    ('Hour24', '24'),
+]
+
+CHAR_WIDTH = 5
+SPACE_WIDTH = 5
+CHAR_SPACING = 1
+FIRST_CHAR = '!'
+
+
+def parse_font_array(source: str, name: str):
+    match = re.search(r'static const uint8_t ' + name + r'\[[^=]*=\s*\{(.*?)\n\};', source, re.DOTALL)
+    if not match:
+        raise RuntimeError(f'{name} not found in the font source')
+    body = re.sub(r'//[^\n]*', '', match.group(1))
+    return [int(value, 2) for value in re.findall(r'0b([01]+)', body)]
+
+
+def load_font(path: str):
+    with open(path) as f:
+        source = f.read()
+
+    columns = parse_font_array(source, 'ASCIIReduced')
+    placeholder = parse_font_array(source, 'ASCIIReducedPlaceholder')
+
+    assert len(columns) % CHAR_WIDTH == 0
+    assert len(placeholder) == CHAR_WIDTH
+
+    glyphs = [columns[i:i + CHAR_WIDTH] for i in range(0, len(columns), CHAR_WIDTH)]
+
+    return glyphs, placeholder
+
+
+def render(text: str, glyphs, placeholder):
+    # Same layout as Text_draw(), without the spacing after the last character
+    columns = []
+    for c in text.upper():
+        if c == ' ':
+            columns += [0] * SPACE_WIDTH
+        else:
+            index = ord(c) - ord(FIRST_CHAR)
+            columns += glyphs[index] if 0 <= index < len(glyphs) else placeholder
+        columns += [0] * CHAR_SPACING
+    return columns[:-CHAR_SPACING]
+
+
+def make_header():
+    lines = [
+        '// Made by LabelGenerator.py, do not edit.',
+        '',
+        '#pragma once',
+        '',
+        '#include <stdint.h>',
+        '',
+        '#ifdef __cplusplus',
+        'extern "C" {',
+        '#endif',
+        '',
+        'typedef enum {',
+    ]
+    for name, text in LABELS:
+        lines.append(f'    Label_{name}, // "{text}"')
+    lines += [
+        '',
+        '    Label_Count',
+        '} Label;',
+        '',
+        'typedef struct {',
+        '    uint16_t offset;',
+        '    uint8_t columns;',
+        '} Labels_Entry;',
+        '',
+        '// Position of the labels in Labels_columns',
+        'extern const Labels_Entry Labels_entries[Label_Count];',
+        '',
+        '// Rendered columns of the labels (without the spacing after the last character)',
+        'extern const uint8_t Labels_columns[];',
+        '',
+        '#ifdef LABELS_WITH_TEXT',
+        'extern const char* const Labels_texts[Label_Count];',
+        '#endif',
+        '',
+        '#ifdef __cplusplus',
+        '}',
+        '#endif',
+        '',
+    ]
+    return '\n'.join(lines)
+
+
+def make_source(glyphs, placeholder):
+    lines = [
+        '// Made by LabelGenerator.py, do not edit.',
+        '',
+        '#include "Labels.h"',
+        '',
+    ]
+
+    entries = []
+    data = []
+    for name, text in LABELS:
+        columns = render(text, glyphs, placeholder)
+        assert len(columns) <= 255
+        entries.append((name, len(data), len(columns)))
+        data.append((name, text, columns))
+
+    lines.append('const Labels_Entry Labels_entries[Label_Count] = {')
+    offset = 0
+    for index, (name, text, columns) in enumerate(data):
+        delimiter = ',' if index < len(data) - 1 else ''
+        lines.append(f'    {{ {offset}, {len(columns)} }}{delimiter} // {name}')
+        offset += len(columns)
+    lines += ['};', '']
+
+    lines.append(f'const uint8_t Labels_columns[{offset}] = {{')
+    for index, (name, text, columns) in enumerate(data):
+        lines.append(f'    // {name}: "{text}"')
+        for i in range(0, len(columns), 12):
+            chunk = columns[i:i + 12]
+            last = index == len(data) - 1 and i + 12 >= len(columns)
+            values = ', '.join(f'0x{value:02X}' for value in chunk)
+            lines.append(f'    {values}{"" if last else ","}')
+    lines += ['};', '']
+
+    lines += [
+        '#ifdef LABELS_WITH_TEXT',
+        'const char* const Labels_texts[Label_Count] = {',
+    ]
+    for index, (name, text) in enumerate(LABELS):
+        delimiter = ',' if index < len(LABELS) - 1 else ''
+        lines.append(f'    "{text}"{delimiter}')
+    lines += ['};', '#endif', '']
+
+    return '\n'.join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Generates the pre-rendered UI labels of the LED Timer')
+    parser.add_argument('--font', required=True, help='Path of Text.c with the ASCIIReduced font')
+    parser.add_argument('--output-dir', required=True, help='Directory of the generated Labels.c and Labels.h')
+    parser.add_argument('--check', action='store_true', help='Only compare the generated files with the existing ones')
+    args = parser.parse_args()
+
+    glyphs, placeholder = load_font(args.font)
+
+    files = {
+        'Labels.h': make_header(),
+        'Labels.c': make_source(glyphs, placeholder),
+    }
+
+    if args.check:
+        stale = []
+        for name, content in files.items():
+            path = os.path.join(args.output_dir, name)
+            if not os.path.exists(path) or open(path).read() != content:
+                stale.append(path)
+
+        for path in stale:
+            print(f'{path} is out of date, run LabelGenerator.py without --check')
+
+        sys.exit(1 if stale else 0)
+
+    for name, content in files.items():
+        with open(os.path.join(args.output_dir, name), 'w') as f:
+            f.write(content)
+
+
+if __name__ == '__main__':
+    main()
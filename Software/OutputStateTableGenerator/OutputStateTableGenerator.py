@@ -0,0 +1,127 @@
+import argparse
+import os
+
+# State transition table of the OutputController.
+#
+# The table is indexed by the state bits followed by the inputs. Each entry
+# is a nibble holding the next state and the update flag, two entries are
+# packed in a byte (even index in the low nibble).
+#
+# A new input (e.g. a second channel or a running fade) is added to INPUTS
+# and handled in next_state(), the firmware only needs to set its bit in
+# the index. Every input doubles the size of the table.
+
+STATE = [
+    ('Override', 'The output is toggled by the user, against the schedule'),
+    ('Output', 'The output is switched on'),
+    ('Schedule', 'The output was switched on by the schedule in the previous step'),
+]
+
+INPUTS = [
+    ('Schedule', 'The schedule switches the output on'),
+    ('Battery', 'Running from the backup battery'),
+    ('Force', 'The output must be updated even if its state is unchanged'),
+]
+
+UPDATE_BIT = 3
+
+NAME_WIDTH = 26
+
+assert len(STATE) <= UPDATE_BIT
+
+
+def next_state(state: dict, inputs: dict):
+    schedule = inputs['Schedule']
+
+    # The override is cleared when the schedule changes the state
+    override = state['Override'] and schedule == state['Schedule']
+
+    # The output doesn't run from the backup battery
+    output = not inputs['Battery'] and schedule != override
+
+    update = output != state['Output'] or inputs['Force']
+
+    return {
+        'Override': override,
+        'Output': output,
+        'Schedule': schedule,
+    }, update
+
+
+def decode(index: int):
+    state = {name: bool(index >> bit & 1) for bit, (name, _) in enumerate(STATE)}
+    inputs = {name: bool(index >> (len(STATE) + bit) & 1) for bit, (name, _) in enumerate(INPUTS)}
+    return state, inputs
+
+
+def make_table():
+    entries = []
+    for index in range(1 << (len(STATE) + len(INPUTS))):
+        state, inputs = decode(index)
+        new_state, update = next_state(state, inputs)
+        entry = sum(int(new_state[name]) << bit for bit, (name, _) in enumerate(STATE))
+        entry |= int(update) << UPDATE_BIT
+        entries.append(entry)
+    return entries
+
+
+def make_header():
+    entries = make_table()
+    state_bits = len(STATE)
+
+    lines = [
+        '// Made by OutputStateTableGenerator.py, do not edit.',
+        '',
+        '#pragma once',
+        '',
+        '#include <stdint.h>',
+        '',
+        '// State bits, also the lower bits of the table index',
+    ]
+    for bit, (name, description) in enumerate(STATE):
+        lines.append(f'#define {"OutputState_" + name:<{NAME_WIDTH}} (1u << {bit}) // {description}')
+    lines += [
+        f'#define {"OutputState_Mask":<{NAME_WIDTH}} ({(1 << state_bits) - 1}u)',
+        '',
+        '// Input bits of the table index',
+    ]
+    for bit, (name, description) in enumerate(INPUTS):
+        lines.append(f'#define {"OutputState_Input" + name:<{NAME_WIDTH}} (1u << {state_bits + bit}) // {description}')
+    lines += [
+        '',
+        '// Set in the entry if the output must be updated',
+        f'#define {"OutputState_Update":<{NAME_WIDTH}} (1u << {UPDATE_BIT})',
+        '',
+        f'#define {"OutputState_TableEntryCount":<{NAME_WIDTH}} ({len(entries)}u)',
+        '',
+        '// Entries packed in nibbles, the even index is in the low nibble',
+        f'static const uint8_t OutputState_table[{len(entries) // 2}] = {{',
+    ]
+    for i in range(0, len(entries), 16):
+        chunk = entries[i:i + 16]
+        values = ', '.join(f'0x{chunk[j + 1] << 4 | chunk[j]:02X}' for j in range(0, len(chunk), 2))
+        last = i + 16 >= len(entries)
+        lines.append(f'    {values}{"" if last else ","}')
+    lines += [
+        '};',
+        '',
+        '#define OutputState_tableEntry(_Index) \\',
+        '    ((uint8_t)((_Index) & 1 \\',
+        '        ? OutputState_table[(_Index) >> 1] >> 4 \\',
+        '        : OutputState_table[(_Index) >> 1] & 0x0F))',
+        '',
+    ]
+    return '\n'.join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Generates the state transition table of the LED Timer output controller')
+    parser.add_argument('--output-dir', required=True, help='Directory of the generated OutputStateTable.h')
+    args = parser.parse_args()
+
+    with open(os.path.join(args.output_dir, 'OutputStateTable.h'), 'w') as f:
+        f.write(make_header())
+
+
+if __name__ == '__main__':
+    main()
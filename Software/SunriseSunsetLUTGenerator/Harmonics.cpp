@@ -0,0 +1,66 @@
+#include "Harmonics.hpp"
+
+#include <cassert>
+#include <cmath>
+#include <numbers>
+
+extern "C" {
+#include "FixedPoint.h"
+}
+
+namespace generator {
+
+Coefficients fitHarmonics(const std::vector<double>& minutes, const int harmonics)
+{
+    assert(minutes.size() == DaysOfTable);
+
+    // The least squares fit over the full period is the discrete Fourier transform
+    std::vector<double> series(1 + 2 * harmonics, 0.0);
+
+    for (int day = 0; day < DaysOfTable; ++day) {
+        series[0] += minutes[day] / DaysOfTable;
+
+        for (int k = 1; k <= harmonics; ++k) {
+            const double w = 2 * std::numbers::pi * k * day / DaysOfTable;
+            series[2 * k - 1] += 2 * minutes[day] * std::cos(w) / DaysOfTable;
+            series[2 * k] += 2 * minutes[day] * std::sin(w) / DaysOfTable;
+        }
+    }
+
+    // The firmware wraps the result around midnight
+    series[0] = std::fmod(series[0], 24 * 60.0);
+    if (series[0] < 0) {
+        series[0] += 24 * 60.0;
+    }
+
+    Coefficients coefficients;
+    coefficients.reserve(series.size());
+
+    for (const double value : series) {
+        const long quantized = std::lround(std::ldexp(value, CoefficientFractionBits));
+        assert(quantized >= INT16_MIN && quantized <= INT16_MAX);
+        coefficients.push_back(static_cast<int16_t>(quantized));
+    }
+
+    return coefficients;
+}
+
+int decodeHarmonics(const Coefficients& coefficients, const int day)
+{
+    const auto angle = static_cast<FixedPoint_Angle>((static_cast<uint32_t>(day) << 16) / DaysOfTable);
+
+    int32_t t = coefficients[0];
+
+    for (size_t k = 1; 2 * k < coefficients.size(); ++k) {
+        int32_t sin;
+        int32_t cos;
+        FixedPoint_sinCos(static_cast<FixedPoint_Angle>(angle * k), &sin, &cos);
+
+        t += FixedPoint_multiply(coefficients[2 * k - 1], cos);
+        t += FixedPoint_multiply(coefficients[2 * k], sin);
+    }
+
+    return (t + (1 << (CoefficientFractionBits - 1))) >> CoefficientFractionBits;
+}
+
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace generator {
+
+/*
+ * Compressed table format of the firmware (SunriseSunsetLUT.h): truncated
+ * Fourier series of an event over the 366 days of a leap year,
+ *
+ *   t(d) = c[0] + sum(c[2k - 1] * cos(k * w) + c[2k] * sin(k * w)), k = 1..K
+ *   w = 2 * pi * d / 366
+ *
+ * with the coefficients in minutes from midnight UTC with 4 fraction bits.
+ */
+
+constexpr int DaysOfTable = 366;
+constexpr int CoefficientFractionBits = 4;
+
+using Coefficients = std::vector<int16_t>;
+
+// Least squares fit of the minutes of the 366 days
+[[nodiscard]] Coefficients fitHarmonics(const std::vector<double>& minutes, int harmonics);
+
+// Same arithmetic as the decoder of the firmware, minutes without wrapping
+[[nodiscard]] int decodeHarmonics(const Coefficients& coefficients, int day);
+
+}
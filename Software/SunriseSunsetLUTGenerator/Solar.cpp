@@ -0,0 +1,115 @@
+#include "Solar.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+namespace generator {
+
+namespace {
+
+// Apparent sunrise and sunset: refraction and the radius of the solar disc
+constexpr double ZenithDegrees = 90.833;
+
+constexpr int Iterations = 3;
+
+constexpr double rad(const double deg)
+{
+    return deg * std::numbers::pi / 180;
+}
+
+constexpr double deg(const double rad)
+{
+    return rad * 180 / std::numbers::pi;
+}
+
+// Days from 1970-01-01 of a date in the Gregorian calendar
+long daysFromCivil(int year, const int month, const int day)
+{
+    year -= month <= 2 ? 1 : 0;
+    const long era = (year >= 0 ? year : year - 399) / 400;
+    const long yearOfEra = year - era * 400;
+    const long dayOfYear = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    const long dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    return era * 146097 + dayOfEra - 719468;
+}
+
+struct SolarPosition
+{
+    double declination = 0;         // Radians
+    double equationOfTime = 0;      // Minutes
+};
+
+SolarPosition calculatePosition(const double julianDay)
+{
+    const double t = (julianDay - 2451545.0) / 36525.0;
+
+    const double meanLongitude = std::fmod(280.46646 + t * (36000.76983 + t * 0.0003032), 360.0);
+    const double meanAnomaly = 357.52911 + t * (35999.05029 - 0.0001537 * t);
+    const double eccentricity = 0.016708634 - t * (0.000042037 + 0.0000001267 * t);
+
+    const double m = rad(meanAnomaly);
+    const double center = std::sin(m) * (1.914602 - t * (0.004817 + 0.000014 * t))
+        + std::sin(2 * m) * (0.019993 - 0.000101 * t)
+        + std::sin(3 * m) * 0.000289;
+
+    const double omega = rad(125.04 - 1934.136 * t);
+    const double apparentLongitude = meanLongitude + center - 0.00569 - 0.00478 * std::sin(omega);
+
+    const double meanObliquity = 23.0 + (26.0 + (21.448 - t * (46.815 + t * (0.00059 - t * 0.001813))) / 60.0) / 60.0;
+    const double obliquity = rad(meanObliquity + 0.00256 * std::cos(omega));
+
+    const double y = std::pow(std::tan(obliquity / 2), 2);
+    const double l = rad(meanLongitude);
+
+    SolarPosition position;
+    position.declination = std::asin(std::sin(obliquity) * std::sin(rad(apparentLongitude)));
+    position.equationOfTime = 4 * deg(
+        y * std::sin(2 * l)
+        - 2 * eccentricity * std::sin(m)
+        + 4 * eccentricity * y * std::sin(m) * std::cos(2 * l)
+        - 0.5 * y * y * std::sin(4 * l)
+        - 1.25 * eccentricity * eccentricity * std::sin(2 * m)
+    );
+    return position;
+}
+
+double calculateEvent(const double latitude, const double longitude, const double julianDay, const bool sunset)
+{
+    double minutes = 720;
+
+    for (int i = 0; i < Iterations; ++i) {
+        const auto position = calculatePosition(julianDay + minutes / 1440);
+
+        const double cosHourAngle = std::cos(rad(ZenithDegrees))
+            / (std::cos(rad(latitude)) * std::cos(position.declination))
+            - std::tan(rad(latitude)) * std::tan(position.declination);
+
+        const double hourAngle = deg(std::acos(std::clamp(cosHourAngle, -1.0, 1.0)));
+        const double solarNoon = 720 - 4 * longitude - position.equationOfTime;
+
+        minutes = solarNoon + (sunset ? 4 : -4) * hourAngle;
+    }
+
+    return minutes;
+}
+
+}
+
+SunEvents calculateSunEvents(const double latitude, const double longitude, const int year, const int dayOfYear)
+{
+    // Julian day of the midnight UTC
+    const double julianDay = 2440587.5 + static_cast<double>(daysFromCivil(year, 1, 1) + dayOfYear);
+
+    return {
+        calculateEvent(latitude, longitude, julianDay, false),
+        calculateEvent(latitude, longitude, julianDay, true)
+    };
+}
+
+bool isLeapYear(const int year)
+{
+    return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+}
+
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+namespace generator {
+
+// Times of the sunrise and the sunset in minutes from midnight UTC, they can
+// be outside of the day for locations far from Greenwich
+struct SunEvents
+{
+    double sunrise = 0;
+    double sunset = 0;
+};
+
+/*
+ * Calculates the sunrise and the sunset with the solar position algorithm of
+ * the NOAA Solar Calculator (Jean Meeus, Astronomical Algorithms). The
+ * position is evaluated at the time of the event, the result is within a
+ * minute of the almanac between the polar circles.
+ *
+ * During the polar night both events are at the solar noon, during the
+ * midnight sun they are 12 hours before and after it.
+ */
+[[nodiscard]] SunEvents calculateSunEvents(double latitude, double longitude, int year, int dayOfYear);
+
+[[nodiscard]] bool isLeapYear(int year);
+
+}
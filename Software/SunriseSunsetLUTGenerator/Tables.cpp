@@ -0,0 +1,183 @@
+#include "Tables.hpp"
+
+#include <cmath>
+#include <cstdarg>
+#include <cstdio>
+#include <fstream>
+#include <regex>
+#include <sstream>
+#include <stdexcept>
+
+namespace generator {
+
+namespace {
+
+std::string formatString(const char* fmt, ...)
+{
+    char s[256];
+
+    va_list args;
+    va_start(args, fmt);
+    std::vsnprintf(s, sizeof(s), fmt, args);
+    va_end(args);
+
+    return s;
+}
+
+std::ofstream openOutput(const std::filesystem::path& path)
+{
+    std::ofstream file{ path };
+    if (!file) {
+        throw std::runtime_error{ "cannot write " + path.string() };
+    }
+    return file;
+}
+
+std::string joinCoefficients(const Coefficients& coefficients)
+{
+    std::string s;
+    for (size_t i = 0; i < coefficients.size(); ++i) {
+        s += formatString("%s%d", i > 0 ? ", " : "", coefficients[i]);
+    }
+    return s;
+}
+
+}
+
+int wrapAroundMidnight(const double minutes)
+{
+    const int wrapped = static_cast<int>(std::floor(minutes)) % (24 * 60);
+    return wrapped < 0 ? wrapped + 24 * 60 : wrapped;
+}
+
+BucketEntry toBuckets(const SunEvents& events)
+{
+    return {
+        static_cast<uint8_t>(wrapAroundMidnight(events.sunrise) / BucketMinutes),
+        static_cast<uint8_t>(wrapAroundMidnight(events.sunset) / BucketMinutes)
+    };
+}
+
+void writeBucketTable(const std::filesystem::path& path, const LocationTables& tables)
+{
+    auto file = openOutput(path);
+
+    file << "#include \"Clock.h\"\n"
+         << "#include <stdint.h>\n"
+         << formatString(
+                "// Sunrise-sunset LUT for latitude=%.6f, longitude=%.6f.\n",
+                tables.location.latitude,
+                tables.location.longitude
+            )
+         << "// Made by SunriseSunsetLUTGenerator.\n"
+         << "// First value is the sunrise, second is the sunset, both measured in 6-minute buckets from midnight, in UTC.\n"
+         << "// During non-leap years, February 29th (index=59) must be skipped, all subsequent indices must be offset by 1.\n"
+         << "const uint8_t SunriseSunsetLUT[366][2] = {\n    ";
+
+    for (int day = 0; day < DaysOfTable; ++day) {
+        const auto buckets = toBuckets(tables.events[day]);
+
+        file << formatString("/* Day %03d */ { 0x%02X, 0x%02X }", day + 1, buckets[0], buckets[1]);
+
+        if (day < DaysOfTable - 1) {
+            file << (day % 2 == 1 ? ",\n    " : ", ");
+        }
+    }
+
+    file << "\n};\n";
+}
+
+std::vector<BucketEntry> loadBucketTable(const std::filesystem::path& path)
+{
+    std::ifstream file{ path };
+    if (!file) {
+        throw std::runtime_error{ "cannot read " + path.string() };
+    }
+
+    std::stringstream source;
+    source << file.rdbuf();
+    const std::string text = source.str();
+
+    static const std::regex entryPattern{ R"(\{\s*0x([0-9A-Fa-f]{2}),\s*0x([0-9A-Fa-f]{2})\s*\})" };
+
+    std::vector<BucketEntry> entries;
+    for (auto it = std::sregex_iterator{ text.begin(), text.end(), entryPattern }; it != std::sregex_iterator{}; ++it) {
+        entries.push_back({
+            static_cast<uint8_t>(std::stoi((*it)[1].str(), nullptr, 16)),
+            static_cast<uint8_t>(std::stoi((*it)[2].str(), nullptr, 16))
+        });
+    }
+
+    if (entries.size() != DaysOfTable) {
+        throw std::runtime_error{ formatString("%s: %d entries expected, found %zu", path.string().c_str(), DaysOfTable, entries.size()) };
+    }
+
+    return entries;
+}
+
+void writeCompressedTables(
+    const std::filesystem::path& directory,
+    const std::vector<LocationTables>& tables,
+    const int harmonics
+) {
+    auto header = openOutput(directory / "SunriseSunsetLUT.h");
+
+    header << "// Made by SunriseSunsetLUTGenerator, do not edit.\n"
+           << "\n"
+           << "#pragma once\n"
+           << "\n"
+           << "#include <stdint.h>\n"
+           << "\n"
+           << "#ifdef __cplusplus\n"
+           << "extern \"C\" {\n"
+           << "#endif\n"
+           << "\n"
+           << formatString("#define SunriseSunsetLUT_Harmonics          (%d)\n", harmonics)
+           << "#define SunriseSunsetLUT_Coefficients       (1 + 2 * SunriseSunsetLUT_Harmonics)\n"
+           << formatString("#define SunriseSunsetLUT_LocationCount      (%zu)\n", tables.size())
+           << "\n"
+           << "// Fourier series of the sunrise and sunset times over the 366 days of a\n"
+           << "// leap year: c[0] + sum(c[2k - 1] * cos(k * w) + c[2k] * sin(k * w)),\n"
+           << "// where w = 2 * pi * day / 366. The coefficients are minutes from\n"
+           << "// midnight in UTC with 4 fraction bits.\n"
+           << "typedef struct {\n"
+           << "    const char* name;\n"
+           << "    int16_t sunrise[SunriseSunsetLUT_Coefficients];\n"
+           << "    int16_t sunset[SunriseSunsetLUT_Coefficients];\n"
+           << "} SunriseSunsetLUT_Location;\n"
+           << "\n"
+           << "extern const SunriseSunsetLUT_Location SunriseSunsetLUT_locations[SunriseSunsetLUT_LocationCount];\n"
+           << "\n"
+           << "#ifdef __cplusplus\n"
+           << "}\n"
+           << "#endif\n";
+
+    auto source = openOutput(directory / "SunriseSunsetLUT.c");
+
+    source << "// Made by SunriseSunsetLUTGenerator, do not edit.\n"
+           << "\n"
+           << "#if SUNRISE_SUNSET_USE_LUT\n"
+           << "\n"
+           << "#include \"SunriseSunsetLUT.h\"\n"
+           << "\n"
+           << formatString("// %d harmonics, the errors are measured against the calculated minutes\n", harmonics)
+           << "const SunriseSunsetLUT_Location SunriseSunsetLUT_locations[SunriseSunsetLUT_LocationCount] = {\n";
+
+    for (size_t i = 0; i < tables.size(); ++i) {
+        const auto& t = tables[i];
+
+        source << "    {\n"
+               << formatString("        \"%s\", // %.5f, %.5f\n", t.location.name.c_str(), t.location.latitude, t.location.longitude)
+               << formatString("        // Max. error: %d minutes\n", t.sunriseError)
+               << "        { " + joinCoefficients(t.sunrise) + " },\n"
+               << formatString("        // Max. error: %d minutes\n", t.sunsetError)
+               << "        { " + joinCoefficients(t.sunset) + " }\n"
+               << (i + 1 < tables.size() ? "    },\n" : "    }\n");
+    }
+
+    source << "};\n"
+           << "\n"
+           << "#endif\n";
+}
+
+}
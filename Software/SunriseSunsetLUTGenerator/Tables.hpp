@@ -0,0 +1,55 @@
+#pragma once
+
+#include "Harmonics.hpp"
+#include "Solar.hpp"
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace generator {
+
+struct Location
+{
+    std::string name;
+    double latitude = 0;    // Positive for North
+    double longitude = 0;   // Positive for East
+};
+
+struct LocationTables
+{
+    Location location;
+
+    // Events of the 366 days of a leap year
+    std::vector<SunEvents> events;
+
+    Coefficients sunrise;
+    Coefficients sunset;
+
+    // Largest difference between the decoded and the calculated minutes
+    int sunriseError = 0;
+    int sunsetError = 0;
+};
+
+// Sunrise and sunset of a day in 6-minute buckets
+using BucketEntry = std::array<uint8_t, 2>;
+
+constexpr int BucketMinutes = 6;
+
+[[nodiscard]] int wrapAroundMidnight(double minutes);
+[[nodiscard]] BucketEntry toBuckets(const SunEvents& events);
+
+// The format of SunriseSunsetLUT[366][2]
+void writeBucketTable(const std::filesystem::path& path, const LocationTables& tables);
+[[nodiscard]] std::vector<BucketEntry> loadBucketTable(const std::filesystem::path& path);
+
+// SunriseSunsetLUT.c and SunriseSunsetLUT.h of the firmware
+void writeCompressedTables(
+    const std::filesystem::path& directory,
+    const std::vector<LocationTables>& tables,
+    int harmonics
+);
+
+}
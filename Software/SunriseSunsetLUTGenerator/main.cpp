@@ -0,0 +1,313 @@
+/*
+ * Generates the sunrise/sunset tables of the LED Timer without network
+ * access or ephemeris files.
+ *
+ * The events of every day and location are calculated in parallel, then
+ * written in the firmware formats:
+ *  - the compressed harmonic tables of all locations (SunriseSunsetLUT.c/.h),
+ *  - the 6-minute bucket table of each location (SunriseSunsetLUT[366][2]).
+ *
+ * Example:
+ *  sunrise-sunset-lut-generator --cities Cities.csv --output-dir ../LEDTimer.X
+ */
+
+#include "Harmonics.hpp"
+#include "Solar.hpp"
+#include "Tables.hpp"
+#include "ThreadPool.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace generator;
+
+namespace {
+
+// The firmware shows the names in one line
+constexpr size_t NameMaxLength = 21;
+
+struct Options
+{
+    std::vector<Location> locations;
+    std::map<std::string, std::filesystem::path> references;
+    std::filesystem::path outputDirectory;
+    std::filesystem::path bucketTableDirectory;
+    int year = 2024;
+    int harmonics = 3;
+    size_t threads = 0;
+};
+
+void printUsage()
+{
+    std::puts(
+        "Usage: sunrise-sunset-lut-generator [options]\n"
+        "  --cities FILE           CSV of locations: name,latitude,longitude\n"
+        "  --location NAME=LAT,LON Location, positive for North and East\n"
+        "  --output-dir DIR        Writes the compressed SunriseSunsetLUT.c/.h\n"
+        "  --bucket-dir DIR        Writes the 6-minute bucket table of each location\n"
+        "  --compare NAME=FILE     Reports the differences to a 6-minute bucket table\n"
+        "  --harmonics N           Harmonics of the compressed tables (default: 3)\n"
+        "  --year YEAR             Leap year of the tables (default: 2024)\n"
+        "  --threads N             Worker threads (default: hardware concurrency)"
+    );
+}
+
+Location parseLocation(const std::string& name, const std::string& latitude, const std::string& longitude)
+{
+    if (name.empty() || name.size() > NameMaxLength) {
+        throw std::runtime_error{ "invalid location name: '" + name + "'" };
+    }
+
+    Location location;
+    location.name = name;
+    std::transform(location.name.begin(), location.name.end(), location.name.begin(), ::toupper);
+    location.latitude = std::stod(latitude);
+    location.longitude = std::stod(longitude);
+
+    if (std::abs(location.latitude) > 90 || std::abs(location.longitude) > 180) {
+        throw std::runtime_error{ "invalid coordinates of " + name };
+    }
+
+    return location;
+}
+
+void loadCities(const std::filesystem::path& path, std::vector<Location>& locations)
+{
+    std::ifstream file{ path };
+    if (!file) {
+        throw std::runtime_error{ "cannot read " + path.string() };
+    }
+
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+
+        std::stringstream fields{ line };
+        std::string name;
+        std::string latitude;
+        std::string longitude;
+        std::getline(fields, name, ',');
+        std::getline(fields, latitude, ',');
+        std::getline(fields, longitude, ',');
+
+        locations.push_back(parseLocation(name, latitude, longitude));
+    }
+}
+
+Options parseOptions(const int argc, char* argv[])
+{
+    Options options;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string option = argv[i];
+
+        if (option == "--help") {
+            printUsage();
+            std::exit(EXIT_SUCCESS);
+        }
+
+        if (i + 1 >= argc) {
+            throw std::runtime_error{ "missing value of " + option };
+        }
+
+        const std::string value = argv[++i];
+
+        if (option == "--cities") {
+            loadCities(value, options.locations);
+        } else if (option == "--location") {
+            const auto equals = value.find('=');
+            const auto comma = value.find(',', equals);
+            if (equals == std::string::npos || comma == std::string::npos) {
+                throw std::runtime_error{ "invalid location: " + value };
+            }
+            options.locations.push_back(parseLocation(
+                value.substr(0, equals),
+                value.substr(equals + 1, comma - equals - 1),
+                value.substr(comma + 1)
+            ));
+        } else if (option == "--compare") {
+            const auto equals = value.find('=');
+            if (equals == std::string::npos) {
+                throw std::runtime_error{ "invalid reference: " + value };
+            }
+            std::string name = value.substr(0, equals);
+            std::transform(name.begin(), name.end(), name.begin(), ::toupper);
+            options.references[name] = value.substr(equals + 1);
+        } else if (option == "--output-dir") {
+            options.outputDirectory = value;
+        } else if (option == "--bucket-dir") {
+            options.bucketTableDirectory = value;
+        } else if (option == "--harmonics") {
+            options.harmonics = std::stoi(value);
+        } else if (option == "--year") {
+            options.year = std::stoi(value);
+        } else if (option == "--threads") {
+            options.threads = std::stoul(value);
+        } else {
+            throw std::runtime_error{ "unknown option: " + option };
+        }
+    }
+
+    if (options.locations.empty()) {
+        throw std::runtime_error{ "no locations, use --cities or --location" };
+    }
+
+    // The tables have an entry for February 29th
+    if (!isLeapYear(options.year)) {
+        throw std::runtime_error{ "the year of the tables must be a leap year" };
+    }
+
+    if (options.harmonics < 1 || options.harmonics > 8) {
+        throw std::runtime_error{ "the number of harmonics must be 1..8" };
+    }
+
+    return options;
+}
+
+// Difference in minutes around midnight
+int difference(const int a, const int b)
+{
+    const int d = std::abs(a - b) % (24 * 60);
+    return std::min(d, 24 * 60 - d);
+}
+
+int maxDecodingError(const Coefficients& coefficients, const std::vector<double>& minutes)
+{
+    int error = 0;
+    for (int day = 0; day < DaysOfTable; ++day) {
+        error = std::max(error, difference(decodeHarmonics(coefficients, day), wrapAroundMidnight(minutes[day])));
+    }
+    return error;
+}
+
+void compare(const LocationTables& tables, const std::filesystem::path& path)
+{
+    const auto reference = loadBucketTable(path);
+
+    int differentBuckets = 0;
+    int maxBucketError = 0;
+    int maxHarmonicsError = 0;
+
+    for (int day = 0; day < DaysOfTable; ++day) {
+        const auto buckets = toBuckets(tables.events[day]);
+
+        for (int event = 0; event < 2; ++event) {
+            const auto& coefficients = event == 0 ? tables.sunrise : tables.sunset;
+            const int referenceMinutes = reference[day][event] * BucketMinutes;
+
+            differentBuckets += buckets[event] != reference[day][event] ? 1 : 0;
+            maxBucketError = std::max(maxBucketError, difference(buckets[event] * BucketMinutes, referenceMinutes));
+            maxHarmonicsError = std::max(maxHarmonicsError, difference(decodeHarmonics(coefficients, day), referenceMinutes));
+        }
+    }
+
+    std::printf(
+        "  Against %s: %d of %d buckets differ (max. %d minutes), compressed max. error %d minutes\n",
+        path.string().c_str(),
+        differentBuckets,
+        2 * DaysOfTable,
+        maxBucketError,
+        maxHarmonicsError
+    );
+}
+
+}
+
+int main(int argc, char* argv[])
+{
+    try {
+        const auto options = parseOptions(argc, argv);
+        const auto started = std::chrono::steady_clock::now();
+
+        std::vector<LocationTables> tables(options.locations.size());
+
+        // One task per day and location
+        {
+            host::ThreadPool pool{
+                static_cast<unsigned>(options.threads > 0 ? options.threads : std::thread::hardware_concurrency())
+            };
+
+            for (size_t i = 0; i < tables.size(); ++i) {
+                tables[i].location = options.locations[i];
+                tables[i].events.resize(DaysOfTable);
+            }
+
+            pool.run(tables.size() * DaysOfTable, [&](const size_t index) {
+                auto& t = tables[index / DaysOfTable];
+                const int day = static_cast<int>(index % DaysOfTable);
+
+                t.events[day] = calculateSunEvents(t.location.latitude, t.location.longitude, options.year, day);
+            });
+
+            // The fits are independent as well
+            pool.run(tables.size(), [&](const size_t index) {
+                auto& t = tables[index];
+
+                std::vector<double> sunrise;
+                std::vector<double> sunset;
+                for (const auto& e : t.events) {
+                    sunrise.push_back(e.sunrise);
+                    sunset.push_back(e.sunset);
+                }
+
+                t.sunrise = fitHarmonics(sunrise, options.harmonics);
+                t.sunset = fitHarmonics(sunset, options.harmonics);
+                t.sunriseError = maxDecodingError(t.sunrise, sunrise);
+                t.sunsetError = maxDecodingError(t.sunset, sunset);
+            });
+        }
+
+        const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - started);
+
+        for (const auto& t : tables) {
+            std::printf(
+                "%s (%.5f, %.5f): compressed max. error %d minutes (sunrise), %d minutes (sunset)\n",
+                t.location.name.c_str(),
+                t.location.latitude,
+                t.location.longitude,
+                t.sunriseError,
+                t.sunsetError
+            );
+
+            if (const auto reference = options.references.find(t.location.name); reference != options.references.end()) {
+                compare(t, reference->second);
+            }
+        }
+
+        std::printf(
+            "%zu locations in %.3f s, compressed size: %zu bytes (6-minute tables: %zu bytes)\n",
+            tables.size(),
+            elapsed.count(),
+            tables.size() * 2 * (1 + 2 * options.harmonics) * sizeof(int16_t),
+            tables.size() * DaysOfTable * 2
+        );
+
+        if (!options.outputDirectory.empty()) {
+            writeCompressedTables(options.outputDirectory, tables, options.harmonics);
+        }
+
+        if (!options.bucketTableDirectory.empty()) {
+            std::filesystem::create_directories(options.bucketTableDirectory);
+            for (const auto& t : tables) {
+                writeBucketTable(options.bucketTableDirectory / (t.location.name + ".c"), t);
+            }
+        }
+    } catch (const std::exception& e) {
+        std::fprintf(stderr, "Error: %s\n", e.what());
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
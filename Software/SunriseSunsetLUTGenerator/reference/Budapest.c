@@ -0,0 +1,191 @@
+#include "Clock.h"
+#include <stdint.h>
+// Sunrise-sunset LUT for latitude=47.497905004563854, longitude=19.04026815086008.
+// Made by SunriseSunsetLUTGenerator.py.
+// First value is the sunrise, second is the sunset, both measured in minutes from midnight, in UTC.
+// During non-leap years, February 29th (index=59) must be skipped, all subsequent indices must be offset by 1.
+const uint8_t SunriseSunsetLUT[366][2] = {
+    /* Day 001 */ { 0x41, 0x96 }, /* Day 002 */ { 0x41, 0x96 },
+    /* Day 003 */ { 0x41, 0x96 }, /* Day 004 */ { 0x41, 0x96 },
+    /* Day 005 */ { 0x41, 0x97 }, /* Day 006 */ { 0x41, 0x97 },
+    /* Day 007 */ { 0x41, 0x97 }, /* Day 008 */ { 0x41, 0x97 },
+    /* Day 009 */ { 0x41, 0x97 }, /* Day 010 */ { 0x40, 0x98 },
+    /* Day 011 */ { 0x40, 0x98 }, /* Day 012 */ { 0x40, 0x98 },
+    /* Day 013 */ { 0x40, 0x98 }, /* Day 014 */ { 0x40, 0x98 },
+    /* Day 015 */ { 0x40, 0x99 }, /* Day 016 */ { 0x40, 0x99 },
+    /* Day 017 */ { 0x40, 0x99 }, /* Day 018 */ { 0x40, 0x99 },
+    /* Day 019 */ { 0x40, 0x9A }, /* Day 020 */ { 0x3F, 0x9A },
+    /* Day 021 */ { 0x3F, 0x9A }, /* Day 022 */ { 0x3F, 0x9A },
+    /* Day 023 */ { 0x3F, 0x9B }, /* Day 024 */ { 0x3F, 0x9B },
+    /* Day 025 */ { 0x3F, 0x9B }, /* Day 026 */ { 0x3E, 0x9B },
+    /* Day 027 */ { 0x3E, 0x9C }, /* Day 028 */ { 0x3E, 0x9C },
+    /* Day 029 */ { 0x3E, 0x9C }, /* Day 030 */ { 0x3E, 0x9C },
+    /* Day 031 */ { 0x3E, 0x9D }, /* Day 032 */ { 0x3D, 0x9D },
+    /* Day 033 */ { 0x3D, 0x9D }, /* Day 034 */ { 0x3D, 0x9D },
+    /* Day 035 */ { 0x3D, 0x9E }, /* Day 036 */ { 0x3C, 0x9E },
+    /* Day 037 */ { 0x3C, 0x9E }, /* Day 038 */ { 0x3C, 0x9E },
+    /* Day 039 */ { 0x3C, 0x9F }, /* Day 040 */ { 0x3B, 0x9F },
+    /* Day 041 */ { 0x3B, 0x9F }, /* Day 042 */ { 0x3B, 0x9F },
+    /* Day 043 */ { 0x3B, 0xA0 }, /* Day 044 */ { 0x3A, 0xA0 },
+    /* Day 045 */ { 0x3A, 0xA0 }, /* Day 046 */ { 0x3A, 0xA1 },
+    /* Day 047 */ { 0x3A, 0xA1 }, /* Day 048 */ { 0x39, 0xA1 },
+    /* Day 049 */ { 0x39, 0xA1 }, /* Day 050 */ { 0x39, 0xA2 },
+    /* Day 051 */ { 0x38, 0xA2 }, /* Day 052 */ { 0x38, 0xA2 },
+    /* Day 053 */ { 0x38, 0xA2 }, /* Day 054 */ { 0x38, 0xA3 },
+    /* Day 055 */ { 0x37, 0xA3 }, /* Day 056 */ { 0x37, 0xA3 },
+    /* Day 057 */ { 0x37, 0xA3 }, /* Day 058 */ { 0x36, 0xA4 },
+    /* Day 059 */ { 0x36, 0xA4 }, /* Day 060 */ { 0x36, 0xA4 },
+    /* Day 061 */ { 0x35, 0xA4 }, /* Day 062 */ { 0x35, 0xA5 },
+    /* Day 063 */ { 0x35, 0xA5 }, /* Day 064 */ { 0x34, 0xA5 },
+    /* Day 065 */ { 0x34, 0xA5 }, /* Day 066 */ { 0x34, 0xA6 },
+    /* Day 067 */ { 0x34, 0xA6 }, /* Day 068 */ { 0x33, 0xA6 },
+    /* Day 069 */ { 0x33, 0xA6 }, /* Day 070 */ { 0x33, 0xA7 },
+    /* Day 071 */ { 0x32, 0xA7 }, /* Day 072 */ { 0x32, 0xA7 },
+    /* Day 073 */ { 0x32, 0xA7 }, /* Day 074 */ { 0x31, 0xA8 },
+    /* Day 075 */ { 0x31, 0xA8 }, /* Day 076 */ { 0x31, 0xA8 },
+    /* Day 077 */ { 0x30, 0xA8 }, /* Day 078 */ { 0x30, 0xA9 },
+    /* Day 079 */ { 0x30, 0xA9 }, /* Day 080 */ { 0x2F, 0xA9 },
+    /* Day 081 */ { 0x2F, 0xA9 }, /* Day 082 */ { 0x2F, 0xA9 },
+    /* Day 083 */ { 0x2E, 0xAA }, /* Day 084 */ { 0x2E, 0xAA },
+    /* Day 085 */ { 0x2E, 0xAA }, /* Day 086 */ { 0x2D, 0xAA },
+    /* Day 087 */ { 0x2D, 0xAB }, /* Day 088 */ { 0x2D, 0xAB },
+    /* Day 089 */ { 0x2C, 0xAB }, /* Day 090 */ { 0x2C, 0xAB },
+    /* Day 091 */ { 0x2C, 0xAC }, /* Day 092 */ { 0x2B, 0xAC },
+    /* Day 093 */ { 0x2B, 0xAC }, /* Day 094 */ { 0x2B, 0xAC },
+    /* Day 095 */ { 0x2A, 0xAD }, /* Day 096 */ { 0x2A, 0xAD },
+    /* Day 097 */ { 0x2A, 0xAD }, /* Day 098 */ { 0x29, 0xAD },
+    /* Day 099 */ { 0x29, 0xAD }, /* Day 100 */ { 0x29, 0xAE },
+    /* Day 101 */ { 0x28, 0xAE }, /* Day 102 */ { 0x28, 0xAE },
+    /* Day 103 */ { 0x28, 0xAE }, /* Day 104 */ { 0x27, 0xAF },
+    /* Day 105 */ { 0x27, 0xAF }, /* Day 106 */ { 0x27, 0xAF },
+    /* Day 107 */ { 0x26, 0xAF }, /* Day 108 */ { 0x26, 0xB0 },
+    /* Day 109 */ { 0x26, 0xB0 }, /* Day 110 */ { 0x25, 0xB0 },
+    /* Day 111 */ { 0x25, 0xB0 }, /* Day 112 */ { 0x25, 0xB1 },
+    /* Day 113 */ { 0x24, 0xB1 }, /* Day 114 */ { 0x24, 0xB1 },
+    /* Day 115 */ { 0x24, 0xB1 }, /* Day 116 */ { 0x24, 0xB1 },
+    /* Day 117 */ { 0x23, 0xB2 }, /* Day 118 */ { 0x23, 0xB2 },
+    /* Day 119 */ { 0x23, 0xB2 }, /* Day 120 */ { 0x22, 0xB2 },
+    /* Day 121 */ { 0x22, 0xB3 }, /* Day 122 */ { 0x22, 0xB3 },
+    /* Day 123 */ { 0x22, 0xB3 }, /* Day 124 */ { 0x21, 0xB3 },
+    /* Day 125 */ { 0x21, 0xB4 }, /* Day 126 */ { 0x21, 0xB4 },
+    /* Day 127 */ { 0x21, 0xB4 }, /* Day 128 */ { 0x20, 0xB4 },
+    /* Day 129 */ { 0x20, 0xB4 }, /* Day 130 */ { 0x20, 0xB5 },
+    /* Day 131 */ { 0x20, 0xB5 }, /* Day 132 */ { 0x1F, 0xB5 },
+    /* Day 133 */ { 0x1F, 0xB5 }, /* Day 134 */ { 0x1F, 0xB6 },
+    /* Day 135 */ { 0x1F, 0xB6 }, /* Day 136 */ { 0x1F, 0xB6 },
+    /* Day 137 */ { 0x1E, 0xB6 }, /* Day 138 */ { 0x1E, 0xB6 },
+    /* Day 139 */ { 0x1E, 0xB7 }, /* Day 140 */ { 0x1E, 0xB7 },
+    /* Day 141 */ { 0x1E, 0xB7 }, /* Day 142 */ { 0x1D, 0xB7 },
+    /* Day 143 */ { 0x1D, 0xB7 }, /* Day 144 */ { 0x1D, 0xB8 },
+    /* Day 145 */ { 0x1D, 0xB8 }, /* Day 146 */ { 0x1D, 0xB8 },
+    /* Day 147 */ { 0x1D, 0xB8 }, /* Day 148 */ { 0x1D, 0xB8 },
+    /* Day 149 */ { 0x1C, 0xB8 }, /* Day 150 */ { 0x1C, 0xB9 },
+    /* Day 151 */ { 0x1C, 0xB9 }, /* Day 152 */ { 0x1C, 0xB9 },
+    /* Day 153 */ { 0x1C, 0xB9 }, /* Day 154 */ { 0x1C, 0xB9 },
+    /* Day 155 */ { 0x1C, 0xB9 }, /* Day 156 */ { 0x1C, 0xBA },
+    /* Day 157 */ { 0x1C, 0xBA }, /* Day 158 */ { 0x1B, 0xBA },
+    /* Day 159 */ { 0x1B, 0xBA }, /* Day 160 */ { 0x1B, 0xBA },
+    /* Day 161 */ { 0x1B, 0xBA }, /* Day 162 */ { 0x1B, 0xBA },
+    /* Day 163 */ { 0x1B, 0xBA }, /* Day 164 */ { 0x1B, 0xBA },
+    /* Day 165 */ { 0x1B, 0xBB }, /* Day 166 */ { 0x1B, 0xBB },
+    /* Day 167 */ { 0x1B, 0xBB }, /* Day 168 */ { 0x1B, 0xBB },
+    /* Day 169 */ { 0x1B, 0xBB }, /* Day 170 */ { 0x1B, 0xBB },
+    /* Day 171 */ { 0x1B, 0xBB }, /* Day 172 */ { 0x1B, 0xBB },
+    /* Day 173 */ { 0x1B, 0xBB }, /* Day 174 */ { 0x1B, 0xBB },
+    /* Day 175 */ { 0x1B, 0xBB }, /* Day 176 */ { 0x1B, 0xBB },
+    /* Day 177 */ { 0x1B, 0xBB }, /* Day 178 */ { 0x1C, 0xBB },
+    /* Day 179 */ { 0x1C, 0xBB }, /* Day 180 */ { 0x1C, 0xBB },
+    /* Day 181 */ { 0x1C, 0xBB }, /* Day 182 */ { 0x1C, 0xBB },
+    /* Day 183 */ { 0x1C, 0xBB }, /* Day 184 */ { 0x1C, 0xBB },
+    /* Day 185 */ { 0x1C, 0xBB }, /* Day 186 */ { 0x1C, 0xBB },
+    /* Day 187 */ { 0x1C, 0xBB }, /* Day 188 */ { 0x1D, 0xBB },
+    /* Day 189 */ { 0x1D, 0xBB }, /* Day 190 */ { 0x1D, 0xBA },
+    /* Day 191 */ { 0x1D, 0xBA }, /* Day 192 */ { 0x1D, 0xBA },
+    /* Day 193 */ { 0x1D, 0xBA }, /* Day 194 */ { 0x1D, 0xBA },
+    /* Day 195 */ { 0x1E, 0xBA }, /* Day 196 */ { 0x1E, 0xBA },
+    /* Day 197 */ { 0x1E, 0xBA }, /* Day 198 */ { 0x1E, 0xB9 },
+    /* Day 199 */ { 0x1E, 0xB9 }, /* Day 200 */ { 0x1E, 0xB9 },
+    /* Day 201 */ { 0x1F, 0xB9 }, /* Day 202 */ { 0x1F, 0xB9 },
+    /* Day 203 */ { 0x1F, 0xB9 }, /* Day 204 */ { 0x1F, 0xB9 },
+    /* Day 205 */ { 0x1F, 0xB8 }, /* Day 206 */ { 0x20, 0xB8 },
+    /* Day 207 */ { 0x20, 0xB8 }, /* Day 208 */ { 0x20, 0xB8 },
+    /* Day 209 */ { 0x20, 0xB8 }, /* Day 210 */ { 0x20, 0xB7 },
+    /* Day 211 */ { 0x21, 0xB7 }, /* Day 212 */ { 0x21, 0xB7 },
+    /* Day 213 */ { 0x21, 0xB7 }, /* Day 214 */ { 0x21, 0xB6 },
+    /* Day 215 */ { 0x21, 0xB6 }, /* Day 216 */ { 0x22, 0xB6 },
+    /* Day 217 */ { 0x22, 0xB6 }, /* Day 218 */ { 0x22, 0xB5 },
+    /* Day 219 */ { 0x22, 0xB5 }, /* Day 220 */ { 0x22, 0xB5 },
+    /* Day 221 */ { 0x23, 0xB5 }, /* Day 222 */ { 0x23, 0xB4 },
+    /* Day 223 */ { 0x23, 0xB4 }, /* Day 224 */ { 0x23, 0xB4 },
+    /* Day 225 */ { 0x24, 0xB4 }, /* Day 226 */ { 0x24, 0xB3 },
+    /* Day 227 */ { 0x24, 0xB3 }, /* Day 228 */ { 0x24, 0xB3 },
+    /* Day 229 */ { 0x24, 0xB2 }, /* Day 230 */ { 0x25, 0xB2 },
+    /* Day 231 */ { 0x25, 0xB2 }, /* Day 232 */ { 0x25, 0xB2 },
+    /* Day 233 */ { 0x25, 0xB1 }, /* Day 234 */ { 0x26, 0xB1 },
+    /* Day 235 */ { 0x26, 0xB1 }, /* Day 236 */ { 0x26, 0xB0 },
+    /* Day 237 */ { 0x26, 0xB0 }, /* Day 238 */ { 0x26, 0xB0 },
+    /* Day 239 */ { 0x27, 0xAF }, /* Day 240 */ { 0x27, 0xAF },
+    /* Day 241 */ { 0x27, 0xAF }, /* Day 242 */ { 0x27, 0xAE },
+    /* Day 243 */ { 0x28, 0xAE }, /* Day 244 */ { 0x28, 0xAE },
+    /* Day 245 */ { 0x28, 0xAD }, /* Day 246 */ { 0x28, 0xAD },
+    /* Day 247 */ { 0x28, 0xAD }, /* Day 248 */ { 0x29, 0xAC },
+    /* Day 249 */ { 0x29, 0xAC }, /* Day 250 */ { 0x29, 0xAC },
+    /* Day 251 */ { 0x29, 0xAB }, /* Day 252 */ { 0x2A, 0xAB },
+    /* Day 253 */ { 0x2A, 0xAB }, /* Day 254 */ { 0x2A, 0xAA },
+    /* Day 255 */ { 0x2A, 0xAA }, /* Day 256 */ { 0x2A, 0xAA },
+    /* Day 257 */ { 0x2B, 0xA9 }, /* Day 258 */ { 0x2B, 0xA9 },
+    /* Day 259 */ { 0x2B, 0xA9 }, /* Day 260 */ { 0x2B, 0xA8 },
+    /* Day 261 */ { 0x2C, 0xA8 }, /* Day 262 */ { 0x2C, 0xA8 },
+    /* Day 263 */ { 0x2C, 0xA7 }, /* Day 264 */ { 0x2C, 0xA7 },
+    /* Day 265 */ { 0x2C, 0xA7 }, /* Day 266 */ { 0x2D, 0xA6 },
+    /* Day 267 */ { 0x2D, 0xA6 }, /* Day 268 */ { 0x2D, 0xA6 },
+    /* Day 269 */ { 0x2D, 0xA5 }, /* Day 270 */ { 0x2E, 0xA5 },
+    /* Day 271 */ { 0x2E, 0xA5 }, /* Day 272 */ { 0x2E, 0xA4 },
+    /* Day 273 */ { 0x2E, 0xA4 }, /* Day 274 */ { 0x2E, 0xA4 },
+    /* Day 275 */ { 0x2F, 0xA3 }, /* Day 276 */ { 0x2F, 0xA3 },
+    /* Day 277 */ { 0x2F, 0xA3 }, /* Day 278 */ { 0x2F, 0xA2 },
+    /* Day 279 */ { 0x30, 0xA2 }, /* Day 280 */ { 0x30, 0xA2 },
+    /* Day 281 */ { 0x30, 0xA1 }, /* Day 282 */ { 0x30, 0xA1 },
+    /* Day 283 */ { 0x31, 0xA1 }, /* Day 284 */ { 0x31, 0xA0 },
+    /* Day 285 */ { 0x31, 0xA0 }, /* Day 286 */ { 0x31, 0xA0 },
+    /* Day 287 */ { 0x32, 0x9F }, /* Day 288 */ { 0x32, 0x9F },
+    /* Day 289 */ { 0x32, 0x9F }, /* Day 290 */ { 0x32, 0x9E },
+    /* Day 291 */ { 0x32, 0x9E }, /* Day 292 */ { 0x33, 0x9E },
+    /* Day 293 */ { 0x33, 0x9D }, /* Day 294 */ { 0x33, 0x9D },
+    /* Day 295 */ { 0x33, 0x9D }, /* Day 296 */ { 0x34, 0x9D },
+    /* Day 297 */ { 0x34, 0x9C }, /* Day 298 */ { 0x34, 0x9C },
+    /* Day 299 */ { 0x34, 0x9C }, /* Day 300 */ { 0x35, 0x9B },
+    /* Day 301 */ { 0x35, 0x9B }, /* Day 302 */ { 0x35, 0x9B },
+    /* Day 303 */ { 0x35, 0x9B }, /* Day 304 */ { 0x36, 0x9A },
+    /* Day 305 */ { 0x36, 0x9A }, /* Day 306 */ { 0x36, 0x9A },
+    /* Day 307 */ { 0x36, 0x9A }, /* Day 308 */ { 0x37, 0x99 },
+    /* Day 309 */ { 0x37, 0x99 }, /* Day 310 */ { 0x37, 0x99 },
+    /* Day 311 */ { 0x37, 0x99 }, /* Day 312 */ { 0x38, 0x98 },
+    /* Day 313 */ { 0x38, 0x98 }, /* Day 314 */ { 0x38, 0x98 },
+    /* Day 315 */ { 0x38, 0x98 }, /* Day 316 */ { 0x39, 0x98 },
+    /* Day 317 */ { 0x39, 0x97 }, /* Day 318 */ { 0x39, 0x97 },
+    /* Day 319 */ { 0x39, 0x97 }, /* Day 320 */ { 0x3A, 0x97 },
+    /* Day 321 */ { 0x3A, 0x97 }, /* Day 322 */ { 0x3A, 0x96 },
+    /* Day 323 */ { 0x3A, 0x96 }, /* Day 324 */ { 0x3B, 0x96 },
+    /* Day 325 */ { 0x3B, 0x96 }, /* Day 326 */ { 0x3B, 0x96 },
+    /* Day 327 */ { 0x3B, 0x96 }, /* Day 328 */ { 0x3C, 0x95 },
+    /* Day 329 */ { 0x3C, 0x95 }, /* Day 330 */ { 0x3C, 0x95 },
+    /* Day 331 */ { 0x3C, 0x95 }, /* Day 332 */ { 0x3C, 0x95 },
+    /* Day 333 */ { 0x3D, 0x95 }, /* Day 334 */ { 0x3D, 0x95 },
+    /* Day 335 */ { 0x3D, 0x95 }, /* Day 336 */ { 0x3D, 0x95 },
+    /* Day 337 */ { 0x3E, 0x95 }, /* Day 338 */ { 0x3E, 0x94 },
+    /* Day 339 */ { 0x3E, 0x94 }, /* Day 340 */ { 0x3E, 0x94 },
+    /* Day 341 */ { 0x3E, 0x94 }, /* Day 342 */ { 0x3E, 0x94 },
+    /* Day 343 */ { 0x3F, 0x94 }, /* Day 344 */ { 0x3F, 0x94 },
+    /* Day 345 */ { 0x3F, 0x94 }, /* Day 346 */ { 0x3F, 0x94 },
+    /* Day 347 */ { 0x3F, 0x94 }, /* Day 348 */ { 0x3F, 0x94 },
+    /* Day 349 */ { 0x40, 0x94 }, /* Day 350 */ { 0x40, 0x94 },
+    /* Day 351 */ { 0x40, 0x94 }, /* Day 352 */ { 0x40, 0x94 },
+    /* Day 353 */ { 0x40, 0x94 }, /* Day 354 */ { 0x40, 0x95 },
+    /* Day 355 */ { 0x40, 0x95 }, /* Day 356 */ { 0x40, 0x95 },
+    /* Day 357 */ { 0x40, 0x95 }, /* Day 358 */ { 0x40, 0x95 },
+    /* Day 359 */ { 0x41, 0x95 }, /* Day 360 */ { 0x41, 0x95 },
+    /* Day 361 */ { 0x41, 0x95 }, /* Day 362 */ { 0x41, 0x95 },
+    /* Day 363 */ { 0x41, 0x95 }, /* Day 364 */ { 0x41, 0x96 },
+    /* Day 365 */ { 0x41, 0x96 }, /* Day 366 */ { 0x41, 0x96 }
+};